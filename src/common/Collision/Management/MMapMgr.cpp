@@ -66,6 +66,16 @@ namespace MMAP
     }
 
     bool MMapMgr::LoadTile(dtNavMesh* navMesh, uint32 mapId, int32 x, int32 y)
+    {
+        uint32 size = 0;
+        unsigned char* data = ReadTile(mapId, x, y, size);
+        if (!data)
+            return false;
+
+        return AddTile(navMesh, mapId, x, y, data, size);
+    }
+
+    unsigned char* MMapMgr::ReadTile(uint32 mapId, int32 x, int32 y, uint32& size)
     {
         // load this tile :: mmaps/MMMXXYY.mmtile
         std::string fileName = Acore::StringFormat(TILE_FILE_NAME_FORMAT, sConfigMgr->GetOption<std::string>("DataDir", "."), mapId, x, y);
@@ -73,7 +83,7 @@ namespace MMAP
         if (!file)
         {
             LOG_DEBUG("maps", "MMAP:loadMap: Could not open mmtile file '{}'", fileName);
-            return false;
+            return nullptr;
         }
 
         // read header
@@ -82,7 +92,7 @@ namespace MMAP
         {
             LOG_ERROR("maps", "MMAP:loadMap: Bad header in mmap {:03}{:02}{:02}.mmtile", mapId, x, y);
             fclose(file);
-            return false;
+            return nullptr;
         }
 
         if (fileHeader.mmapVersion != MMAP_VERSION)
@@ -90,7 +100,7 @@ namespace MMAP
             LOG_ERROR("maps", "MMAP:loadMap: {:03}{:02}{:02}.mmtile was built with generator v{}, expected v{}",
                            mapId, x, y, fileHeader.mmapVersion, MMAP_VERSION);
             fclose(file);
-            return false;
+            return nullptr;
         }
 
         unsigned char* data = (unsigned char*)dtAlloc(fileHeader.size, DT_ALLOC_PERM);
@@ -100,16 +110,23 @@ namespace MMAP
         if (!result)
         {
             LOG_ERROR("maps", "MMAP:loadMap: Bad header or data in mmap {:03}{:02}{:02}.mmtile", mapId, x, y);
+            dtFree(data);
             fclose(file);
-            return false;
+            return nullptr;
         }
 
         fclose(file);
 
+        size = fileHeader.size;
+        return data;
+    }
+
+    bool MMapMgr::AddTile(dtNavMesh* navMesh, uint32 mapId, int32 x, int32 y, unsigned char* data, uint32 size)
+    {
         dtTileRef tileRef = 0;
 
         // memory allocated for data is now managed by detour, and will be deallocated when the tile is removed
-        if (dtStatusSucceed(navMesh->addTile(data, fileHeader.size, DT_TILE_FREE_DATA, 0, &tileRef)))
+        if (dtStatusSucceed(navMesh->addTile(data, size, DT_TILE_FREE_DATA, 0, &tileRef)))
         {
             dtMeshHeader* header = (dtMeshHeader*)data;
             LOG_DEBUG("maps", "MMAP:loadMap: Loaded mmtile {:03}[{:02},{:02}] into {:03}[{:02},{:02}]", mapId, x, y, mapId, header->x, header->y);
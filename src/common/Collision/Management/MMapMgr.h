@@ -68,6 +68,10 @@ namespace MMAP
 
         static std::shared_ptr<dtNavMesh> LoadNavMesh(uint32 mapId);
         static bool LoadTile(dtNavMesh* navMesh, uint32 mapId, int32 x, int32 y);
+        // Reads a tile file into a dtAlloc'ed buffer without touching any navmesh, safe from any thread
+        static unsigned char* ReadTile(uint32 mapId, int32 x, int32 y, uint32& size);
+        // Takes ownership of data read by ReadTile
+        static bool AddTile(dtNavMesh* navMesh, uint32 mapId, int32 x, int32 y, unsigned char* data, uint32 size);
         static ManagedNavMeshQuery CreateNavMeshQuery(dtNavMesh* navMesh);
 
     private:
@@ -17,71 +17,53 @@
 
 #include "DBCFileLoader.h"
 #include "Errors.h"
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
 #include <string.h>
 
 DBCFileLoader::DBCFileLoader() : recordSize(0), recordCount(0), fieldCount(0), stringSize(0), fieldsOffset(nullptr), data(nullptr), stringTable(nullptr) { }
 
 bool DBCFileLoader::Load(char const* filename, char const* fmt)
 {
-    uint32 header;
-    if (data)
-    {
-        delete [] data;
-        data = nullptr;
-    }
+    data = nullptr;
+    stringTable = nullptr;
+    fileImage.reset();
 
-    FILE* f = fopen(filename, "rb");
-    if (!f)
+    // The file is mapped copy-on-write: clean pages are shared through the page cache with every
+    // other process reading the same file, while in-place corrections stay private to this process
+    try
     {
-        return false;
+        boost::interprocess::file_mapping file(filename, boost::interprocess::read_only);
+        fileImage = std::make_unique<FileImage>(file, boost::interprocess::copy_on_write);
     }
-
-    if (fread(&header, 4, 1, f) != 1)                        // Number of records
+    catch (boost::interprocess::interprocess_exception const&)
     {
-        fclose(f);
         return false;
     }
 
-    EndianConvert(header);
+    std::size_t const fileSize = fileImage->get_size();
+    unsigned char* image = static_cast<unsigned char*>(fileImage->get_address());
 
-    if (header != 0x43424457)                                //'WDBC'
-    {
-        fclose(f);
+    uint32 header[5];
+    if (fileSize < sizeof(header))
         return false;
-    }
 
-    if (fread(&recordCount, 4, 1, f) != 1)                   // Number of records
-    {
-        fclose(f);
-        return false;
-    }
-
-    EndianConvert(recordCount);
+    memcpy(header, image, sizeof(header));
+    for (uint32& value : header)
+        EndianConvert(value);
 
-    if (fread(&fieldCount, 4, 1, f) != 1)                    // Number of fields
-    {
-        fclose(f);
+    if (header[0] != 0x43424457)                             //'WDBC'
         return false;
-    }
 
-    EndianConvert(fieldCount);
+    recordCount = header[1];                                 // Number of records
+    fieldCount = header[2];                                  // Number of fields
+    recordSize = header[3];                                  // Size of a record
+    stringSize = header[4];                                  // String size
 
-    if (fread(&recordSize, 4, 1, f) != 1)                    // Size of a record
-    {
-        fclose(f);
+    if (fileSize < sizeof(header) + std::size_t(recordSize) * recordCount + stringSize)
         return false;
-    }
-
-    EndianConvert(recordSize);
-
-    if (fread(&stringSize, 4, 1, f) != 1)                    // String size
-    {
-        fclose(f);
-        return false;
-    }
-
-    EndianConvert(stringSize);
 
+    delete[] fieldsOffset;
     fieldsOffset = new uint32[fieldCount];
     fieldsOffset[0] = 0;
 
@@ -98,27 +80,24 @@ bool DBCFileLoader::Load(char const* filename, char const* fmt)
         }
     }
 
-    data = new unsigned char[recordSize * recordCount + stringSize];
+    data = image + sizeof(header);
     stringTable = data + recordSize * recordCount;
 
-    if (fread(data, recordSize * recordCount + stringSize, 1, f) != 1)
-    {
-        fclose(f);
-        return false;
-    }
-
-    fclose(f);
-
     return true;
 }
 
 DBCFileLoader::~DBCFileLoader()
 {
-    delete[] data;
-
     delete[] fieldsOffset;
 }
 
+std::unique_ptr<DBCFileLoader::FileImage> DBCFileLoader::ReleaseFileImage()
+{
+    data = nullptr;
+    stringTable = nullptr;
+    return std::move(fileImage);
+}
+
 DBCFileLoader::Record DBCFileLoader::getRecord(std::size_t id)
 {
     ASSERT(data);
@@ -173,36 +152,49 @@ uint32 DBCFileLoader::GetFormatRecordSize(char const* format, int32* index_pos)
     return recordsize;
 }
 
-char* DBCFileLoader::AutoProduceData(char const* format, uint32& records, char**& indexTable)
+bool DBCFileLoader::IsMappableFormat(char const* format)
 {
-    /*
-    format STRING, NA, FLOAT, NA, INT <=>
-    struct{
-    char* field0,
-    float field1,
-    int field2
-    }entry;
+#if ACORE_ENDIAN == ACORE_LITTLEENDIAN
+    auto isLoaded = [](char field) { return field == FT_IND || field == FT_INT || field == FT_FLOAT; };
+    auto isSkipped = [](char field) { return field == FT_NA || field == FT_NA_BYTE || field == FT_SORT; };
 
-    this func will generate  entry[rows] data;
-    */
+    char const* field = format;
+    while (isSkipped(*field))
+        ++field;
 
-    typedef char* ptr;
-    if (strlen(format) != fieldCount)
-    {
-        return nullptr;
-    }
+    if (!isLoaded(*field))
+        return false;
 
-    //get struct size and index pos
-    int32 i;
-    uint32 recordsize = GetFormatRecordSize(format, &i);
+    while (isLoaded(*field))
+        ++field;
+
+    while (isSkipped(*field))
+        ++field;
+
+    return !*field;
+#else
+    (void)format;
+    return false;
+#endif
+}
+
+bool DBCFileLoader::HasStrings(char const* format)
+{
+    return strchr(format, FT_STRING) != nullptr;
+}
+
+char** DBCFileLoader::CreateIndexTable(int32 indexPos, uint32& records)
+{
+    typedef char* ptr;
+    ptr* indexTable;
 
-    if (i >= 0)
+    if (indexPos >= 0)
     {
         uint32 maxi = 0;
         //find max index
         for (uint32 y = 0; y < recordCount; ++y)
         {
-            uint32 ind = getRecord(y).getUInt(i);
+            uint32 ind = getRecord(y).getUInt(indexPos);
             if (ind > maxi)
             {
                 maxi = ind;
@@ -220,6 +212,77 @@ char* DBCFileLoader::AutoProduceData(char const* format, uint32& records, char**
         indexTable = new ptr[recordCount];
     }
 
+    return indexTable;
+}
+
+bool DBCFileLoader::AutoProduceMappedData(char const* format, uint32& records, char**& indexTable)
+{
+    if (!data || strlen(format) != fieldCount || !IsMappableFormat(format))
+    {
+        return false;
+    }
+
+    int32 i;
+    uint32 recordsize = GetFormatRecordSize(format, &i);
+
+    // skipped leading fields only move the start of the structure inside the record
+    uint32 firstField = 0;
+    while (format[firstField] == FT_NA || format[firstField] == FT_NA_BYTE || format[firstField] == FT_SORT)
+    {
+        ++firstField;
+    }
+
+    uint32 fieldOffset = GetOffset(firstField);
+
+    // structures are accessed in place, they have to stay 4 byte aligned
+    if (recordSize % sizeof(uint32) || fieldOffset % sizeof(uint32) || fieldOffset + recordsize > recordSize)
+    {
+        return false;
+    }
+
+    indexTable = CreateIndexTable(i, records);
+
+    for (uint32 y = 0; y < recordCount; ++y)
+    {
+        char* record = reinterpret_cast<char*>(data + y * recordSize + fieldOffset);
+
+        if (i >= 0)
+        {
+            indexTable[getRecord(y).getUInt(i)] = record;
+        }
+        else
+        {
+            indexTable[y] = record;
+        }
+    }
+
+    return true;
+}
+
+char* DBCFileLoader::AutoProduceData(char const* format, uint32& records, char**& indexTable)
+{
+    /*
+    format STRING, NA, FLOAT, NA, INT <=>
+    struct{
+    char* field0,
+    float field1,
+    int field2
+    }entry;
+
+    this func will generate  entry[rows] data;
+    */
+
+    if (strlen(format) != fieldCount)
+    {
+        return nullptr;
+    }
+
+    //get struct size and index pos
+    int32 i;
+    uint32 recordsize = GetFormatRecordSize(format, &i);
+
+    indexTable = CreateIndexTable(i, records);
+
     char* dataTable = new char[recordCount * recordsize];
 
     uint32 offset = 0;
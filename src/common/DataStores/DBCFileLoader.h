@@ -21,6 +21,12 @@
 #include "Define.h"
 #include "Errors.h"
 #include "Utilities/ByteConverter.h"
+#include <memory>
+
+namespace boost::interprocess
+{
+    class mapped_region;
+}
 
 enum DbcFieldFormat
 {
@@ -43,6 +49,8 @@ public:
 
     bool Load(char const* filename, char const* fmt);
 
+    typedef boost::interprocess::mapped_region FileImage;
+
     class Record
     {
     public:
@@ -94,9 +102,21 @@ public:
     [[nodiscard]] bool IsLoaded() const { return data != nullptr; }
     char* AutoProduceData(char const* fmt, uint32& count, char**& indexTable);
     char* AutoProduceStrings(char const* fmt, char* dataTable);
+
+    // Builds the index table straight on top of the file image, see IsMappableFormat
+    bool AutoProduceMappedData(char const* fmt, uint32& count, char**& indexTable);
+    // Hands the mapped file over to the caller, records returned by AutoProduceMappedData live in it
+    std::unique_ptr<FileImage> ReleaseFileImage();
+
     static uint32 GetFormatRecordSize(char const* format, int32* index_pos = nullptr);
+    // True if the C++ structure of the format has the same layout as the file record, which is
+    // the case when all loaded fields are consecutive 4 byte numeric fields
+    static bool IsMappableFormat(char const* format);
+    static bool HasStrings(char const* format);
 
 private:
+    char** CreateIndexTable(int32 indexPos, uint32& records);
+
     uint32 recordSize;
     uint32 recordCount;
     uint32 fieldCount;
@@ -104,6 +124,7 @@ private:
     uint32* fieldsOffset;
     unsigned char* data;
     unsigned char* stringTable;
+    std::unique_ptr<FileImage> fileImage;
 
     DBCFileLoader(DBCFileLoader const& right) = delete;
     DBCFileLoader& operator=(DBCFileLoader const& right) = delete;
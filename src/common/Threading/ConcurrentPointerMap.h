@@ -0,0 +1,180 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef CONCURRENT_POINTER_MAP_H
+#define CONCURRENT_POINTER_MAP_H
+
+#include "Define.h"
+#include "EpochReclaimer.h"
+#include "Errors.h"
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <memory>
+
+namespace Acore
+{
+    /**
+     * @brief Hash map from non-zero 64-bit keys to pointers with lock-free lookups.
+     *
+     * Open addressing with linear probing in a table that is never more than half full. Removed
+     * entries keep their key with a null value until the table is rebuilt, so a probe sequence is
+     * never cut short under a reader. Growing or cleaning up publishes a new table and retires the
+     * old one through the EpochReclaimer.
+     *
+     * Insert and Remove must be serialized by the caller, Find can run on any thread at any time.
+     */
+    template<class T>
+    class ConcurrentPointerMap
+    {
+        static constexpr uint32 MinCapacity = 64;
+
+        struct Slot
+        {
+            std::atomic<uint64> Key{0};
+            std::atomic<T*> Value{nullptr};
+        };
+
+        struct Table
+        {
+            explicit Table(uint32 capacity) : Mask(capacity - 1), Shift(64 - std::countr_zero(capacity)), Slots(new Slot[capacity]) { }
+
+            [[nodiscard]] uint32 GetCapacity() const { return Mask + 1; }
+            [[nodiscard]] uint32 GetIndex(uint64 key) const { return uint32((key * 0x9E3779B97F4A7C15ull) >> Shift); }
+
+            uint32 Mask;
+            uint32 Shift;
+            std::unique_ptr<Slot[]> Slots;
+        };
+
+    public:
+        ConcurrentPointerMap() : _table(new Table(MinCapacity)) { }
+        ~ConcurrentPointerMap() { delete _table.load(std::memory_order_relaxed); }
+
+        ConcurrentPointerMap(ConcurrentPointerMap const&) = delete;
+        ConcurrentPointerMap& operator=(ConcurrentPointerMap const&) = delete;
+
+        T* Find(uint64 key) const
+        {
+            EpochReclaimer::Guard guard;
+
+            Table const* table = _table.load(std::memory_order_seq_cst);
+            for (uint32 i = table->GetIndex(key);; i = (i + 1) & table->Mask)
+            {
+                uint64 const slotKey = table->Slots[i].Key.load(std::memory_order_acquire);
+                if (slotKey == key)
+                    return table->Slots[i].Value.load(std::memory_order_acquire);
+
+                if (!slotKey)
+                    return nullptr;
+            }
+        }
+
+        void Insert(uint64 key, T* value)
+        {
+            ASSERT(key && value);
+
+            Table* table = _table.load(std::memory_order_relaxed);
+            uint32 i = table->GetIndex(key);
+            for (;; i = (i + 1) & table->Mask)
+            {
+                uint64 const slotKey = table->Slots[i].Key.load(std::memory_order_relaxed);
+                if (slotKey == key)
+                {
+                    if (!table->Slots[i].Value.exchange(value, std::memory_order_release))
+                        ++_size;
+
+                    return;
+                }
+
+                if (!slotKey)
+                    break;
+            }
+
+            if ((_usedSlots + 1) * 2 > table->GetCapacity())
+            {
+                Rebuild();
+                Insert(key, value);
+                return;
+            }
+
+            // The value is in place before a reader can find the key
+            table->Slots[i].Value.store(value, std::memory_order_relaxed);
+            table->Slots[i].Key.store(key, std::memory_order_release);
+            ++_usedSlots;
+            ++_size;
+        }
+
+        void Remove(uint64 key)
+        {
+            Table* table = _table.load(std::memory_order_relaxed);
+            for (uint32 i = table->GetIndex(key);; i = (i + 1) & table->Mask)
+            {
+                uint64 const slotKey = table->Slots[i].Key.load(std::memory_order_relaxed);
+                if (!slotKey)
+                    return;
+
+                if (slotKey == key)
+                {
+                    if (table->Slots[i].Value.exchange(nullptr, std::memory_order_release))
+                        --_size;
+
+                    return;
+                }
+            }
+        }
+
+        /// Writer side only
+        [[nodiscard]] uint32 Size() const { return _size; }
+
+    private:
+        // Drops the removed entries and leaves room for as many entries again
+        void Rebuild()
+        {
+            Table* oldTable = _table.load(std::memory_order_relaxed);
+            Table* newTable = new Table(std::max(MinCapacity, std::bit_ceil((_size + 1) * 4)));
+
+            _usedSlots = 0;
+            for (uint32 i = 0; i < oldTable->GetCapacity(); ++i)
+            {
+                uint64 const key = oldTable->Slots[i].Key.load(std::memory_order_relaxed);
+                T* value = oldTable->Slots[i].Value.load(std::memory_order_relaxed);
+                if (!key || !value)
+                    continue;
+
+                uint32 j = newTable->GetIndex(key);
+                while (newTable->Slots[j].Key.load(std::memory_order_relaxed))
+                    j = (j + 1) & newTable->Mask;
+
+                newTable->Slots[j].Value.store(value, std::memory_order_relaxed);
+                newTable->Slots[j].Key.store(key, std::memory_order_relaxed);
+                ++_usedSlots;
+            }
+
+            _table.store(newTable, std::memory_order_seq_cst);
+            EpochReclaimer::Retire([oldTable]() { delete oldTable; });
+        }
+
+        std::atomic<Table*> _table;
+
+        // Writer side only
+        uint32 _usedSlots = 0;
+        uint32 _size = 0;
+    };
+}
+
+#endif
@@ -0,0 +1,136 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "EpochReclaimer.h"
+#include <algorithm>
+#include <atomic>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace
+{
+    constexpr uint64 IdleEpoch = std::numeric_limits<uint64>::max();
+
+    struct RetiredData
+    {
+        uint64 Epoch;
+        std::function<void()> Deleter;
+    };
+}
+
+struct alignas(64) Acore::EpochReclaimer::Participant
+{
+    std::atomic<uint64> Epoch{IdleEpoch};
+    std::atomic<bool> InUse{true};
+    uint32 Depth = 0;
+};
+
+namespace
+{
+    std::atomic<uint64> GlobalEpoch{1};
+
+    std::mutex Lock;
+    std::vector<std::unique_ptr<Acore::EpochReclaimer::Participant>> Participants;
+    std::vector<RetiredData> Retired;
+
+    // Hands the participant of an exiting thread over to the next new thread
+    struct ParticipantHolder
+    {
+        Acore::EpochReclaimer::Participant* Slot = nullptr;
+
+        ~ParticipantHolder()
+        {
+            if (Slot)
+                Slot->InUse.store(false, std::memory_order_release);
+        }
+    };
+
+    thread_local ParticipantHolder LocalParticipant;
+}
+
+Acore::EpochReclaimer::Participant* Acore::EpochReclaimer::GetParticipant()
+{
+    if (LocalParticipant.Slot)
+        return LocalParticipant.Slot;
+
+    std::lock_guard<std::mutex> guard(Lock);
+    for (std::unique_ptr<Participant>& participant : Participants)
+    {
+        if (!participant->InUse.load(std::memory_order_acquire))
+        {
+            participant->InUse.store(true, std::memory_order_relaxed);
+            LocalParticipant.Slot = participant.get();
+            return LocalParticipant.Slot;
+        }
+    }
+
+    Participants.push_back(std::make_unique<Participant>());
+    LocalParticipant.Slot = Participants.back().get();
+    return LocalParticipant.Slot;
+}
+
+Acore::EpochReclaimer::Guard::Guard() : _participant(GetParticipant())
+{
+    // Published before the guarded data is read, Advance can't miss a reader that already holds a pointer
+    if (!_participant->Depth++)
+        _participant->Epoch.store(GlobalEpoch.load(std::memory_order_relaxed), std::memory_order_seq_cst);
+}
+
+Acore::EpochReclaimer::Guard::~Guard()
+{
+    if (!--_participant->Depth)
+        _participant->Epoch.store(IdleEpoch, std::memory_order_release);
+}
+
+void Acore::EpochReclaimer::Retire(std::function<void()> deleter)
+{
+    std::lock_guard<std::mutex> guard(Lock);
+    Retired.push_back({ GlobalEpoch.load(std::memory_order_seq_cst), std::move(deleter) });
+}
+
+void Acore::EpochReclaimer::Advance()
+{
+    uint64 oldestReader = GlobalEpoch.fetch_add(1, std::memory_order_seq_cst) + 1;
+
+    std::vector<std::function<void()>> deleters;
+    {
+        std::lock_guard<std::mutex> guard(Lock);
+        if (Retired.empty())
+            return;
+
+        for (std::unique_ptr<Participant> const& participant : Participants)
+            oldestReader = std::min(oldestReader, participant->Epoch.load(std::memory_order_seq_cst));
+
+        // A reader that entered at the epoch of the retirement or before may still see the data
+        auto itr = std::partition(Retired.begin(), Retired.end(), [oldestReader](RetiredData const& data) { return data.Epoch >= oldestReader; });
+        for (auto freed = itr; freed != Retired.end(); ++freed)
+            deleters.push_back(std::move(freed->Deleter));
+
+        Retired.erase(itr, Retired.end());
+    }
+
+    for (std::function<void()>& deleter : deleters)
+        deleter();
+}
+
+std::size_t Acore::EpochReclaimer::GetRetiredCount()
+{
+    std::lock_guard<std::mutex> guard(Lock);
+    return Retired.size();
+}
@@ -0,0 +1,68 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef EPOCH_RECLAIMER_H
+#define EPOCH_RECLAIMER_H
+
+#include "Define.h"
+#include <functional>
+
+namespace Acore
+{
+    /**
+     * @brief Deferred reclamation for data read without locks.
+     *
+     * A reader holds a Guard while it follows pointers into shared data. A writer that unpublishes
+     * data hands its deleter to Retire, the deleter runs in a later Advance once every reader that
+     * could still see the data has left its guard. Advance is called once per world tick.
+     *
+     * Entering a guard is a store to a cache line owned by the calling thread, so concurrent readers
+     * never contend with each other.
+     */
+    class AC_COMMON_API EpochReclaimer
+    {
+    public:
+        // State of a reading thread, one cache line each
+        struct Participant;
+
+        class AC_COMMON_API Guard
+        {
+        public:
+            Guard();
+            ~Guard();
+
+            Guard(Guard const&) = delete;
+            Guard& operator=(Guard const&) = delete;
+
+        private:
+            Participant* _participant;
+        };
+
+        /// Runs the deleter once no guard entered before this call is left.
+        static void Retire(std::function<void()> deleter);
+
+        /// Starts a new epoch and runs the deleters no reader can reach anymore.
+        static void Advance();
+
+        [[nodiscard]] static std::size_t GetRetiredCount();
+
+    private:
+        static Participant* GetParticipant();
+    };
+}
+
+#endif
@@ -37,6 +37,12 @@ public:
         _storage.resize(initialSize);
     }
 
+    // Takes over the allocation of storage, its contents are discarded
+    explicit MessageBuffer(std::vector<uint8>&& storage) : _storage(std::move(storage))
+    {
+        _storage.clear();
+    }
+
     MessageBuffer(MessageBuffer const& right) :
         _wpos(right._wpos), _rpos(right._rpos), _storage(right._storage) { }
 
@@ -25,6 +25,7 @@
 #include "Banner.h"
 #include "BattlegroundMgr.h"
 #include "BigNumber.h"
+#include "CharacterCache.h"
 #include "CliRunnable.h"
 #include "Common.h"
 #include "Config.h"
@@ -315,6 +316,8 @@ int main(int argc, char** argv)
         sOutdoorPvPMgr->Die();                     // unload it before MapMgr
         sMapMgr->UnloadAll();                      // unload all grids (including locked in memory)
 
+        sCharacterCache->SaveSnapshot();           // every player was saved, the databases are still open
+
         sScriptMgr->OnAfterUnloadAllMaps();
     });
 
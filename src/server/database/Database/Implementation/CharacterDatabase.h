@@ -99,6 +99,7 @@ enum CharacterDatabaseStatements : uint32
     CHAR_SEL_CHARACTER_QUESTSTATUSREW,
     CHAR_SEL_ACCOUNT_INSTANCELOCKTIMES,
     CHAR_SEL_MAILITEMS,
+    CHAR_SEL_MAILITEMS_INFO,
     CHAR_SEL_BREW_OF_THE_MONTH,
     CHAR_REP_BREW_OF_THE_MONTH,
     CHAR_SEL_AUCTION_ITEMS,
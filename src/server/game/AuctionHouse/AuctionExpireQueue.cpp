@@ -0,0 +1,45 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "AuctionExpireQueue.h"
+#include "AuctionHouseMgr.h"
+
+void AuctionExpireQueue::Add(AuctionEntry const* auction)
+{
+    _queue.emplace(auction->expire_time, auction->Id);
+}
+
+AuctionEntry* AuctionExpireQueue::PopExpired(AuctionEntryMap const& auctions, time_t checkTime)
+{
+    while (!_queue.empty() && _queue.top().first <= checkTime)
+    {
+        AuctionEntryMap::const_iterator itr = auctions.find(_queue.top().second);
+        _queue.pop();
+
+        if (itr == auctions.end())
+            continue;
+
+        AuctionEntry* auction = itr->second;
+        if (auction->expire_time <= checkTime)
+            return auction;
+
+        // Expire time changed after the auction was added
+        Add(auction);
+    }
+
+    return nullptr;
+}
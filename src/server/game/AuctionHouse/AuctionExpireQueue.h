@@ -0,0 +1,51 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _AUCTION_EXPIRE_QUEUE_H
+#define _AUCTION_EXPIRE_QUEUE_H
+
+#include "Define.h"
+#include <ctime>
+#include <map>
+#include <queue>
+#include <vector>
+
+struct AuctionEntry;
+
+/*
+ * Min-heap of expire time and auction id of an auction house. Removed auctions are not searched for in it,
+ * their entries are dropped when they reach the top.
+ */
+class AuctionExpireQueue
+{
+public:
+    typedef std::map<uint32, AuctionEntry*> AuctionEntryMap;
+
+    void Add(AuctionEntry const* auction);
+    /// Takes the auction expiring first out of the queue if it is due by checkTime, nullptr otherwise.
+    /// Entries of removed auctions are dropped and auctions whose expire time changed are queued again on the way.
+    AuctionEntry* PopExpired(AuctionEntryMap const& auctions, time_t checkTime);
+
+    [[nodiscard]] std::size_t GetSize() const { return _queue.size(); }
+
+private:
+    typedef std::pair<time_t, uint32> Entry;
+
+    std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> _queue;
+};
+
+#endif
@@ -29,6 +29,7 @@
 #include "UpdateTime.h"
 #include "World.h"
 #include "WorldPacket.h"
+#include <array>
 #include <vector>
 
 constexpr auto AH_MINIMUM_DEPOSIT = 100;
@@ -216,20 +217,20 @@ void AuctionHouseMgr::SendAuctionSuccessfulMail(AuctionEntry* auction, Character
             .AddMoney(profit)
             .SendMailTo(trans, MailReceiver(owner, auction->owner.GetCounter()), auction, MAIL_CHECK_MASK_COPIED, sWorld->getIntConfig(CONFIG_MAIL_DELIVERY_DELAY));
 
-        CharacterCacheEntry const* sellerCache = sCharacterCache->GetCharacterCacheByGuid(auction->owner);
-        CharacterCacheEntry const* bidderCache = sCharacterCache->GetCharacterCacheByGuid(auction->bidder);
+        Optional<CharacterCacheEntry> sellerCache = sCharacterCache->GetCharacterCacheByGuid(auction->owner);
+        Optional<CharacterCacheEntry> bidderCache = sCharacterCache->GetCharacterCacheByGuid(auction->bidder);
         LOG_INFO("entities.player.auctionhouse", "AuctionHouse: Auction #{} sold: Seller {} (AccountID: {}, GUID: {}), Buyer: {} (AccountID: {}, GUID: {}), Item (Entry: {}) x{}, Sale Price: {} copper, Profit: {} copper (cut: {} copper)",
             auction->Id, sellerCache ? sellerCache->Name : (owner ? owner->GetName() : "offline"), sellerCache ? sellerCache->AccountId : owner_accId, auction->owner.GetCounter(),
             bidderCache ? bidderCache->Name : "unknown", bidderCache ? bidderCache->AccountId : 0, auction->bidder.GetCounter(), auction->item_template, auction->itemCount,
             auction->bid, profit, auction->GetAuctionCut());
 
         if (auction->bid >= 500 * GOLD)
-            if (CharacterCacheEntry const* gpd = sCharacterCache->GetCharacterCacheByGuid(auction->bidder))
+            if (Optional<CharacterCacheEntry> gpd = sCharacterCache->GetCharacterCacheByGuid(auction->bidder))
             {
                 Player* bidder = ObjectAccessor::FindConnectedPlayer(auction->bidder);
                 std::string owner_name = "";
                 uint8 owner_level = 0;
-                if (CharacterCacheEntry const* gpd_owner = sCharacterCache->GetCharacterCacheByGuid(auction->owner))
+                if (Optional<CharacterCacheEntry> gpd_owner = sCharacterCache->GetCharacterCacheByGuid(auction->owner))
                 {
                     owner_name = gpd_owner->Name;
                     owner_level = gpd_owner->Level;
@@ -445,16 +446,35 @@ void AuctionHouseMgr::Update(uint32 const diff)
     {
         sScriptMgr->OnBeforeAuctionHouseMgrUpdate();
 
-        _hordeAuctions.Update();
-        _allianceAuctions.Update();
-        _neutralAuctions.Update();
-
         _updateIntervalTimer.Reset();
     }
 
     _auctionHouseSearcher->Update();
 }
 
+bool AuctionHouseMgr::UpdateExpiredAuctions(TimePoint deadline)
+{
+    time_t const checkTime = GameTime::GetGameTime().count();
+    deadline = std::min(deadline, std::chrono::steady_clock::now() + Milliseconds(sWorld->getIntConfig(CONFIG_AUCTIONHOUSE_EXPIRE_UPDATE_BUDGET)));
+
+    std::array<AuctionHouseObject*, MAX_AUCTION_HOUSE_FACTIONS> const auctionHouses = { &_hordeAuctions, &_allianceAuctions, &_neutralAuctions };
+
+    // Whatever is left when the budget runs out is handled in the next ticks
+    CharacterDatabaseTransaction trans;
+    bool const done = ExpireAuctions(auctionHouses, checkTime, deadline, [&trans](AuctionHouseObject* auctionHouse, AuctionEntry* auction)
+    {
+        if (!trans)
+            trans = CharacterDatabase.BeginTransaction();
+
+        auctionHouse->ExpireAuction(auction, trans);
+    });
+
+    if (trans)
+        CharacterDatabase.CommitTransaction(trans);
+
+    return done;
+}
+
 AuctionHouseFaction AuctionHouseMgr::GetAuctionHouseFactionFromHouseId(AuctionHouseId ahHouseId)
 {
     switch (ahHouseId)
@@ -496,6 +516,7 @@ void AuctionHouseObject::AddAuction(AuctionEntry* auction)
     ASSERT(auction);
 
     _auctionsMap[auction->Id] = auction;
+    _expireQueue.Add(auction);
     sAuctionMgr->GetAuctionHouseSearcher()->AddAuction(auction);
 
     sScriptMgr->OnAuctionAdd(this, auction);
@@ -515,49 +536,30 @@ bool AuctionHouseObject::RemoveAuction(AuctionEntry* auction)
     return wasInMap;
 }
 
-void AuctionHouseObject::Update()
+void AuctionHouseObject::ExpireAuction(AuctionEntry* auction, CharacterDatabaseTransaction trans)
 {
-    time_t checkTime = GameTime::GetGameTime().count() + 60;
-    ///- Handle expired auctions
-
-    // If storage is empty, no need to update. next == nullptr in this case.
-    if (_auctionsMap.empty())
-        return;
-
-    CharacterDatabaseTransaction trans = CharacterDatabase.BeginTransaction();
-
-    for (AuctionEntryMap::iterator itr, iter = _auctionsMap.begin(); iter != _auctionsMap.end(); )
+    ///- Either cancel the auction if there was no bidder
+    if (!auction->bidder)
     {
-        itr = iter++;
-        AuctionEntry* auction = (*itr).second;
-
-        if (auction->expire_time > checkTime)
-            continue;
-
-        ///- Either cancel the auction if there was no bidder
-        if (!auction->bidder)
-        {
-            sAuctionMgr->SendAuctionExpiredMail(auction, trans);
-            sScriptMgr->OnAuctionExpire(this, auction);
-        }
-        ///- Or perform the transaction
-        else
-        {
-            //we should send an "item sold" message if the seller is online
-            //we send the item to the winner
-            //we send the money to the seller
-            sAuctionMgr->SendAuctionSuccessfulMail(auction, trans);
-            sAuctionMgr->SendAuctionWonMail(auction, trans);
-            sScriptMgr->OnAuctionSuccessful(this, auction);
-        }
+        sAuctionMgr->SendAuctionExpiredMail(auction, trans);
+        sScriptMgr->OnAuctionExpire(this, auction);
+    }
+    ///- Or perform the transaction
+    else
+    {
+        //we should send an "item sold" message if the seller is online
+        //we send the item to the winner
+        //we send the money to the seller
+        sAuctionMgr->SendAuctionSuccessfulMail(auction, trans);
+        sAuctionMgr->SendAuctionWonMail(auction, trans);
+        sScriptMgr->OnAuctionSuccessful(this, auction);
+    }
 
-        ///- In any case clear the auction
-        auction->DeleteFromDB(trans);
+    ///- In any case clear the auction
+    auction->DeleteFromDB(trans);
 
-        sAuctionMgr->RemoveAItem(auction->item_guid);
-        RemoveAuction(auction);
-    }
-    CharacterDatabase.CommitTransaction(trans);
+    sAuctionMgr->RemoveAItem(auction->item_guid);
+    RemoveAuction(auction);
 }
 
 AuctionHouseFaction AuctionEntry::GetFactionId() const
@@ -18,6 +18,7 @@
 #ifndef _AUCTION_HOUSE_MGR_H
 #define _AUCTION_HOUSE_MGR_H
 
+#include "AuctionExpireQueue.h"
 #include "Common.h"
 #include "DBCStructure.h"
 #include "DatabaseEnv.h"
@@ -25,6 +26,7 @@
 #include "ObjectGuid.h"
 #include "Timer.h"
 #include "WorldPacket.h"
+#include <array>
 #include <unordered_map>
 
 class Item;
@@ -127,7 +129,7 @@ class AuctionHouseObject
 {
 public:
     // Initialize storage
-    AuctionHouseObject() { _next = _auctionsMap.begin(); }
+    AuctionHouseObject() = default;
     ~AuctionHouseObject()
     {
         for (auto& itr : _auctionsMap)
@@ -152,13 +154,14 @@ public:
 
     bool RemoveAuction(AuctionEntry* auction);
 
-    void Update();
+    /// The auction expiring first if it is due by checkTime, nullptr otherwise. It is not in the expire queue anymore
+    AuctionEntry* PopExpiredAuction(time_t checkTime) { return _expireQueue.PopExpired(_auctionsMap, checkTime); }
+    /// Sends the mails of an auction PopExpiredAuction returned and removes it
+    void ExpireAuction(AuctionEntry* auction, CharacterDatabaseTransaction trans);
 
 private:
     AuctionEntryMap _auctionsMap;
-
-    // storage for "next" auction item for next Update()
-    AuctionEntryMap::const_iterator _next;
+    AuctionExpireQueue _expireQueue;
 };
 
 class AuctionHouseMgr
@@ -208,8 +211,33 @@ public:
     bool RemoveAItem(ObjectGuid itemGuid, bool deleteFromDB = false, CharacterDatabaseTransaction* trans = nullptr);
 
     void Update(uint32 const diff);
+    /// Stops at the deadline or after AuctionHouse.ExpireUpdateBudget, whichever comes first. False when expired auctions are left for the next update
+    bool UpdateExpiredAuctions(TimePoint deadline);
+
+    /// Expires one auction per house at a time, so a backlog in one house does not hold back the others.
+    /// Goes on until no auction is due or the deadline passed, false when expired auctions may be left.
+    template<class House, std::size_t Count, class Expire>
+    static bool ExpireAuctions(std::array<House*, Count> const& houses, time_t checkTime, TimePoint deadline, Expire&& expire)
+    {
+        bool expired;
+        do
+        {
+            expired = false;
+            for (House* house : houses)
+            {
+                if (AuctionEntry* auction = house->PopExpiredAuction(checkTime))
+                {
+                    expire(house, auction);
+                    expired = true;
+                }
+            }
+        } while (expired && std::chrono::steady_clock::now() < deadline);
+
+        return !expired;
+    }
 
 private:
+
     AuctionHouseObject _hordeAuctions;
     AuctionHouseObject _allianceAuctions;
     AuctionHouseObject _neutralAuctions;
@@ -164,6 +164,8 @@ bool Battlefield::Update(uint32 diff)
 {
     if (Timer <= diff)
     {
+        // May run on a map thread (MapUpdate.PvP), sessions are only added and removed by the world thread
+        // before the maps are updated, so the count does not change while it is read here
         uint32 sessionLimit = sWorld->getIntConfig(CONFIG_WINTERGRASP_SKIP_BATTLE_SESSION_COUNT);
         bool tooManySessions = sessionLimit && !IsWarTime()
             && sWorldSessionMgr->GetActiveSessionCount() > sessionLimit;
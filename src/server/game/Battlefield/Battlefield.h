@@ -232,6 +232,7 @@ public:
 
     uint32 GetTypeId() const { return TypeId; }
     uint32 GetZoneId() const { return ZoneId; }
+    uint32 GetMapId() const { return MapId; }
 
     void TeamApplyBuff(TeamId team, uint32 spellId, uint32 spellId2 = 0);
 
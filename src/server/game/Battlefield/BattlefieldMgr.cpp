@@ -16,6 +16,7 @@
  */
 
 #include "BattlefieldMgr.h"
+#include "MapMgr.h"
 #include "Player.h"
 #include "ScriptMgr.h"
 #include "Zones/BattlefieldWG.h"
@@ -55,6 +56,10 @@ void BattlefieldMgr::InitBattlefield()
     else
     {
         _battlefieldSet.push_back(bf);
+
+        // the continent updates it with MapUpdate.PvP, base maps are never unloaded
+        sMapMgr->CreateBaseMap(bf->GetMapId());
+        _battlefieldsByMap[bf->GetMapId()].Battlefields.push_back(bf);
         LOG_INFO("server.loading", "Battlefield: Wintergrasp successfully initiated.");
         LOG_INFO("server.loading", " ");
     }
@@ -124,12 +129,30 @@ void BattlefieldMgr::Update(uint32 diff)
     _updateTimer += diff;
     if (_updateTimer > BATTLEFIELD_OBJECTIVE_UPDATE_INTERVAL)
     {
-        for (Battlefield* bf : _battlefieldSet)
-            bf->Update(_updateTimer);
+        // updated by the map thread of their continent instead
+        if (!sWorld->getBoolConfig(CONFIG_MAP_PVP_UPDATE))
+            for (Battlefield* bf : _battlefieldSet)
+                bf->Update(_updateTimer);
         _updateTimer = 0;
     }
 }
 
+void BattlefieldMgr::UpdateMap(Map* map, uint32 diff)
+{
+    auto itr = _battlefieldsByMap.find(map->GetId());
+    if (itr == _battlefieldsByMap.end())
+        return;
+
+    MapBattlefields& mapBattlefields = itr->second;
+    mapBattlefields.UpdateTimer += diff;
+    if (mapBattlefields.UpdateTimer > BATTLEFIELD_OBJECTIVE_UPDATE_INTERVAL)
+    {
+        for (Battlefield* bf : mapBattlefields.Battlefields)
+            bf->Update(mapBattlefields.UpdateTimer);
+        mapBattlefields.UpdateTimer = 0;
+    }
+}
+
 ZoneScript* BattlefieldMgr::GetZoneScript(uint32 zoneId)
 {
     auto itr = _battlefieldMap.find(zoneId);
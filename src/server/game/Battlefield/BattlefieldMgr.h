@@ -56,6 +56,9 @@ public:
 
     void Update(uint32 diff);
 
+    // called by the map thread of a continent with MapUpdate.PvP
+    void UpdateMap(Map* map, uint32 diff);
+
     void HandleGossipOption(Player* player, ObjectGuid guid, uint32 gossipId);
 
     bool CanTalkTo(Player* player, Creature* creature, GossipMenuItems gso);
@@ -74,6 +77,15 @@ private:
     BattlefieldMap _battlefieldMap;
     // update interval
     uint32 _updateTimer;
+
+    // battlefields of each continent, filled on init so every map thread only touches its own entry
+    struct MapBattlefields
+    {
+        BattlefieldSet Battlefields;
+        uint32 UpdateTimer = 0;
+    };
+
+    std::unordered_map<uint32 /*mapid*/, MapBattlefields> _battlefieldsByMap;
 };
 
 #define sBattlefieldMgr BattlefieldMgr::instance()
@@ -0,0 +1,162 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "ArenaQueueIndex.h"
+#include "BattlegroundQueue.h"
+#include "Errors.h"
+#include <algorithm>
+
+static_assert(ArenaQueueIndex::RATING_LEAVES == 1 << 10, "the leaf has to fit in the low bits of a key");
+
+ArenaQueueIndex::ArenaQueueIndex() : _nextJoinOrder(0) { }
+
+uint32 ArenaQueueIndex::GetLeaf(uint32 rating)
+{
+    return std::min(rating / RATING_PER_LEAF, RATING_LEAVES - 1);
+}
+
+void ArenaQueueIndex::Add(GroupQueueInfo* ginfo, QueueIterator itr)
+{
+    if (_tree.empty())
+    {
+        _tree.assign(2 * RATING_LEAVES, NO_KEY);
+        _leaves.resize(RATING_LEAVES);
+    }
+
+    uint64 const key = (_nextJoinOrder++ << LEAF_BITS) | GetLeaf(ginfo->ArenaMatchmakerRating);
+    if (!_entries.emplace(ginfo, Entry{ key, itr }).second)
+        return;
+
+    Link(key, ginfo);
+}
+
+void ArenaQueueIndex::Remove(GroupQueueInfo const* ginfo)
+{
+    auto itr = _entries.find(ginfo);
+    if (itr == _entries.end())
+        return;
+
+    Unlink(itr->second.Key);
+    _entries.erase(itr);
+}
+
+bool ArenaQueueIndex::FindFirst(uint32 minRating, uint32 maxRating, int32 discardTime, Filter const& accept, QueueIterator& result)
+{
+    if (_entries.empty())
+        return false;
+
+    // Teams refused by accept are taken out until the search is done
+    std::vector<std::pair<uint64, GroupQueueInfo*>> refused;
+    bool found = false;
+
+    while (!found && _tree[1] != NO_KEY)
+    {
+        // Teams join in order: if the oldest team did not wait longer than the discard time, no team did
+        uint64 key = _tree[1];
+        GroupQueueInfo* ginfo = GetTeam(key);
+        if (int32(ginfo->JoinTime) >= discardTime)
+        {
+            if (minRating > maxRating)
+                break;
+
+            key = GetMinKey(GetLeaf(minRating), GetLeaf(maxRating));
+            if (key == NO_KEY)
+                break;
+
+            ginfo = GetTeam(key);
+
+            // the first and last leaves may hold ratings out of the range
+            if (ginfo->ArenaMatchmakerRating < minRating || ginfo->ArenaMatchmakerRating > maxRating)
+            {
+                refused.emplace_back(key, Unlink(key));
+                continue;
+            }
+        }
+
+        // invited teams are not queued for a new match anymore
+        if (ginfo->IsInvitedToBGInstanceGUID)
+        {
+            Remove(ginfo);
+            continue;
+        }
+
+        if (accept && !accept(ginfo))
+        {
+            refused.emplace_back(key, Unlink(key));
+            continue;
+        }
+
+        result = _entries[ginfo].Itr;
+        found = true;
+    }
+
+    for (auto const& [key, ginfo] : refused)
+        Link(key, ginfo);
+
+    return found;
+}
+
+GroupQueueInfo* ArenaQueueIndex::GetTeam(uint64 key) const
+{
+    std::map<uint64, GroupQueueInfo*> const& leaf = _leaves[key & (RATING_LEAVES - 1)];
+    ASSERT(!leaf.empty());
+    return leaf.begin()->second;
+}
+
+void ArenaQueueIndex::Link(uint64 key, GroupQueueInfo* ginfo)
+{
+    uint32 const leaf = key & (RATING_LEAVES - 1);
+    _leaves[leaf].emplace(key, ginfo);
+    UpdateLeaf(leaf);
+}
+
+GroupQueueInfo* ArenaQueueIndex::Unlink(uint64 key)
+{
+    uint32 const leaf = key & (RATING_LEAVES - 1);
+    auto itr = _leaves[leaf].find(key);
+    ASSERT(itr != _leaves[leaf].end());
+
+    GroupQueueInfo* ginfo = itr->second;
+    _leaves[leaf].erase(itr);
+
+    UpdateLeaf(leaf);
+    return ginfo;
+}
+
+void ArenaQueueIndex::UpdateLeaf(uint32 leaf)
+{
+    uint32 node = RATING_LEAVES + leaf;
+    _tree[node] = !_leaves[leaf].empty() ? _leaves[leaf].begin()->first : NO_KEY;
+
+    for (node /= 2; node >= 1; node /= 2)
+        _tree[node] = std::min(_tree[2 * node], _tree[2 * node + 1]);
+}
+
+uint64 ArenaQueueIndex::GetMinKey(uint32 firstLeaf, uint32 lastLeaf) const
+{
+    uint64 key = NO_KEY;
+    for (uint32 first = firstLeaf + RATING_LEAVES, last = lastLeaf + RATING_LEAVES + 1; first < last; first /= 2, last /= 2)
+    {
+        if (first & 1)
+            key = std::min(key, _tree[first++]);
+
+        if (last & 1)
+            key = std::min(key, _tree[--last]);
+    }
+
+    return key;
+}
@@ -0,0 +1,90 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef __ARENAQUEUEINDEX_H
+#define __ARENAQUEUEINDEX_H
+
+#include "Define.h"
+#include <functional>
+#include <list>
+#include <memory>
+#include <map>
+#include <unordered_map>
+#include <vector>
+
+struct GroupQueueInfo;
+
+/*
+    Rated arena teams of one queue list indexed by matchmaker rating.
+
+    A min segment tree over rating buckets holds the join order of the oldest team of each bucket,
+    so the oldest team within a rating range is found in O(log) instead of walking the queue list.
+    Only teams not invited yet are indexed.
+*/
+class ArenaQueueIndex
+{
+public:
+    typedef std::list<GroupQueueInfo*>::iterator QueueIterator;
+    typedef std::function<bool(GroupQueueInfo const*)> Filter;
+
+    // Leaves of RATING_PER_LEAF rating points, higher ratings share the last one
+    static constexpr uint32 RATING_LEAVES = 1024;
+    static constexpr uint32 RATING_PER_LEAF = 4;
+
+    ArenaQueueIndex();
+
+    // itr is the position of ginfo in its queue list, which has to stay valid while it is indexed
+    void Add(GroupQueueInfo* ginfo, QueueIterator itr);
+    void Remove(GroupQueueInfo const* ginfo);
+
+    /*
+        Same team as the first match of a walk over the queue list in join order, checking
+        (rating in [minRating, maxRating] || JoinTime < discardTime) && accept(team).
+        Returns false if there is none.
+    */
+    bool FindFirst(uint32 minRating, uint32 maxRating, int32 discardTime, Filter const& accept, QueueIterator& result);
+
+    [[nodiscard]] bool Empty() const { return _entries.empty(); }
+    [[nodiscard]] std::size_t Size() const { return _entries.size(); }
+
+private:
+    struct Entry
+    {
+        uint64 Key;                                         // join order << LEAF_BITS | leaf
+        QueueIterator Itr;
+    };
+
+    static constexpr uint32 LEAF_BITS = 10;
+    static constexpr uint64 NO_KEY = ~uint64(0);
+
+    static uint32 GetLeaf(uint32 rating);
+
+    void Link(uint64 key, GroupQueueInfo* ginfo);
+    GroupQueueInfo* Unlink(uint64 key);
+    [[nodiscard]] GroupQueueInfo* GetTeam(uint64 key) const;
+    void UpdateLeaf(uint32 leaf);
+    [[nodiscard]] uint64 GetMinKey(uint32 firstLeaf, uint32 lastLeaf) const;
+
+    uint64 _nextJoinOrder;
+    std::unordered_map<GroupQueueInfo const*, Entry> _entries;
+
+    // Allocated with the first team, most brackets never see a rated team
+    std::vector<uint64> _tree;
+    std::vector<std::map<uint64, GroupQueueInfo*>> _leaves;
+};
+
+#endif
@@ -841,14 +841,7 @@ void Battleground::EndBattleground(PvPTeamId winnerTeamId)
     uint64 battlegroundId = 1;
     if (isBattleground() && sWorld->getBoolConfig(CONFIG_BATTLEGROUND_STORE_STATISTICS_ENABLE))
     {
-        stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_PVPSTATS_MAXID);
-        PreparedQueryResult result = CharacterDatabase.Query(stmt);
-
-        if (result)
-        {
-            Field* fields = result->Fetch();
-            battlegroundId = fields[0].Get<uint64>() + 1;
-        }
+        battlegroundId = sBattlegroundMgr->GeneratePvPStatsBattlegroundId();
 
         stmt = CharacterDatabase.GetPreparedStatement(CHAR_INS_PVPSTATS_BATTLEGROUND);
         stmt->SetData(0, battlegroundId);
@@ -63,6 +63,7 @@ bool BattlegroundTemplate::IsArena() const
 BattlegroundMgr::BattlegroundMgr() :
     m_ArenaTesting(sWorld->getBoolConfig(CONFIG_DEBUG_ARENA)),
     m_Testing(sWorld->getBoolConfig(CONFIG_DEBUG_BATTLEGROUND)),
+    m_NextPvPStatsBattlegroundId(1),
     m_NextAutoDistributionTime(0),
     m_AutoDistributionTimeChecker(0),
     m_NextPeriodicQueueUpdateTime(5 * IN_MILLISECONDS)
@@ -111,7 +112,10 @@ void BattlegroundMgr::Update(uint32 diff)
             itrDelete = itr++;
             Battleground* bg = itrDelete->second;
 
-            bg->Update(diff);
+            // with MapUpdate.PvP the map thread of the battleground updated it already
+            if (!bg->GetBgMap() || !sWorld->getBoolConfig(CONFIG_MAP_PVP_UPDATE))
+                bg->Update(diff);
+
             if (bg->ToBeDeleted())
             {
                 itrDelete->second = nullptr;
@@ -131,11 +135,14 @@ void BattlegroundMgr::Update(uint32 diff)
         m_BattlegroundQueues[qtype].UpdateEvents(diff);
 
     // update using scheduled tasks (used only for rated arenas, initial opponent search works differently than periodic queue update)
-    if (!m_QueueUpdateScheduler.empty())
+    std::vector<uint64> scheduled;
     {
-        std::vector<uint64> scheduled;
+        std::lock_guard<std::mutex> guard(m_QueueUpdateSchedulerLock);
         std::swap(scheduled, m_QueueUpdateScheduler);
+    }
 
+    if (!scheduled.empty())
+    {
         for (uint8 i = 0; i < scheduled.size(); i++)
         {
             uint32 arenaMMRating = scheduled[i] >> 32;
@@ -581,6 +588,14 @@ void BattlegroundMgr::InitAutomaticArenaPointDistribution()
     LOG_INFO("server.loading", "Automatic Arena Point Distribution initialized.");
 }
 
+void BattlegroundMgr::InitPvPStatsBattlegroundIds()
+{
+    // Seeded even with the statistics disabled, Battleground.StoreStatistics.Enable can be turned on by a reload
+    CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_PVPSTATS_MAXID);
+    if (PreparedQueryResult result = CharacterDatabase.Query(stmt))
+        m_NextPvPStatsBattlegroundId = result->Fetch()[0].Get<uint64>() + 1;
+}
+
 void BattlegroundMgr::BuildBattlegroundListPacket(WorldPacket* data, ObjectGuid guid, Player* player, BattlegroundTypeId bgTypeId, uint8 fromWhere)
 {
     if (!player)
@@ -771,9 +786,10 @@ void BattlegroundMgr::SetHolidayWeekends(uint32 mask)
 
 void BattlegroundMgr::ScheduleQueueUpdate(uint32 arenaMatchmakerRating, uint8 arenaType, BattlegroundQueueTypeId bgQueueTypeId, BattlegroundTypeId bgTypeId, BattlegroundBracketId bracket_id)
 {
-    //This method must be atomic, @todo add mutex
     //we will use only 1 number created of bgTypeId and bracket_id
     uint64 const scheduleId = ((uint64)arenaMatchmakerRating << 32) | ((uint64)arenaType << 24) | ((uint64)bgQueueTypeId << 16) | ((uint64)bgTypeId << 8) | (uint64)bracket_id;
+
+    std::lock_guard<std::mutex> guard(m_QueueUpdateSchedulerLock);
     if (std::find(m_QueueUpdateScheduler.begin(), m_QueueUpdateScheduler.end(), scheduleId) == m_QueueUpdateScheduler.end())
         m_QueueUpdateScheduler.emplace_back(scheduleId);
 }
@@ -948,11 +964,13 @@ BGFreeSlotQueueContainer& BattlegroundMgr::GetBGFreeSlotQueueStore(BattlegroundT
 
 void BattlegroundMgr::AddToBGFreeSlotQueue(BattlegroundTypeId bgTypeId, Battleground* bg)
 {
+    std::lock_guard<std::mutex> guard(m_BGFreeSlotQueueLock);
     bgDataStore[bgTypeId].BGFreeSlotQueue.push_back(bg);
 }
 
 void BattlegroundMgr::RemoveFromBGFreeSlotQueue(BattlegroundTypeId bgTypeId, uint32 instanceId)
 {
+    std::lock_guard<std::mutex> guard(m_BGFreeSlotQueueLock);
     BGFreeSlotQueueContainer& queues = bgDataStore[bgTypeId].BGFreeSlotQueue;
     for (BGFreeSlotQueueContainer::iterator itr = queues.begin(); itr != queues.end(); ++itr)
         if ((*itr)->GetInstanceID() == instanceId)
@@ -22,6 +22,8 @@
 #include "BattlegroundQueue.h"
 #include "CreatureAIImpl.h"
 #include "DBCEnums.h"
+#include <atomic>
+#include <mutex>
 #include <unordered_map>
 
 typedef std::map<uint32, Battleground*> BattlegroundContainer;
@@ -123,6 +125,9 @@ public:
     uint32 GetMaxRatingDifference() const;
     uint32 GetRatingDiscardTimer() const;
     void InitAutomaticArenaPointDistribution();
+    void InitPvPStatsBattlegroundIds();
+    // Battlegrounds may end concurrently on their map threads (MapUpdate.PvP), ids are handed out atomically
+    uint64 GeneratePvPStatsBattlegroundId() { return m_NextPvPStatsBattlegroundId++; }
     void LoadBattleMastersEntry();
     void CheckBattleMasters();
 
@@ -153,7 +158,12 @@ private:
 
     BattlegroundQueue m_BattlegroundQueues[MAX_BATTLEGROUND_QUEUE_TYPES];
 
+    // Battlegrounds leaving players on map threads (MapUpdate.PvP) only collect the queue changes,
+    // the queues themselves are updated by the world thread
+    std::mutex m_QueueUpdateSchedulerLock;
     std::vector<uint64> m_QueueUpdateScheduler;
+    std::mutex m_BGFreeSlotQueueLock;
+    std::atomic<uint64> m_NextPvPStatsBattlegroundId;
     bool   m_ArenaTesting;
     bool   m_Testing;
     Seconds m_NextAutoDistributionTime;
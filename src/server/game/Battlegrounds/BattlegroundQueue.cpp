@@ -193,6 +193,9 @@ GroupQueueInfo* BattlegroundQueue::AddGroup(Player* leader, Group* group, Battle
     //add GroupInfo to m_QueuedGroups
     m_QueuedGroups[bracketId][index].push_back(ginfo);
 
+    if (isRated && arenaType && index < BG_QUEUE_NORMAL_ALLIANCE)
+        m_RatedArenaIndex[bracketId][index].Add(ginfo, std::prev(m_QueuedGroups[bracketId][index].end()));
+
     // announce world (this doesn't need mutex)
     SendJoinMessageArenaQueue(leader, ginfo, bracketEntry, isRated);
 
@@ -353,6 +356,9 @@ void BattlegroundQueue::RemovePlayer(ObjectGuid guid, bool decreaseInvitedCount)
     // remove group queue info no players left
     if (groupInfo->Players.empty())
     {
+        if (_groupType < BG_QUEUE_NORMAL_ALLIANCE)
+            m_RatedArenaIndex[_bracketId][_groupType].Remove(groupInfo);
+
         m_QueuedGroups[_bracketId][_groupType].erase(group_itr);
         delete groupInfo;
         return;
@@ -957,19 +963,11 @@ void BattlegroundQueue::BattlegroundQueueUpdate(uint32 diff, BattlegroundTypeId
 
         for (uint8 i = BG_QUEUE_PREMADE_ALLIANCE; i < BG_QUEUE_NORMAL_ALLIANCE; i++)
         {
-            // take the group that joined first
-            GroupsQueueType::iterator itr2 = m_QueuedGroups[bracket_id][i].begin();
-            for (; itr2 != m_QueuedGroups[bracket_id][i].end(); ++itr2)
+            // take the group that joined first, with a rating in range or a discarded one
+            if (m_RatedArenaIndex[bracket_id][i].FindFirst(arenaMinRating, arenaMaxRating, discardTime, nullptr, itr_teams[found]))
             {
-                // if group match conditions, then add it to pool
-                if (!(*itr2)->IsInvitedToBGInstanceGUID
-                    && (((*itr2)->ArenaMatchmakerRating >= arenaMinRating && (*itr2)->ArenaMatchmakerRating <= arenaMaxRating)
-                        || (int32)(*itr2)->JoinTime < discardTime))
-                {
-                    itr_teams[found++] = itr2;
-                    team = i;
-                    break;
-                }
+                ++found;
+                team = i;
             }
         }
 
@@ -978,17 +976,16 @@ void BattlegroundQueue::BattlegroundQueueUpdate(uint32 diff, BattlegroundTypeId
 
         if (found == 1)
         {
-            for (GroupsQueueType::iterator itr3 = itr_teams[0]; itr3 != m_QueuedGroups[bracket_id][team].end(); ++itr3)
+            // the next one of the same queue, which did not just play against the first one
+            GroupQueueInfo const* firstTeam = *(itr_teams[0]);
+            auto canPlayAgainst = [firstTeam, discardOpponentsTime](GroupQueueInfo const* ginfo)
             {
-                if (!(*itr3)->IsInvitedToBGInstanceGUID
-                    && (((*itr3)->ArenaMatchmakerRating >= arenaMinRating && (*itr3)->ArenaMatchmakerRating <= arenaMaxRating) || (int32)(*itr3)->JoinTime < discardTime)
-                    && ((*(itr_teams[0]))->ArenaTeamId != (*itr3)->PreviousOpponentsTeamId || ((int32)(*itr3)->JoinTime < discardOpponentsTime))
-                    && (*(itr_teams[0]))->ArenaTeamId != (*itr3)->ArenaTeamId)
-                {
-                    itr_teams[found++] = itr3;
-                    break;
-                }
-            }
+                return (firstTeam->ArenaTeamId != ginfo->PreviousOpponentsTeamId || (int32)ginfo->JoinTime < discardOpponentsTime)
+                    && firstTeam->ArenaTeamId != ginfo->ArenaTeamId;
+            };
+
+            if (m_RatedArenaIndex[bracket_id][team].FindFirst(arenaMinRating, arenaMaxRating, discardTime, canPlayAgainst, itr_teams[found]))
+                ++found;
         }
 
         //if we have 2 teams, then start new arena and invite players!
@@ -1004,6 +1001,10 @@ void BattlegroundQueue::BattlegroundQueueUpdate(uint32 diff, BattlegroundTypeId
                 return;
             }
 
+            // invited below, both teams leave the matchmaking before they may change their queue
+            m_RatedArenaIndex[bracket_id][aTeam->GroupType].Remove(aTeam);
+            m_RatedArenaIndex[bracket_id][hTeam->GroupType].Remove(hTeam);
+
             aTeam->OpponentsTeamRating = hTeam->ArenaTeamRating;
             hTeam->OpponentsTeamRating = aTeam->ArenaTeamRating;
             aTeam->OpponentsMatchmakerRating = hTeam->ArenaMatchmakerRating;
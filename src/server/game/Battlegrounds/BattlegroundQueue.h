@@ -18,6 +18,7 @@
 #ifndef __BATTLEGROUNDQUEUE_H
 #define __BATTLEGROUNDQUEUE_H
 
+#include "ArenaQueueIndex.h"
 #include "Battleground.h"
 #include "DBCEnums.h"
 #include "EventProcessor.h"
@@ -111,6 +112,9 @@ public:
     */
     GroupsQueueType m_QueuedGroups[MAX_BATTLEGROUND_BRACKETS][BG_QUEUE_MAX];
 
+    // rated arena teams of BG_QUEUE_PREMADE_ALLIANCE and BG_QUEUE_PREMADE_HORDE not invited yet, by matchmaker rating
+    ArenaQueueIndex m_RatedArenaIndex[MAX_BATTLEGROUND_BRACKETS][PVP_TEAMS_COUNT];
+
     // class to select and invite groups to bg
     class SelectionPool
     {
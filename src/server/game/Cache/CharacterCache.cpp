@@ -17,6 +17,7 @@
 
 #include "CharacterCache.h"
 #include "ArenaTeam.h"
+#include "CharacterCacheStore.h"
 #include "DatabaseEnv.h"
 #include "Log.h"
 #include "MailMgr.h"
@@ -25,12 +26,42 @@
 #include "World.h"
 #include <algorithm>
 #include <limits>
-#include <unordered_map>
 
 namespace
 {
-    std::unordered_map<ObjectGuid, CharacterCacheEntry> _characterCacheStore;
-    std::unordered_map<std::string, CharacterCacheEntry*> _characterCacheByNameStore;
+    CharacterCacheStore _characterCacheStore;
+
+    static_assert(CharacterCacheStore::ARENA_SLOTS == MAX_ARENA_SLOT);
+
+    // Changes to the characters table made while the server was offline do not match the one stored in the snapshot,
+    // which CharacterCacheStore::GetFingerprint computes from the cached rows with the same formula
+    std::string QueryCharacterFingerprint()
+    {
+        QueryResult result = CharacterDatabase.Query("SELECT CONCAT_WS(':', COUNT(*), COALESCE(MAX(guid), 0), "
+            "COALESCE(BIT_XOR(CRC32(CONCAT_WS(':', guid, name, account, race, gender, class, level))), 0)) FROM characters");
+        return result ? (*result)[0].Get<std::string>() : std::string();
+    }
+
+    CharacterCacheEntry BuildEntry(uint32 row)
+    {
+        CharacterCacheEntry entry;
+        entry.Guid = ObjectGuid::Create<HighGuid::Player>(_characterCacheStore.GetGuid(row));
+        entry.Name = _characterCacheStore.GetName(row);
+        entry.AccountId = _characterCacheStore.GetAccountId(row);
+        entry.Class = _characterCacheStore.GetClass(row);
+        entry.Race = _characterCacheStore.GetRace(row);
+        entry.Sex = _characterCacheStore.GetGender(row);
+        entry.Level = _characterCacheStore.GetLevel(row);
+        entry.MailCount = _characterCacheStore.GetMailCount(row);
+        entry.GuildId = _characterCacheStore.GetGuildId(row);
+        for (uint8 i = 0; i < MAX_ARENA_SLOT; ++i)
+            entry.ArenaTeamId[i] = _characterCacheStore.GetArenaTeamId(row, i);
+
+        if (uint32 groupId = _characterCacheStore.GetGroupId(row))
+            entry.GroupGuid = ObjectGuid::Create<HighGuid::Group>(groupId);
+
+        return entry;
+    }
 }
 
 CharacterCache* CharacterCache::instance()
@@ -48,7 +79,7 @@ CharacterCache* CharacterCache::instance()
 * @return Name, Gender, Race, Class and Level of player character
 * Example Usage:
 * @code
-*    CharacterCacheEntry const* characterInfo = sCharacterCache->GetCharacterCacheByGuid(GUID);
+*    Optional<CharacterCacheEntry> characterInfo = sCharacterCache->GetCharacterCacheByGuid(GUID);
 *    if (!characterInfo)
 *        return;
 *
@@ -62,9 +93,19 @@ CharacterCache* CharacterCache::instance()
 
 void CharacterCache::LoadCharacterCacheStorage()
 {
-    _characterCacheStore.clear();
+    _characterCacheStore.Clear();
     uint32 oldMSTime = getMSTime();
 
+    std::string const snapshotFile(sWorld->getStringConfig(CONFIG_CHARACTER_CACHE_SNAPSHOT));
+    if (!snapshotFile.empty() && _characterCacheStore.LoadSnapshot(snapshotFile, QueryCharacterFingerprint()))
+    {
+        sMailMgr->LoadMailCounts();
+
+        LOG_INFO("server.loading", ">> Loaded Character Infos For {} Characters from snapshot {} in {} ms", _characterCacheStore.GetSize(), snapshotFile, GetMSTimeDiffToNow(oldMSTime));
+        LOG_INFO("server.loading", " ");
+        return;
+    }
+
     QueryResult result = CharacterDatabase.Query("SELECT guid, name, account, race, gender, class, level FROM characters");
     if (!result)
     {
@@ -72,16 +113,20 @@ void CharacterCache::LoadCharacterCacheStorage()
         return;
     }
 
+    _characterCacheStore.BeginBulkLoad(result->GetRowCount());
+
     do
     {
         Field* fields = result->Fetch();
-        AddCharacterCacheEntry(ObjectGuid::Create<HighGuid::Player>(fields[0].Get<uint32>()) /*guid*/, fields[2].Get<uint32>() /*account*/, fields[1].Get<std::string>() /*name*/,
-            fields[4].Get<uint8>() /*gender*/, fields[3].Get<uint8>() /*race*/, fields[5].Get<uint8>() /*class*/, fields[6].Get<uint8>() /*level*/);
+        _characterCacheStore.Add(fields[0].Get<uint32>() /*guid*/, fields[1].Get<std::string_view>() /*name*/, fields[2].Get<uint32>() /*account*/,
+            fields[3].Get<uint8>() /*race*/, fields[4].Get<uint8>() /*gender*/, fields[5].Get<uint8>() /*class*/, fields[6].Get<uint8>() /*level*/);
     } while (result->NextRow());
 
+    _characterCacheStore.EndBulkLoad();
+
     sMailMgr->LoadMailCounts();
 
-    LOG_INFO("server.loading", ">> Loaded Character Infos For {} Characters in {} ms", _characterCacheStore.size(), GetMSTimeDiffToNow(oldMSTime));
+    LOG_INFO("server.loading", ">> Loaded Character Infos For {} Characters in {} ms", _characterCacheStore.GetSize(), GetMSTimeDiffToNow(oldMSTime));
     LOG_INFO("server.loading", " ");
 }
 
@@ -103,136 +148,133 @@ void CharacterCache::RefreshCacheEntry(uint32 lowGuid)
     sMailMgr->RecountMailCount(lowGuid);
 }
 
+void CharacterCache::SaveSnapshot() const
+{
+    std::string const snapshotFile(sWorld->getStringConfig(CONFIG_CHARACTER_CACHE_SNAPSHOT));
+    if (snapshotFile.empty())
+        return;
+
+    uint32 oldMSTime = getMSTime();
+
+    if (!_characterCacheStore.SaveSnapshot(snapshotFile, _characterCacheStore.GetFingerprint()))
+    {
+        LOG_ERROR("server.worldserver", "CharacterCache::SaveSnapshot: could not write {}", snapshotFile);
+        return;
+    }
+
+    LOG_INFO("server.worldserver", "Saved {} characters to the character cache snapshot {} in {} ms", _characterCacheStore.GetSize(), snapshotFile, GetMSTimeDiffToNow(oldMSTime));
+}
+
 /*
 Modifying functions
 */
 void CharacterCache::AddCharacterCacheEntry(ObjectGuid const& guid, uint32 accountId, std::string const& name, uint8 gender, uint8 race, uint8 playerClass, uint8 level)
 {
-    CharacterCacheEntry& data = _characterCacheStore[guid];
-    data.Guid = guid;
-    data.Name = name;
-    data.AccountId = accountId;
-    data.Race = race;
-    data.Sex = gender;
-    data.Class = playerClass;
-    data.Level = level;
-    data.GuildId = 0;                           // Will be set in guild loading or guild setting
-    for (uint8 i = 0; i < MAX_ARENA_SLOT; ++i)
-    {
-        data.ArenaTeamId[i] = 0; // Will be set in arena teams loading
-    }
-
-    // Fill Name to Guid Store
-    _characterCacheByNameStore[name] = &data;
+    // Guild and arena teams will be set in their loading or setting
+    _characterCacheStore.Add(guid.GetCounter(), name, accountId, race, gender, playerClass, level);
 }
 
-void CharacterCache::DeleteCharacterCacheEntry(ObjectGuid const& guid, std::string const& name)
+void CharacterCache::DeleteCharacterCacheEntry(ObjectGuid const& guid, std::string const& /*name*/)
 {
-    _characterCacheStore.erase(guid);
-    _characterCacheByNameStore.erase(name);
+    _characterCacheStore.Remove(guid.GetCounter());
 }
 
 void CharacterCache::UpdateCharacterData(ObjectGuid const& guid, std::string const& name, Optional<uint8> gender /*= {}*/, Optional<uint8> race /*= {}*/)
 {
-    auto itr = _characterCacheStore.find(guid);
-    if (itr == _characterCacheStore.end())
+    uint32 row = _characterCacheStore.FindByGuid(guid.GetCounter());
+    if (row == CharacterCacheStore::NO_ROW)
         return;
 
-    std::string oldName = itr->second.Name;
-    itr->second.Name = name;
+    _characterCacheStore.Rename(row, name);
 
     if (gender)
     {
-        itr->second.Sex = *gender;
+        _characterCacheStore.SetGender(row, *gender);
     }
 
     if (race)
     {
-        itr->second.Race = *race;
+        _characterCacheStore.SetRace(row, *race);
     }
 
     //WorldPackets::Misc::InvalidatePlayer packet(guid);
     //sWorld->SendGlobalMessage(packet.Write());
-
-    // Correct name -> pointer storage
-    _characterCacheByNameStore.erase(oldName);
-    _characterCacheByNameStore[name] = &itr->second;
 }
 
 void CharacterCache::UpdateCharacterLevel(ObjectGuid const& guid, uint8 level)
 {
-    auto itr = _characterCacheStore.find(guid);
-    if (itr == _characterCacheStore.end())
+    uint32 row = _characterCacheStore.FindByGuid(guid.GetCounter());
+    if (row == CharacterCacheStore::NO_ROW)
     {
         return;
     }
 
-    itr->second.Level = level;
+    _characterCacheStore.SetLevel(row, level);
 }
 
 void CharacterCache::UpdateCharacterAccountId(ObjectGuid const& guid, uint32 accountId)
 {
-    auto itr = _characterCacheStore.find(guid);
-    if (itr == _characterCacheStore.end())
+    uint32 row = _characterCacheStore.FindByGuid(guid.GetCounter());
+    if (row == CharacterCacheStore::NO_ROW)
     {
         return;
     }
 
-    itr->second.AccountId = accountId;
+    _characterCacheStore.SetAccountId(row, accountId);
 }
 
 void CharacterCache::UpdateCharacterGuildId(ObjectGuid const& guid, ObjectGuid::LowType guildId)
 {
-    auto itr = _characterCacheStore.find(guid);
-    if (itr == _characterCacheStore.end())
+    uint32 row = _characterCacheStore.FindByGuid(guid.GetCounter());
+    if (row == CharacterCacheStore::NO_ROW)
     {
         return;
     }
 
-    itr->second.GuildId = guildId;
+    _characterCacheStore.SetGuildId(row, guildId);
 }
 
 void CharacterCache::UpdateCharacterArenaTeamId(ObjectGuid const& guid, uint8 slot, uint32 arenaTeamId)
 {
-    auto itr = _characterCacheStore.find(guid);
-    if (itr == _characterCacheStore.end())
+    uint32 row = _characterCacheStore.FindByGuid(guid.GetCounter());
+    if (row == CharacterCacheStore::NO_ROW)
     {
         return;
     }
 
-    itr->second.ArenaTeamId[slot] = arenaTeamId;
+    _characterCacheStore.SetArenaTeamId(row, slot, arenaTeamId);
 }
 
 void CharacterCache::UpdateCharacterMailCount(ObjectGuid const& guid, int32 count, bool update)
 {
-    auto itr = _characterCacheStore.find(guid);
-    if (itr == _characterCacheStore.end())
+    uint32 row = _characterCacheStore.FindByGuid(guid.GetCounter());
+    if (row == CharacterCacheStore::NO_ROW)
         return;
 
     constexpr int32 maxCount = std::numeric_limits<uint16>::max();
 
     if (update)
     {
-        itr->second.MailCount = static_cast<uint16>(std::clamp<int32>(count, 0, maxCount));
+        _characterCacheStore.SetMailCount(row, static_cast<uint16>(std::clamp<int32>(count, 0, maxCount)));
         return;
     }
 
-    int32 newCount = static_cast<int32>(itr->second.MailCount) + count;
+    int32 newCount = static_cast<int32>(_characterCacheStore.GetMailCount(row)) + count;
     if (newCount < 0)
         LOG_WARN("entities.player", "CharacterCache::UpdateCharacterMailCount: mail count for {} would go negative ({}), a mail insert was not reported; clamping to 0", guid.ToString(), newCount);
 
-    itr->second.MailCount = static_cast<uint16>(std::clamp(newCount, 0, maxCount));
+    _characterCacheStore.SetMailCount(row, static_cast<uint16>(std::clamp(newCount, 0, maxCount)));
 }
 
 void CharacterCache::UpdateCharacterGroup(ObjectGuid const& guid, ObjectGuid groupGUID)
 {
-    auto itr = _characterCacheStore.find(guid);
-    if (itr == _characterCacheStore.end())
+    uint32 row = _characterCacheStore.FindByGuid(guid.GetCounter());
+    if (row == CharacterCacheStore::NO_ROW)
     {
         return;
     }
 
-    itr->second.GroupGuid = groupGUID;
+    _characterCacheStore.SetGroupId(row, groupGUID.GetCounter());
 }
 
 /*
@@ -240,37 +282,50 @@ Getters
 */
 bool CharacterCache::HasCharacterCacheEntry(ObjectGuid const& guid) const
 {
-    return _characterCacheStore.find(guid) != _characterCacheStore.end();
+    return _characterCacheStore.FindByGuid(guid.GetCounter()) != CharacterCacheStore::NO_ROW;
 }
 
-CharacterCacheEntry const* CharacterCache::GetCharacterCacheByGuid(ObjectGuid const& guid) const
+Optional<CharacterCacheEntry> CharacterCache::GetCharacterCacheByGuid(ObjectGuid const& guid) const
 {
-    auto itr = _characterCacheStore.find(guid);
-    if (itr != _characterCacheStore.end())
+    uint32 row = _characterCacheStore.FindByGuid(guid.GetCounter());
+    if (row != CharacterCacheStore::NO_ROW)
     {
-        return &itr->second;
+        return BuildEntry(row);
     }
 
-    return nullptr;
+    return {};
 }
 
-CharacterCacheEntry const* CharacterCache::GetCharacterCacheByName(std::string const& name) const
+Optional<CharacterCacheEntry> CharacterCache::GetCharacterCacheByName(std::string const& name) const
 {
-    auto itr = _characterCacheByNameStore.find(name);
-    if (itr != _characterCacheByNameStore.end())
+    uint32 row = _characterCacheStore.FindByName(name);
+    if (row != CharacterCacheStore::NO_ROW)
     {
-        return itr->second;
+        return BuildEntry(row);
     }
 
-    return nullptr;
+    return {};
+}
+
+std::vector<std::string> CharacterCache::GetCharacterNamesByPrefix(std::string_view prefix, std::size_t limit) const
+{
+    std::vector<uint32> rows;
+    _characterCacheStore.FindByNamePrefix(prefix, limit, rows);
+
+    std::vector<std::string> names;
+    names.reserve(rows.size());
+    for (uint32 row : rows)
+        names.emplace_back(_characterCacheStore.GetName(row));
+
+    return names;
 }
 
 ObjectGuid CharacterCache::GetCharacterGuidByName(std::string const& name) const
 {
-    auto itr = _characterCacheByNameStore.find(name);
-    if (itr != _characterCacheByNameStore.end())
+    uint32 row = _characterCacheStore.FindByName(name);
+    if (row != CharacterCacheStore::NO_ROW)
     {
-        return itr->second->Guid;
+        return ObjectGuid::Create<HighGuid::Player>(_characterCacheStore.GetGuid(row));
     }
 
     return ObjectGuid::Empty;
@@ -278,44 +333,44 @@ ObjectGuid CharacterCache::GetCharacterGuidByName(std::string const& name) const
 
 bool CharacterCache::GetCharacterNameByGuid(ObjectGuid guid, std::string& name) const
 {
-    auto itr = _characterCacheStore.find(guid);
-    if (itr == _characterCacheStore.end())
+    uint32 row = _characterCacheStore.FindByGuid(guid.GetCounter());
+    if (row == CharacterCacheStore::NO_ROW)
     {
         return false;
     }
 
-    name = itr->second.Name;
+    name = _characterCacheStore.GetName(row);
     return true;
 }
 
 uint32 CharacterCache::GetCharacterTeamByGuid(ObjectGuid guid) const
 {
-    auto itr = _characterCacheStore.find(guid);
-    if (itr == _characterCacheStore.end())
+    uint32 row = _characterCacheStore.FindByGuid(guid.GetCounter());
+    if (row == CharacterCacheStore::NO_ROW)
     {
         return 0;
     }
 
-    return Player::TeamIdForRace(itr->second.Race);
+    return Player::TeamIdForRace(_characterCacheStore.GetRace(row));
 }
 
 uint32 CharacterCache::GetCharacterAccountIdByGuid(ObjectGuid guid) const
 {
-    auto itr = _characterCacheStore.find(guid);
-    if (itr == _characterCacheStore.end())
+    uint32 row = _characterCacheStore.FindByGuid(guid.GetCounter());
+    if (row == CharacterCacheStore::NO_ROW)
     {
         return 0;
     }
 
-    return itr->second.AccountId;
+    return _characterCacheStore.GetAccountId(row);
 }
 
 uint32 CharacterCache::GetCharacterAccountIdByName(std::string const& name) const
 {
-    auto itr = _characterCacheByNameStore.find(name);
-    if (itr != _characterCacheByNameStore.end())
+    uint32 row = _characterCacheStore.FindByName(name);
+    if (row != CharacterCacheStore::NO_ROW)
     {
-        return itr->second->AccountId;
+        return _characterCacheStore.GetAccountId(row);
     }
 
     return 0;
@@ -323,44 +378,44 @@ uint32 CharacterCache::GetCharacterAccountIdByName(std::string const& name) cons
 
 uint8 CharacterCache::GetCharacterLevelByGuid(ObjectGuid guid) const
 {
-    auto itr = _characterCacheStore.find(guid);
-    if (itr == _characterCacheStore.end())
+    uint32 row = _characterCacheStore.FindByGuid(guid.GetCounter());
+    if (row == CharacterCacheStore::NO_ROW)
     {
         return 0;
     }
 
-    return itr->second.Level;
+    return _characterCacheStore.GetLevel(row);
 }
 
 ObjectGuid::LowType CharacterCache::GetCharacterGuildIdByGuid(ObjectGuid guid) const
 {
-    auto itr = _characterCacheStore.find(guid);
-    if (itr == _characterCacheStore.end())
+    uint32 row = _characterCacheStore.FindByGuid(guid.GetCounter());
+    if (row == CharacterCacheStore::NO_ROW)
     {
         return 0;
     }
 
-    return itr->second.GuildId;
+    return _characterCacheStore.GetGuildId(row);
 }
 
 uint32 CharacterCache::GetCharacterArenaTeamIdByGuid(ObjectGuid guid, uint8 type) const
 {
-    auto itr = _characterCacheStore.find(guid);
-    if (itr == _characterCacheStore.end())
+    uint32 row = _characterCacheStore.FindByGuid(guid.GetCounter());
+    if (row == CharacterCacheStore::NO_ROW)
     {
         return 0;
     }
 
-    return itr->second.ArenaTeamId[type];
+    return _characterCacheStore.GetArenaTeamId(row, type);
 }
 
 ObjectGuid CharacterCache::GetCharacterGroupGuidByGuid(ObjectGuid guid) const
 {
-    auto itr = _characterCacheStore.find(guid);
-    if (itr == _characterCacheStore.end())
+    uint32 row = _characterCacheStore.FindByGuid(guid.GetCounter());
+    if (row == CharacterCacheStore::NO_ROW || !_characterCacheStore.GetGroupId(row))
     {
         return ObjectGuid::Empty;
     }
 
-    return itr->second.GroupGuid;
+    return ObjectGuid::Create<HighGuid::Group>(_characterCacheStore.GetGroupId(row));
 }
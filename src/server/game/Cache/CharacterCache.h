@@ -23,7 +23,9 @@
 #include "ObjectGuid.h"
 #include "Optional.h"
 #include <string>
+#include <vector>
 
+// Copy of the cached columns of a character
 struct CharacterCacheEntry
 {
     ObjectGuid Guid;
@@ -48,6 +50,8 @@ class AC_GAME_API CharacterCache
 
         void LoadCharacterCacheStorage();
         void RefreshCacheEntry(uint32 lowGuid);
+        // Writes the characters of the cache to Startup.CharacterCacheSnapshot, read back by the next LoadCharacterCacheStorage
+        void SaveSnapshot() const;
 
         void AddCharacterCacheEntry(ObjectGuid const& guid, uint32 accountId, std::string const& name, uint8 gender, uint8 race, uint8 playerClass, uint8 level);
         void DeleteCharacterCacheEntry(ObjectGuid const& guid, std::string const& name);
@@ -59,8 +63,10 @@ class AC_GAME_API CharacterCache
         void UpdateCharacterArenaTeamId(ObjectGuid const& guid, uint8 slot, uint32 arenaTeamId);
 
         [[nodiscard]] bool HasCharacterCacheEntry(ObjectGuid const& guid) const;
-        [[nodiscard]] CharacterCacheEntry const* GetCharacterCacheByGuid(ObjectGuid const& guid) const;
-        [[nodiscard]] CharacterCacheEntry const* GetCharacterCacheByName(std::string const& name) const;
+        [[nodiscard]] Optional<CharacterCacheEntry> GetCharacterCacheByGuid(ObjectGuid const& guid) const;
+        [[nodiscard]] Optional<CharacterCacheEntry> GetCharacterCacheByName(std::string const& name) const;
+        // Names starting with the prefix, ignoring the case of ASCII letters, in alphabetical order
+        [[nodiscard]] std::vector<std::string> GetCharacterNamesByPrefix(std::string_view prefix, std::size_t limit) const;
 
         void UpdateCharacterGroup(ObjectGuid const& guid, ObjectGuid groupGUID);
         void ClearCharacterGroup(ObjectGuid const& guid) { UpdateCharacterGroup(guid, ObjectGuid::Empty); };
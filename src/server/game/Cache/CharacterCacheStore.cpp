@@ -0,0 +1,489 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "CharacterCacheStore.h"
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <zlib.h>
+
+namespace
+{
+    constexpr uint32 SNAPSHOT_MAGIC = 0x31534343; // "CCS1"
+    constexpr uint32 SNAPSHOT_VERSION = 1;
+
+    // Only ASCII letters are folded, the names are normalized by the callers anyway
+    inline uint8 FoldCase(char c)
+    {
+        return (c >= 'A' && c <= 'Z') ? uint8(c - 'A' + 'a') : uint8(c);
+    }
+
+    int CompareNames(std::string_view left, std::string_view right)
+    {
+        std::size_t const length = std::min(left.size(), right.size());
+        for (std::size_t i = 0; i < length; ++i)
+        {
+            uint8 const l = FoldCase(left[i]);
+            uint8 const r = FoldCase(right[i]);
+            if (l != r)
+                return l < r ? -1 : 1;
+        }
+
+        if (left.size() == right.size())
+            return 0;
+
+        return left.size() < right.size() ? -1 : 1;
+    }
+
+    bool HasPrefix(std::string_view name, std::string_view prefix)
+    {
+        return name.size() >= prefix.size() && !CompareNames(name.substr(0, prefix.size()), prefix);
+    }
+
+    // First 8 folded bytes of the name, ordered like CompareNames as long as they differ
+    uint64 GetSortKey(std::string_view name)
+    {
+        uint64 key = 0;
+        for (std::size_t i = 0; i < 8; ++i)
+            key = (key << 8) | (i < name.size() ? FoldCase(name[i]) : 0);
+
+        return key;
+    }
+
+    template<class T>
+    void WriteColumn(std::ofstream& stream, std::vector<T> const& column)
+    {
+        stream.write(reinterpret_cast<char const*>(column.data()), column.size() * sizeof(T));
+    }
+
+    template<class T>
+    bool ReadColumn(std::ifstream& stream, std::vector<T>& column, std::size_t size)
+    {
+        column.resize(size);
+        return bool(stream.read(reinterpret_cast<char*>(column.data()), size * sizeof(T)));
+    }
+}
+
+void CharacterCacheStore::Clear()
+{
+    _guids.clear();
+    _nameOffsets.clear();
+    _nameLengths.clear();
+    _infos.clear();
+    _mailCounts.clear();
+    _guildIds.clear();
+    _arenaTeamIds.clear();
+    _groupIds.clear();
+
+    _names.clear();
+    _unusedNameBytes = 0;
+
+    _rowByGuid.clear();
+    _sparseRows.clear();
+    _nameIndex.clear();
+    _bulkLoad = false;
+}
+
+void CharacterCacheStore::BeginBulkLoad(std::size_t expectedRows)
+{
+    _guids.reserve(expectedRows);
+    _nameOffsets.reserve(expectedRows);
+    _nameLengths.reserve(expectedRows);
+    _infos.reserve(expectedRows);
+    _mailCounts.reserve(expectedRows);
+    _guildIds.reserve(expectedRows);
+    _groupIds.reserve(expectedRows);
+    _names.reserve(expectedRows * 8);
+    _nameIndex.reserve(expectedRows);
+
+    _bulkLoad = true;
+}
+
+void CharacterCacheStore::EndBulkLoad()
+{
+    // Comparing the names directly misses the cache on every comparison, most are decided by the first bytes
+    std::vector<std::pair<uint64, uint32>> keys;
+    keys.reserve(_nameIndex.size());
+    for (uint32 row : _nameIndex)
+        keys.emplace_back(GetSortKey(GetName(row)), row);
+
+    std::sort(keys.begin(), keys.end(), [this](std::pair<uint64, uint32> const& left, std::pair<uint64, uint32> const& right)
+    {
+        if (left.first != right.first)
+            return left.first < right.first;
+
+        return IsOrderedByName(left.second, right.second);
+    });
+
+    for (std::size_t i = 0; i < keys.size(); ++i)
+        _nameIndex[i] = keys[i].second;
+
+    _bulkLoad = false;
+}
+
+uint32 CharacterCacheStore::Add(uint32 guid, std::string_view name, uint32 accountId, uint8 race, uint8 gender, uint8 playerClass, uint8 level)
+{
+    // Same as a new entry, except for the mail count and the group that are not loaded with the character
+    uint32 row = FindByGuid(guid);
+    if (row != NO_ROW)
+    {
+        Rename(row, name);
+        _infos[row] = { accountId, race, gender, playerClass, level };
+        _guildIds[row] = 0;
+        _arenaTeamIds.erase(guid);
+        return row;
+    }
+
+    name = name.substr(0, std::numeric_limits<uint8>::max());
+
+    row = uint32(_guids.size());
+    _guids.push_back(guid);
+    _nameOffsets.push_back(AppendName(name));
+    _nameLengths.push_back(uint8(name.size()));
+    _infos.push_back({ accountId, race, gender, playerClass, level });
+    _mailCounts.push_back(0);
+    _guildIds.push_back(0);
+    _groupIds.push_back(0);
+
+    SetRow(guid, row);
+    AddToNameIndex(row);
+    return row;
+}
+
+void CharacterCacheStore::Remove(uint32 guid)
+{
+    uint32 const row = FindByGuid(guid);
+    if (row == NO_ROW)
+        return;
+
+    RemoveFromNameIndex(row);
+    _unusedNameBytes += _nameLengths[row];
+
+    // The last row takes the place of the removed one, its position in the name index does not change
+    uint32 const last = uint32(_guids.size() - 1);
+    if (row != last)
+    {
+        auto itr = FindInNameIndex(last);
+        if (itr != _nameIndex.end())
+            *itr = row;
+
+        _guids[row] = _guids[last];
+        _nameOffsets[row] = _nameOffsets[last];
+        _nameLengths[row] = _nameLengths[last];
+        _infos[row] = _infos[last];
+        _mailCounts[row] = _mailCounts[last];
+        _guildIds[row] = _guildIds[last];
+        _groupIds[row] = _groupIds[last];
+        SetRow(_guids[row], row);
+    }
+
+    _guids.pop_back();
+    _nameOffsets.pop_back();
+    _nameLengths.pop_back();
+    _infos.pop_back();
+    _mailCounts.pop_back();
+    _guildIds.pop_back();
+    _groupIds.pop_back();
+    _arenaTeamIds.erase(guid);
+    SetRow(guid, NO_ROW);
+
+    CompactNames();
+}
+
+void CharacterCacheStore::Rename(uint32 row, std::string_view name)
+{
+    name = name.substr(0, std::numeric_limits<uint8>::max());
+
+    RemoveFromNameIndex(row);
+    _unusedNameBytes += _nameLengths[row];
+
+    _nameOffsets[row] = AppendName(name);
+    _nameLengths[row] = uint8(name.size());
+    AddToNameIndex(row);
+
+    CompactNames();
+}
+
+uint32 CharacterCacheStore::FindByGuid(uint32 guid) const
+{
+    if (guid < MAX_DENSE_GUID)
+        return guid < _rowByGuid.size() ? _rowByGuid[guid] : NO_ROW;
+
+    auto itr = _sparseRows.find(guid);
+    return itr != _sparseRows.end() ? itr->second : NO_ROW;
+}
+
+uint32 CharacterCacheStore::FindByName(std::string_view name) const
+{
+    auto itr = std::lower_bound(_nameIndex.begin(), _nameIndex.end(), name, [this](uint32 row, std::string_view key)
+    {
+        return CompareNames(GetName(row), key) < 0;
+    });
+
+    if (itr == _nameIndex.end() || CompareNames(GetName(*itr), name))
+        return NO_ROW;
+
+    return *itr;
+}
+
+void CharacterCacheStore::FindByNamePrefix(std::string_view prefix, std::size_t limit, std::vector<uint32>& rows) const
+{
+    auto itr = std::lower_bound(_nameIndex.begin(), _nameIndex.end(), prefix, [this](uint32 row, std::string_view key)
+    {
+        return CompareNames(GetName(row), key) < 0;
+    });
+
+    for (; itr != _nameIndex.end() && rows.size() < limit && HasPrefix(GetName(*itr), prefix); ++itr)
+        rows.push_back(*itr);
+}
+
+std::size_t CharacterCacheStore::GetMemoryUsage() const
+{
+    return _guids.capacity() * sizeof(uint32)
+        + _nameOffsets.capacity() * sizeof(uint32)
+        + _nameLengths.capacity() * sizeof(uint8)
+        + _infos.capacity() * sizeof(CharacterInfo)
+        + _mailCounts.capacity() * sizeof(uint16)
+        + _guildIds.capacity() * sizeof(uint32)
+        + _groupIds.capacity() * sizeof(uint32)
+        + _arenaTeamIds.size() * (sizeof(std::pair<uint32, std::array<uint32, ARENA_SLOTS>>) + 2 * sizeof(void*))
+        + _names.capacity()
+        + _rowByGuid.capacity() * sizeof(uint32)
+        + _sparseRows.size() * (sizeof(std::pair<uint32, uint32>) + 2 * sizeof(void*))
+        + _nameIndex.capacity() * sizeof(uint32);
+}
+
+uint32 CharacterCacheStore::GetArenaTeamId(uint32 row, uint8 slot) const
+{
+    auto itr = _arenaTeamIds.find(_guids[row]);
+    return itr != _arenaTeamIds.end() ? itr->second[slot] : 0;
+}
+
+void CharacterCacheStore::SetArenaTeamId(uint32 row, uint8 slot, uint32 arenaTeamId)
+{
+    if (arenaTeamId)
+    {
+        _arenaTeamIds[_guids[row]][slot] = arenaTeamId;
+        return;
+    }
+
+    auto itr = _arenaTeamIds.find(_guids[row]);
+    if (itr == _arenaTeamIds.end())
+        return;
+
+    itr->second[slot] = 0;
+    if (std::all_of(itr->second.begin(), itr->second.end(), [](uint32 id) { return !id; }))
+        _arenaTeamIds.erase(itr);
+}
+
+std::string CharacterCacheStore::GetFingerprint() const
+{
+    // CONCAT_WS(':', guid, name, account, race, gender, class, level) of each row, as hashed by MySQL's CRC32
+    uint32 maxGuid = 0;
+    uint64 rowHashes = 0;
+    std::string row;
+    for (uint32 i = 0; i < _guids.size(); ++i)
+    {
+        CharacterInfo const& info = _infos[i];
+        row = std::to_string(_guids[i]);
+        row += ':';
+        row += GetName(i);
+        for (uint32 value : { info.AccountId, uint32(info.Race), uint32(info.Gender), uint32(info.Class), uint32(info.Level) })
+        {
+            row += ':';
+            row += std::to_string(value);
+        }
+
+        rowHashes ^= crc32(0L, reinterpret_cast<Bytef const*>(row.data()), uInt(row.size()));
+        maxGuid = std::max(maxGuid, _guids[i]);
+    }
+
+    return std::to_string(_guids.size()) + ':' + std::to_string(maxGuid) + ':' + std::to_string(rowHashes);
+}
+
+bool CharacterCacheStore::SaveSnapshot(std::string const& fileName, std::string const& fingerprint) const
+{
+    // Written next to the snapshot and renamed over it, a crash while writing does not leave a truncated snapshot behind
+    std::string const tempFileName = fileName + ".tmp";
+    {
+        std::ofstream stream(tempFileName, std::ios::binary | std::ios::trunc);
+        if (!stream)
+            return false;
+
+        std::vector<char> names;
+        names.reserve(_names.size() - _unusedNameBytes);
+        for (uint32 row = 0; row < _guids.size(); ++row)
+        {
+            std::string_view const name = GetName(row);
+            names.insert(names.end(), name.begin(), name.end());
+        }
+
+        uint32 const header[] = { SNAPSHOT_MAGIC, SNAPSHOT_VERSION, uint32(fingerprint.size()), uint32(_guids.size()), uint32(names.size()) };
+        stream.write(reinterpret_cast<char const*>(header), sizeof(header));
+        stream.write(fingerprint.data(), fingerprint.size());
+        WriteColumn(stream, _guids);
+        WriteColumn(stream, _infos);
+        WriteColumn(stream, _nameLengths);
+        WriteColumn(stream, names);
+        WriteColumn(stream, _nameIndex);
+
+        if (!stream.flush())
+            return false;
+    }
+
+    return !std::rename(tempFileName.c_str(), fileName.c_str());
+}
+
+bool CharacterCacheStore::LoadSnapshot(std::string const& fileName, std::string const& fingerprint)
+{
+    std::ifstream stream(fileName, std::ios::binary);
+    if (!stream)
+        return false;
+
+    uint32 header[5];
+    if (!stream.read(reinterpret_cast<char*>(header), sizeof(header)) || header[0] != SNAPSHOT_MAGIC || header[1] != SNAPSHOT_VERSION)
+        return false;
+
+    std::string storedFingerprint(header[2], '\0');
+    if (!stream.read(storedFingerprint.data(), storedFingerprint.size()) || storedFingerprint != fingerprint)
+        return false;
+
+    std::size_t const rows = header[3];
+    std::vector<uint32> guids;
+    std::vector<CharacterInfo> infos;
+    std::vector<uint8> nameLengths;
+    std::vector<char> names;
+    std::vector<uint32> nameIndex;
+    if (!ReadColumn(stream, guids, rows) || !ReadColumn(stream, infos, rows) || !ReadColumn(stream, nameLengths, rows) || !ReadColumn(stream, names, header[4])
+        || !ReadColumn(stream, nameIndex, rows))
+        return false;
+
+    Clear();
+    BeginBulkLoad(rows);
+
+    std::size_t nameOffset = 0;
+    for (std::size_t i = 0; i < rows; ++i)
+    {
+        if (nameOffset + nameLengths[i] > names.size())
+        {
+            Clear();
+            return false;
+        }
+
+        CharacterInfo const& info = infos[i];
+        Add(guids[i], std::string_view(names.data() + nameOffset, nameLengths[i]), info.AccountId, info.Race, info.Gender, info.Class, info.Level);
+        nameOffset += nameLengths[i];
+    }
+
+    // Rows were added in the same order, the saved name index is still sorted
+    if (GetSize() != rows || std::any_of(nameIndex.begin(), nameIndex.end(), [rows](uint32 row) { return row >= rows; }))
+    {
+        Clear();
+        return false;
+    }
+
+    _nameIndex = std::move(nameIndex);
+    _bulkLoad = false;
+    return true;
+}
+
+void CharacterCacheStore::SetRow(uint32 guid, uint32 row)
+{
+    if (guid >= MAX_DENSE_GUID)
+    {
+        if (row == NO_ROW)
+            _sparseRows.erase(guid);
+        else
+            _sparseRows[guid] = row;
+
+        return;
+    }
+
+    if (guid >= _rowByGuid.size())
+    {
+        if (row == NO_ROW)
+            return;
+
+        _rowByGuid.resize(guid + 1, NO_ROW);
+    }
+
+    _rowByGuid[guid] = row;
+}
+
+uint32 CharacterCacheStore::AppendName(std::string_view name)
+{
+    uint32 const offset = uint32(_names.size());
+    _names.insert(_names.end(), name.begin(), name.end());
+    return offset;
+}
+
+void CharacterCacheStore::CompactNames()
+{
+    // Renamed and removed characters leave their old name behind, rebuild once it is half of the buffer
+    if (_unusedNameBytes < 4096 || _unusedNameBytes < _names.size() / 2)
+        return;
+
+    std::vector<char> names;
+    names.reserve(_names.size() - _unusedNameBytes);
+    for (uint32 row = 0; row < _guids.size(); ++row)
+    {
+        std::string_view const name = GetName(row);
+        _nameOffsets[row] = uint32(names.size());
+        names.insert(names.end(), name.begin(), name.end());
+    }
+
+    _names = std::move(names);
+    _unusedNameBytes = 0;
+}
+
+bool CharacterCacheStore::IsOrderedByName(uint32 left, uint32 right) const
+{
+    // Same names are ordered by guid, which does not change when a row moves
+    int const compare = CompareNames(GetName(left), GetName(right));
+    return compare ? compare < 0 : _guids[left] < _guids[right];
+}
+
+void CharacterCacheStore::AddToNameIndex(uint32 row)
+{
+    if (_bulkLoad)
+    {
+        _nameIndex.push_back(row);
+        return;
+    }
+
+    auto itr = std::upper_bound(_nameIndex.begin(), _nameIndex.end(), row, [this](uint32 left, uint32 right) { return IsOrderedByName(left, right); });
+
+    _nameIndex.insert(itr, row);
+}
+
+void CharacterCacheStore::RemoveFromNameIndex(uint32 row)
+{
+    auto itr = FindInNameIndex(row);
+    if (itr != _nameIndex.end())
+        _nameIndex.erase(itr);
+}
+
+std::vector<uint32>::iterator CharacterCacheStore::FindInNameIndex(uint32 row)
+{
+    // Not sorted yet during a bulk load
+    if (_bulkLoad)
+        return std::find(_nameIndex.begin(), _nameIndex.end(), row);
+
+    auto itr = std::lower_bound(_nameIndex.begin(), _nameIndex.end(), row, [this](uint32 left, uint32 right) { return IsOrderedByName(left, right); });
+
+    return (itr != _nameIndex.end() && *itr == row) ? itr : _nameIndex.end();
+}
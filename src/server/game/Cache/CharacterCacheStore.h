@@ -0,0 +1,134 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _CHARACTER_CACHE_STORE_H_
+#define _CHARACTER_CACHE_STORE_H_
+
+#include "Define.h"
+#include <array>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+/*
+ * Columns of the character cache, one row per character.
+ *
+ * Names are interned in a single buffer, rows are found by guid through a dense array
+ * indexed by the low guid and by name through an array of rows sorted by name, which also
+ * answers prefix queries. A removed row is replaced by the last one, so row numbers are
+ * only valid until the next Add or Remove. Arena teams are only stored for the characters
+ * that have one.
+ *
+ * The characters table columns can be written to a snapshot file and read back at startup
+ * instead of querying every row.
+ */
+class AC_GAME_API CharacterCacheStore
+{
+public:
+    static constexpr uint32 NO_ROW = std::numeric_limits<uint32>::max();
+    static constexpr uint8 ARENA_SLOTS = 4;
+
+    void Clear();
+
+    /// The name index is only sorted once in EndBulkLoad, no name lookup in between
+    void BeginBulkLoad(std::size_t expectedRows);
+    void EndBulkLoad();
+
+    /// Adds the character or replaces its previous row, returns the row
+    uint32 Add(uint32 guid, std::string_view name, uint32 accountId, uint8 race, uint8 gender, uint8 playerClass, uint8 level);
+    void Remove(uint32 guid);
+    void Rename(uint32 row, std::string_view name);
+
+    [[nodiscard]] uint32 FindByGuid(uint32 guid) const;
+    /// Names are compared without the case of ASCII letters
+    [[nodiscard]] uint32 FindByName(std::string_view name) const;
+    /// At most limit rows whose name starts with the prefix, in name order
+    void FindByNamePrefix(std::string_view prefix, std::size_t limit, std::vector<uint32>& rows) const;
+
+    [[nodiscard]] std::size_t GetSize() const { return _guids.size(); }
+    [[nodiscard]] std::size_t GetMemoryUsage() const;
+
+    [[nodiscard]] uint32 GetGuid(uint32 row) const { return _guids[row]; }
+    [[nodiscard]] std::string_view GetName(uint32 row) const { return { _names.data() + _nameOffsets[row], _nameLengths[row] }; }
+    [[nodiscard]] uint32 GetAccountId(uint32 row) const { return _infos[row].AccountId; }
+    [[nodiscard]] uint8 GetRace(uint32 row) const { return _infos[row].Race; }
+    [[nodiscard]] uint8 GetGender(uint32 row) const { return _infos[row].Gender; }
+    [[nodiscard]] uint8 GetClass(uint32 row) const { return _infos[row].Class; }
+    [[nodiscard]] uint8 GetLevel(uint32 row) const { return _infos[row].Level; }
+    [[nodiscard]] uint16 GetMailCount(uint32 row) const { return _mailCounts[row]; }
+    [[nodiscard]] uint32 GetGuildId(uint32 row) const { return _guildIds[row]; }
+    [[nodiscard]] uint32 GetArenaTeamId(uint32 row, uint8 slot) const;
+    [[nodiscard]] uint32 GetGroupId(uint32 row) const { return _groupIds[row]; }
+
+    void SetAccountId(uint32 row, uint32 accountId) { _infos[row].AccountId = accountId; }
+    void SetRace(uint32 row, uint8 race) { _infos[row].Race = race; }
+    void SetGender(uint32 row, uint8 gender) { _infos[row].Gender = gender; }
+    void SetLevel(uint32 row, uint8 level) { _infos[row].Level = level; }
+    void SetMailCount(uint32 row, uint16 count) { _mailCounts[row] = count; }
+    void SetGuildId(uint32 row, uint32 guildId) { _guildIds[row] = guildId; }
+    void SetArenaTeamId(uint32 row, uint8 slot, uint32 arenaTeamId);
+    void SetGroupId(uint32 row, uint32 groupId) { _groupIds[row] = groupId; }
+
+    /// Count, highest guid and xor of the CRC32 of every row, the same as computed over the characters table by CharacterCache
+    [[nodiscard]] std::string GetFingerprint() const;
+
+    /// The fingerprint identifies the database state the rows belong to, a snapshot with another one is not loaded
+    bool SaveSnapshot(std::string const& fileName, std::string const& fingerprint) const;
+    bool LoadSnapshot(std::string const& fileName, std::string const& fingerprint);
+
+private:
+    struct CharacterInfo
+    {
+        uint32 AccountId;
+        uint8 Race;
+        uint8 Gender;
+        uint8 Class;
+        uint8 Level;
+    };
+
+    // Guids above are kept in _sparseRows, so one bogus guid cannot grow the dense array
+    static constexpr uint32 MAX_DENSE_GUID = 16 * 1024 * 1024;
+
+    void SetRow(uint32 guid, uint32 row);
+    uint32 AppendName(std::string_view name);
+    void CompactNames();
+    bool IsOrderedByName(uint32 left, uint32 right) const;
+    void AddToNameIndex(uint32 row);
+    void RemoveFromNameIndex(uint32 row);
+    std::vector<uint32>::iterator FindInNameIndex(uint32 row);
+
+    std::vector<uint32> _guids;
+    std::vector<uint32> _nameOffsets;
+    std::vector<uint8> _nameLengths;
+    std::vector<CharacterInfo> _infos;
+    std::vector<uint16> _mailCounts;
+    std::vector<uint32> _guildIds;
+    std::vector<uint32> _groupIds;
+    std::unordered_map<uint32, std::array<uint32, ARENA_SLOTS>> _arenaTeamIds;
+
+    std::vector<char> _names;
+    std::size_t _unusedNameBytes = 0;
+
+    std::vector<uint32> _rowByGuid;
+    std::unordered_map<uint32, uint32> _sparseRows;
+    std::vector<uint32> _nameIndex;
+    bool _bulkLoad = false;
+};
+
+#endif
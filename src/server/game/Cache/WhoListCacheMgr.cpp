@@ -19,8 +19,9 @@
 #include "AreaDefines.h"
 #include "GuildMgr.h"
 #include "ObjectAccessor.h"
-#include "World.h"
-#include "WorldSessionMgr.h"
+#include "Player.h"
+#include "WorldSession.h"
+#include <algorithm>
 
 WhoListCacheMgr* WhoListCacheMgr::instance()
 {
@@ -28,36 +29,61 @@ WhoListCacheMgr* WhoListCacheMgr::instance()
     return &instance;
 }
 
+void WhoListCacheMgr::MarkDirty(ObjectGuid guid)
+{
+    std::lock_guard<std::mutex> guard(_dirtyLock);
+    _dirty.push_back(guid);
+}
+
 void WhoListCacheMgr::Update()
 {
-    // clear current list
-    _whoListStorage.clear();
-    _whoListStorage.reserve(sWorldSessionMgr->GetPlayerCount() + 1);
+    std::vector<ObjectGuid> dirty;
+    {
+        std::lock_guard<std::mutex> guard(_dirtyLock);
+        dirty.swap(_dirty);
+    }
+
+    if (dirty.empty())
+        return;
+
+    std::sort(dirty.begin(), dirty.end());
+    dirty.erase(std::unique(dirty.begin(), dirty.end()), dirty.end());
 
-    for (auto const& [guid, player] : ObjectAccessor::GetPlayers())
+    for (ObjectGuid guid : dirty)
+        Refresh(guid);
+}
+
+void WhoListCacheMgr::Refresh(ObjectGuid guid)
+{
+    Player* player = ObjectAccessor::FindConnectedPlayer(guid);
+    if (!player)
     {
-        if (!player->FindMap() || player->GetSession()->PlayerLoading())
-            continue;
+        _index.Remove(guid);
+        return;
+    }
 
-        std::string playerName = player->GetName();
-        std::wstring widePlayerName;
+    // Still loading or between two maps: keep the entry, the login or zone update marks the player again
+    if (!player->FindMap() || player->GetSession()->PlayerLoading())
+        return;
 
-        if (!Utf8toWStr(playerName, widePlayerName))
-            continue;
+    std::string playerName = player->GetName();
+    std::wstring widePlayerName;
 
-        wstrToLower(widePlayerName);
+    if (!Utf8toWStr(playerName, widePlayerName))
+        return;
 
-        std::string guildName = sGuildMgr->GetGuildNameById(player->GetGuildId());
-        std::wstring wideGuildName;
+    wstrToLower(widePlayerName);
 
-        if (!Utf8toWStr(guildName, wideGuildName))
-            continue;
+    std::string guildName = sGuildMgr->GetGuildNameById(player->GetGuildId());
+    std::wstring wideGuildName;
 
-        wstrToLower(wideGuildName);
+    if (!Utf8toWStr(guildName, wideGuildName))
+        return;
 
-        _whoListStorage.emplace_back(player->GetGUID(), player->GetTeamId(), player->GetSession()->GetSecurity(), player->GetLevel(),
-            player->getClass(), player->getRace(),
-            (player->IsSpectator() ? AREA_DALARAN : player->GetZoneId()), player->getGender(), player->IsVisible(),
-            widePlayerName, wideGuildName, playerName, guildName);
-    }
+    wstrToLower(wideGuildName);
+
+    _index.Update(WhoListPlayerInfo(player->GetGUID(), player->GetTeamId(), player->GetSession()->GetSecurity(), player->GetLevel(),
+        player->getClass(), player->getRace(),
+        (player->IsSpectator() ? AREA_DALARAN : player->GetZoneId()), player->getGender(), player->IsVisible(),
+        widePlayerName, wideGuildName, playerName, guildName));
 }
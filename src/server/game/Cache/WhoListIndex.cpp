@@ -0,0 +1,155 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "WhoListIndex.h"
+#include "Errors.h"
+#include <algorithm>
+#include <limits>
+
+void WhoListIndex::Update(WhoListPlayerInfo const& info)
+{
+    ASSERT(info.GetClass() < MAX_MASK_BUCKETS && info.GetRace() < MAX_MASK_BUCKETS);
+
+    auto [itr, inserted] = _entries.try_emplace(info.GetGuid(), Entry{ info, {} });
+    if (!inserted)
+    {
+        Unlink(itr->second);
+        itr->second.Info = info;
+    }
+
+    Link(itr->second);
+}
+
+void WhoListIndex::Remove(ObjectGuid guid)
+{
+    auto itr = _entries.find(guid);
+    if (itr == _entries.end())
+        return;
+
+    Unlink(itr->second);
+    _entries.erase(itr);
+}
+
+void WhoListIndex::GetCandidates(uint32 levelMin, uint32 levelMax, uint32 raceMask, uint32 classMask, uint32 const* zoneIds, uint32 zoneCount,
+    std::vector<WhoListPlayerInfo const*>& candidates) const
+{
+    levelMax = std::min<uint32>(levelMax, STRONG_MAX_LEVEL);
+
+    // Pick the criterion with the fewest players in its buckets
+    std::array<uint32, MAX_BUCKET_TYPES> sizes = {};
+    sizes[BUCKET_ZONE] = zoneCount ? 0 : std::numeric_limits<uint32>::max();
+    for (uint32 i = 0; i < zoneCount; ++i)
+    {
+        // The client can repeat a zone, its players must only be listed once
+        if (std::find(zoneIds, zoneIds + i, zoneIds[i]) != zoneIds + i)
+            continue;
+
+        auto itr = _zoneBuckets.find(zoneIds[i]);
+        if (itr != _zoneBuckets.end())
+            sizes[BUCKET_ZONE] += itr->second.size();
+    }
+
+    for (uint32 level = levelMin; level <= levelMax; ++level)
+        sizes[BUCKET_LEVEL] += _levelBuckets[level].size();
+
+    for (uint32 i = 0; i < MAX_MASK_BUCKETS; ++i)
+    {
+        if (classMask & (1u << i))
+            sizes[BUCKET_CLASS] += _classBuckets[i].size();
+
+        if (raceMask & (1u << i))
+            sizes[BUCKET_RACE] += _raceBuckets[i].size();
+    }
+
+    BucketType const type = BucketType(std::min_element(sizes.begin(), sizes.end()) - sizes.begin());
+    candidates.reserve(candidates.size() + sizes[type]);
+
+    auto addBucket = [&candidates](Bucket const& bucket)
+    {
+        for (Entry const* entry : bucket)
+            candidates.push_back(&entry->Info);
+    };
+
+    switch (type)
+    {
+        case BUCKET_ZONE:
+            for (uint32 i = 0; i < zoneCount; ++i)
+            {
+                if (std::find(zoneIds, zoneIds + i, zoneIds[i]) != zoneIds + i)
+                    continue;
+
+                auto itr = _zoneBuckets.find(zoneIds[i]);
+                if (itr != _zoneBuckets.end())
+                    addBucket(itr->second);
+            }
+            break;
+        case BUCKET_LEVEL:
+            for (uint32 level = levelMin; level <= levelMax; ++level)
+                addBucket(_levelBuckets[level]);
+            break;
+        case BUCKET_CLASS:
+            for (uint32 i = 0; i < MAX_MASK_BUCKETS; ++i)
+                if (classMask & (1u << i))
+                    addBucket(_classBuckets[i]);
+            break;
+        case BUCKET_RACE:
+            for (uint32 i = 0; i < MAX_MASK_BUCKETS; ++i)
+                if (raceMask & (1u << i))
+                    addBucket(_raceBuckets[i]);
+            break;
+        default:
+            break;
+    }
+}
+
+WhoListIndex::Bucket& WhoListIndex::GetBucket(BucketType type, WhoListPlayerInfo const& info)
+{
+    switch (type)
+    {
+        case BUCKET_ZONE:
+            return _zoneBuckets[info.GetZoneId()];
+        case BUCKET_LEVEL:
+            return _levelBuckets[info.GetLevel()];
+        case BUCKET_CLASS:
+            return _classBuckets[info.GetClass()];
+        default:
+            return _raceBuckets[info.GetRace()];
+    }
+}
+
+void WhoListIndex::Link(Entry& entry)
+{
+    for (uint32 type = 0; type < MAX_BUCKET_TYPES; ++type)
+    {
+        Bucket& bucket = GetBucket(BucketType(type), entry.Info);
+        entry.Positions[type] = bucket.size();
+        bucket.push_back(&entry);
+    }
+}
+
+void WhoListIndex::Unlink(Entry& entry)
+{
+    for (uint32 type = 0; type < MAX_BUCKET_TYPES; ++type)
+    {
+        Bucket& bucket = GetBucket(BucketType(type), entry.Info);
+        uint32 const position = entry.Positions[type];
+
+        bucket[position] = bucket.back();
+        bucket[position]->Positions[type] = position;
+        bucket.pop_back();
+    }
+}
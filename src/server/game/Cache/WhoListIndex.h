@@ -0,0 +1,129 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _WHO_LIST_INDEX_H_
+#define _WHO_LIST_INDEX_H_
+
+#include "Common.h"
+#include "DBCEnums.h"
+#include "ObjectGuid.h"
+#include "SharedDefines.h"
+#include <array>
+#include <unordered_map>
+#include <vector>
+
+class WhoListPlayerInfo
+{
+public:
+    WhoListPlayerInfo(ObjectGuid guid, TeamId team, AccountTypes security, uint8 level, uint8 clss, uint8 race, uint32 zoneid, uint8 gender, bool visible, std::wstring const& widePlayerName,
+        std::wstring const& wideGuildName, std::string const& playerName, std::string const& guildName) :
+        _guid(guid),
+        _team(team),
+        _security(security),
+        _level(level),
+        _class(clss),
+        _race(race),
+        _zoneid(zoneid),
+        _gender(gender),
+        _visible(visible),
+        _widePlayerName(widePlayerName),
+        _wideGuildName(wideGuildName),
+        _playerName(playerName),
+        _guildName(guildName) { }
+
+    ObjectGuid GetGuid() const { return _guid; }
+    TeamId GetTeamId() const { return _team; }
+    AccountTypes GetSecurity() const { return _security; }
+    uint8 GetLevel() const { return _level; }
+    uint8 GetClass() const { return _class; }
+    uint8 GetRace() const { return _race; }
+    uint32 GetZoneId() const { return _zoneid; }
+    uint8 GetGender() const { return _gender; }
+    bool IsVisible() const { return _visible; }
+    std::wstring const& GetWidePlayerName() const { return _widePlayerName; }
+    std::wstring const& GetWideGuildName() const { return _wideGuildName; }
+    std::string const& GetPlayerName() const { return _playerName; }
+    std::string const& GetGuildName() const { return _guildName; }
+
+private:
+    ObjectGuid _guid;
+    TeamId _team;
+    AccountTypes _security;
+    uint8 _level;
+    uint8 _class;
+    uint8 _race;
+    uint32 _zoneid;
+    uint8 _gender;
+    bool _visible;
+    std::wstring _widePlayerName;
+    std::wstring _wideGuildName;
+    std::string _playerName;
+    std::string _guildName;
+};
+
+/*
+ * Online players of the who list, bucketed by zone, level, class and race.
+ *
+ * A query only walks the buckets of its most selective criterion, the remaining
+ * criteria and the name filters are still checked by the caller on the candidates.
+ */
+class AC_GAME_API WhoListIndex
+{
+public:
+    /// Adds the player or replaces its previous entry
+    void Update(WhoListPlayerInfo const& info);
+    void Remove(ObjectGuid guid);
+
+    /// Every player matching the level range, the masks or the zones may be in candidates, each at most once
+    void GetCandidates(uint32 levelMin, uint32 levelMax, uint32 raceMask, uint32 classMask, uint32 const* zoneIds, uint32 zoneCount,
+        std::vector<WhoListPlayerInfo const*>& candidates) const;
+
+    [[nodiscard]] std::size_t GetSize() const { return _entries.size(); }
+
+private:
+    enum BucketType
+    {
+        BUCKET_ZONE,
+        BUCKET_LEVEL,
+        BUCKET_CLASS,
+        BUCKET_RACE,
+        MAX_BUCKET_TYPES
+    };
+
+    struct Entry
+    {
+        WhoListPlayerInfo Info;
+        std::array<uint32, MAX_BUCKET_TYPES> Positions;   // position in each of its buckets
+    };
+
+    typedef std::vector<Entry*> Bucket;
+
+    // Race and class masks of CMSG_WHO have one bit per value
+    static constexpr uint32 MAX_MASK_BUCKETS = 32;
+
+    Bucket& GetBucket(BucketType type, WhoListPlayerInfo const& info);
+    void Link(Entry& entry);
+    void Unlink(Entry& entry);
+
+    std::unordered_map<ObjectGuid, Entry> _entries;
+    std::unordered_map<uint32, Bucket> _zoneBuckets;
+    std::array<Bucket, STRONG_MAX_LEVEL + 1> _levelBuckets;
+    std::array<Bucket, MAX_MASK_BUCKETS> _classBuckets;
+    std::array<Bucket, MAX_MASK_BUCKETS> _raceBuckets;
+};
+
+#endif
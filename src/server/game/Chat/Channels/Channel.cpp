@@ -26,6 +26,7 @@
 #include "RBAC.h"
 #include "SocialMgr.h"
 #include "World.h"
+#include <memory>
 
 Channel::Channel(std::string const& name, uint32 channelId, uint32 channelDBId, TeamId teamId, bool announce, bool ownership):
     _announce(announce),
@@ -208,7 +209,7 @@ void Channel::JoinChannel(Player* player, std::string const& pass)
     pinfo.flags = MEMBER_FLAG_NONE;
     pinfo.plrPtr = player;
 
-    playersStore[guid] = pinfo;
+    AddMember(playersStore[guid] = pinfo);
 
     if (_channelRights.joinMessage.length())
         ChatHandler(player->GetSession()).PSendSysMessage("{}", _channelRights.joinMessage);
@@ -272,7 +273,7 @@ void Channel::LeaveChannel(Player* player, bool send)
 
     bool changeowner = playersStore[guid].IsOwner();
 
-    playersStore.erase(guid);
+    RemoveMember(guid);
     if (_announce && ShouldAnnouncePlayer(player))
     {
         WorldPacket data;
@@ -352,7 +353,7 @@ void Channel::KickOrBan(Player const* player, std::string const& badname, bool b
         {
             if (ObjectGuid guid = sCharacterCache->GetCharacterGuidByName(badname))
             {
-                if (CharacterCacheEntry const* gpd = sCharacterCache->GetCharacterCacheByGuid(guid))
+                if (Optional<CharacterCacheEntry> gpd = sCharacterCache->GetCharacterCacheByGuid(guid))
                 {
                     if (Player::TeamIdForRace(gpd->Race) == Player::TeamIdForRace(player->getRace()))
                     {
@@ -439,7 +440,7 @@ void Channel::KickOrBan(Player const* player, std::string const& badname, bool b
 
     if (isOnChannel)
     {
-        playersStore.erase(victim);
+        RemoveMember(victim);
         bad->LeftChannel(this);
         RemoveWatching(bad);
         LeaveNotify(bad);
@@ -910,18 +911,42 @@ void Channel::SetOwner(ObjectGuid guid, bool exclaim)
     }
 }
 
+void Channel::AddMember(PlayerInfo& pinfo)
+{
+    _members.Add(pinfo.player, pinfo.plrPtr, pinfo.plrPtr->GetSocial()->GetIgnoredGuids());
+}
+
+void Channel::RemoveMember(ObjectGuid guid)
+{
+    _members.Remove(guid);
+    playersStore.erase(guid);
+}
+
+void Channel::UpdateIgnore(Player* player, ObjectGuid ignored, bool ignore)
+{
+    _members.SetIgnore(player->GetGUID(), ignored, ignore);
+}
+
 void Channel::SendToAll(WorldPacket* data, ObjectGuid guid)
 {
-    for (PlayerContainer::const_iterator i = playersStore.begin(); i != playersStore.end(); ++i)
-        if (!guid || !i->second.plrPtr->GetSocial()->HasIgnore(guid))
-            i->second.plrPtr->SendDirectMessage(data);
+    // built once, only the header is written for each member
+    std::shared_ptr<WorldPacket const> packet = std::make_shared<WorldPacket const>(*data);
+
+    _members.ForEachReceiver(guid, [&packet](ChannelMembers::Member const& member)
+    {
+        member.Pointer->GetSession()->SendSharedPacket(packet);
+    });
 }
 
 void Channel::SendToAllButOne(WorldPacket* data, ObjectGuid who)
 {
-    for (PlayerContainer::const_iterator i = playersStore.begin(); i != playersStore.end(); ++i)
-        if (i->first != who)
-            i->second.plrPtr->SendDirectMessage(data);
+    std::shared_ptr<WorldPacket const> packet = std::make_shared<WorldPacket const>(*data);
+
+    _members.ForEachReceiver(ObjectGuid::Empty, [&packet, who](ChannelMembers::Member const& member)
+    {
+        if (member.Guid != who)
+            member.Pointer->GetSession()->SendSharedPacket(packet);
+    });
 }
 
 void Channel::SendToOne(WorldPacket* data, ObjectGuid who)
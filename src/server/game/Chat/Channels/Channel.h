@@ -18,9 +18,11 @@
 #ifndef _CHANNEL_H
 #define _CHANNEL_H
 
+#include "ChannelMembers.h"
 #include "WorldPacket.h"
 #include "WorldSession.h"
 #include <string>
+#include <unordered_map>
 
 class Player;
 
@@ -221,6 +223,9 @@ public:
     void AddWatching(Player* p);
     void RemoveWatching(Player* p);
 
+    // called when a member adds or removes someone from the ignore list
+    void UpdateIgnore(Player* player, ObjectGuid ignored, bool ignore);
+
 private:
     // initial packet data (notify type and channel name)
     void MakeNotifyPacket(WorldPacket* data, uint8 notify_type);
@@ -262,6 +267,9 @@ private:
     void MakeModerationOn(WorldPacket* data, ObjectGuid guid);
     void MakeModerationOff(WorldPacket* data, ObjectGuid guid);
 
+    void AddMember(PlayerInfo& pinfo);
+    void RemoveMember(ObjectGuid guid);
+
     void SendToAll(WorldPacket* data, ObjectGuid guid = ObjectGuid::Empty);
     void SendToAllButOne(WorldPacket* data, ObjectGuid who);
     void SendToOne(WorldPacket* data, ObjectGuid who);
@@ -331,6 +339,8 @@ private:
     std::string _password;
     ChannelRights _channelRights;
     PlayerContainer playersStore;
+    // the members of playersStore, for the message fan out
+    ChannelMembers _members;
     BannedContainer bannedStore;
     PlayersWatchingContainer playersWatchingStore;
 };
@@ -0,0 +1,105 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "ChannelMembers.h"
+#include <algorithm>
+
+void ChannelMembers::Add(ObjectGuid guid, Player* player, GuidVector const& ignores)
+{
+    MemberInfo& info = _memberInfos[guid];
+    info.Slot = _members.size();
+    info.Ignores = ignores;
+    _members.push_back({ guid, player });
+
+    for (ObjectGuid const& ignored : info.Ignores)
+        SetIgnoringMember(info.Slot, ignored, true);
+}
+
+void ChannelMembers::Remove(ObjectGuid guid)
+{
+    auto itr = _memberInfos.find(guid);
+    if (itr == _memberInfos.end())
+        return;
+
+    uint32 const slot = itr->second.Slot;
+    for (ObjectGuid const& ignored : itr->second.Ignores)
+        SetIgnoringMember(slot, ignored, false);
+
+    uint32 const lastSlot = _members.size() - 1;
+    if (slot != lastSlot)
+    {
+        MemberInfo& moved = _memberInfos[_members[lastSlot].Guid];
+        for (ObjectGuid const& ignored : moved.Ignores)
+        {
+            SetIgnoringMember(lastSlot, ignored, false);
+            SetIgnoringMember(slot, ignored, true);
+        }
+
+        moved.Slot = slot;
+        _members[slot] = _members[lastSlot];
+    }
+
+    _members.pop_back();
+    _memberInfos.erase(itr);
+}
+
+void ChannelMembers::SetIgnore(ObjectGuid guid, ObjectGuid ignored, bool ignore)
+{
+    auto itr = _memberInfos.find(guid);
+    if (itr == _memberInfos.end())
+        return;
+
+    MemberInfo& info = itr->second;
+    GuidVector::iterator ignoreItr = std::find(info.Ignores.begin(), info.Ignores.end(), ignored);
+    if (ignore == (ignoreItr != info.Ignores.end()))
+        return;
+
+    if (ignore)
+        info.Ignores.push_back(ignored);
+    else
+        info.Ignores.erase(ignoreItr);
+
+    SetIgnoringMember(info.Slot, ignored, ignore);
+}
+
+bool ChannelMembers::IsIgnoring(ObjectGuid guid, ObjectGuid sender) const
+{
+    auto memberItr = _memberInfos.find(guid);
+    auto ignoringItr = _ignoringMembers.find(sender);
+    return memberItr != _memberInfos.end() && ignoringItr != _ignoringMembers.end() && IsSlotSet(ignoringItr->second, memberItr->second.Slot);
+}
+
+void ChannelMembers::SetIgnoringMember(uint32 slot, ObjectGuid ignored, bool set)
+{
+    if (set)
+    {
+        std::vector<uint64>& bits = _ignoringMembers[ignored];
+        if (bits.size() <= slot / 64)
+            bits.resize(slot / 64 + 1, 0);
+
+        bits[slot / 64] |= uint64(1) << (slot % 64);
+        return;
+    }
+
+    auto itr = _ignoringMembers.find(ignored);
+    if (itr == _ignoringMembers.end() || itr->second.size() <= slot / 64)
+        return;
+
+    itr->second[slot / 64] &= ~(uint64(1) << (slot % 64));
+    if (std::all_of(itr->second.begin(), itr->second.end(), [](uint64 bits) { return !bits; }))
+        _ignoringMembers.erase(itr);
+}
@@ -0,0 +1,84 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _CHANNELMEMBERS_H
+#define _CHANNELMEMBERS_H
+
+#include "ObjectGuid.h"
+#include <unordered_map>
+#include <vector>
+
+class Player;
+
+/*
+ * Members of a channel in a dense array for the message fan out, the last one is moved into the slot of a leaving one.
+ * The slots of the members ignoring a sender are kept as bitsets, one bit per slot, only for senders ignored by any member.
+ */
+class ChannelMembers
+{
+public:
+    struct Member
+    {
+        ObjectGuid Guid;
+        Player* Pointer;
+    };
+
+    void Add(ObjectGuid guid, Player* player, GuidVector const& ignores);
+    void Remove(ObjectGuid guid);
+    // called when a member adds or removes someone from the ignore list
+    void SetIgnore(ObjectGuid guid, ObjectGuid ignored, bool ignore);
+
+    [[nodiscard]] std::size_t GetSize() const { return _members.size(); }
+    [[nodiscard]] bool IsIgnoring(ObjectGuid guid, ObjectGuid sender) const;
+
+    // Calls the function for every member, but the ones ignoring the sender
+    template<class Function>
+    void ForEachReceiver(ObjectGuid sender, Function&& function) const
+    {
+        std::vector<uint64> const* ignoring = nullptr;
+        if (sender)
+        {
+            auto itr = _ignoringMembers.find(sender);
+            if (itr != _ignoringMembers.end())
+                ignoring = &itr->second;
+        }
+
+        for (uint32 slot = 0; slot < _members.size(); ++slot)
+            if (!ignoring || !IsSlotSet(*ignoring, slot))
+                function(_members[slot]);
+    }
+
+private:
+    struct MemberInfo
+    {
+        uint32 Slot;                                        // position in _members
+        GuidVector Ignores;                                 // senders this member ignores, mirrored in _ignoringMembers
+    };
+
+    [[nodiscard]] static bool IsSlotSet(std::vector<uint64> const& bits, uint32 slot)
+    {
+        return slot / 64 < bits.size() && (bits[slot / 64] & (uint64(1) << (slot % 64)));
+    }
+
+    void SetIgnoringMember(uint32 slot, ObjectGuid ignored, bool set);
+
+    std::vector<Member> _members;
+    std::unordered_map<ObjectGuid, MemberInfo> _memberInfos;
+    std::unordered_map<ObjectGuid, std::vector<uint64>> _ignoringMembers;
+};
+
+#endif
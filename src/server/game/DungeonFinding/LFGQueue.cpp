@@ -33,6 +33,85 @@ namespace lfg
         joinTime(time_t(GameTime::GetGameTime().count())), lastRefreshTime(joinTime), tanks(LFG_TANKS_NEEDED),
         healers(LFG_HEALERS_NEEDED), dps(LFG_DPS_NEEDED) { }
 
+    namespace
+    {
+        constexpr uint8 RoleAssignmentBit(uint8 tanks, uint8 healers, uint8 dps)
+        {
+            return tanks * 8 + healers * 4 + dps;
+        }
+
+        // Every assignment of a and every assignment of b together, within the 1 tank, 1 healer and 3 dps of a group
+        uint16 CombineRoleAssignments(uint16 a, uint16 b)
+        {
+            uint16 result = 0;
+            for (uint8 bitA = 0; bitA < 16; ++bitA)
+            {
+                if (!(a & (1 << bitA)))
+                    continue;
+
+                for (uint8 bitB = 0; bitB < 16; ++bitB)
+                {
+                    if (!(b & (1 << bitB)))
+                        continue;
+
+                    uint8 const tanks = (bitA >> 3) + (bitB >> 3);
+                    uint8 const healers = ((bitA >> 2) & 1) + ((bitB >> 2) & 1);
+                    uint8 const dps = (bitA & 3) + (bitB & 3);
+                    if (tanks <= LFG_TANKS_NEEDED && healers <= LFG_HEALERS_NEEDED && dps <= LFG_DPS_NEEDED)
+                        result |= 1 << RoleAssignmentBit(tanks, healers, dps);
+                }
+            }
+
+            return result;
+        }
+    }
+
+    LfgCompatibilityMask::LfgCompatibilityMask(LfgDungeonSet const& dungeonSet, LfgRolesMap const& rolesMap)
+    {
+        for (uint32 dungeon : dungeonSet)
+        {
+            if (dungeon < MAX_DUNGEON_BITS)
+                dungeons.set(dungeon);
+            else
+                bigDungeonIds = true;
+        }
+
+        // no player is an empty group, which CheckGroupRoles refuses
+        if (rolesMap.empty())
+            return;
+
+        roles = 1 << RoleAssignmentBit(0, 0, 0);
+        for (LfgRolesMap::const_iterator itr = rolesMap.begin(); itr != rolesMap.end(); ++itr)
+        {
+            uint16 playerRoles = 0;
+            if (itr->second & PLAYER_ROLE_TANK)
+                playerRoles |= 1 << RoleAssignmentBit(1, 0, 0);
+            if (itr->second & PLAYER_ROLE_HEALER)
+                playerRoles |= 1 << RoleAssignmentBit(0, 1, 0);
+            if (itr->second & PLAYER_ROLE_DAMAGE)
+                playerRoles |= 1 << RoleAssignmentBit(0, 0, 1);
+
+            roles = CombineRoleAssignments(roles, playerRoles);
+        }
+    }
+
+    LfgCompatibilityMask LfgCompatibilityMask::Combine(LfgCompatibilityMask const& other) const
+    {
+        LfgCompatibilityMask result;
+        result.dungeons = dungeons & other.dungeons;
+        result.bigDungeonIds = bigDungeonIds && other.bigDungeonIds;
+        result.roles = CombineRoleAssignments(roles, other.roles);
+        return result;
+    }
+
+    bool LfgCompatibilityMask::CanMatchWith(LfgCompatibilityMask const& other) const
+    {
+        if (!(bigDungeonIds && other.bigDungeonIds) && (dungeons & other.dungeons).none())
+            return false;
+
+        return CombineRoleAssignments(roles, other.roles) != 0;
+    }
+
     void LFGQueue::AddToQueue(ObjectGuid guid, bool failedProposal)
     {
         LOG_DEBUG("lfg", "ADD AddToQueue: {}, failed proposal: {}", guid.ToString(), failedProposal ? 1 : 0);
@@ -106,6 +185,11 @@ namespace lfg
     void LFGQueue::AddQueueData(ObjectGuid guid, time_t joinTime, LfgDungeonSet const& dungeons, LfgRolesMap const& rolesMap)
     {
         LOG_DEBUG("lfg", "JOINED AddQueueData: {}", guid.ToString());
+
+        // compatibles keep the mask of the replaced data
+        if (QueueDataStore.find(guid) != QueueDataStore.end())
+            RemoveFromCompatibles(guid);
+
         QueueDataStore[guid] = LfgQueueData(joinTime, dungeons, rolesMap);
         AddToQueue(guid);
     }
@@ -169,7 +253,13 @@ namespace lfg
     void LFGQueue::AddToCompatibles(Lfg5Guids const& key)
     {
         LOG_DEBUG("lfg", "COMPATIBLES ADD: {}", key.toString());
-        CompatibleTempList.push_back(key);
+
+        // key only holds queued guids, CheckCompatibility looked all of them up before
+        LfgCompatibilityMask mask = QueueDataStore[key.front()].compatibilityMask;
+        for (uint8 i = 1; i < 5 && key.guids[i]; ++i)
+            mask = mask.Combine(QueueDataStore[key.guids[i]].compatibilityMask);
+
+        CompatibleTempList.emplace_back(key, mask);
     }
 
     uint8 LFGQueue::FindGroups()
@@ -206,7 +296,7 @@ namespace lfg
         // we have to take into account that FindNewGroups is called every X minutes if number of compatibles is low!
         // build set of already present compatibles for this guid
         std::set<Lfg5Guids> currentCompatibles;
-        for (Lfg5GuidsList::iterator it = CompatibleList.begin(); it != CompatibleList.end(); ++it)
+        for (LfgCompatibleContainer::iterator it = CompatibleList.begin(); it != CompatibleList.end(); ++it)
             if (it->hasGuid(newGuid))
             {
                 // unset roles here so they are not copied, restore after insertion
@@ -224,15 +314,23 @@ namespace lfg
                 return selfCompatibility;
         }
 
-        for (Lfg5GuidsList::iterator it = CompatibleList.begin(); it != CompatibleList.end(); )
+        LfgQueueDataContainer::const_iterator itNewQueue = QueueDataStore.find(newGuid);
+        LfgCompatibilityMask const* newMask = itNewQueue != QueueDataStore.end() ? &itNewQueue->second.compatibilityMask : nullptr;
+
+        for (LfgCompatibleContainer::iterator it = CompatibleList.begin(); it != CompatibleList.end(); )
         {
-            Lfg5GuidsList::iterator itr = it++;
+            LfgCompatibleContainer::iterator itr = it++;
             if (itr->empty())
             {
                 LOG_DEBUG("lfg", "ERASE from CompatibleList");
                 CompatibleList.erase(itr);
                 continue;
             }
+
+            // CheckCompatibility would fail on roles or dungeons without touching foundMask
+            if (newMask && !itr->compatibilityMask.CanMatchWith(*newMask))
+                continue;
+
             LfgCompatibility compatibility = CheckCompatibility(*itr, newGuid, foundMask, foundCount, currentCompatibles);
             if (compatibility == LFG_COMPATIBLES_MATCH)
                 return LFG_COMPATIBLES_MATCH;
@@ -483,9 +581,9 @@ namespace lfg
             m_QueueStatusTimer += diff;
 
         LOG_DEBUG("lfg", "UPDATE UpdateQueueTimers");
-        for (Lfg5GuidsList::iterator it = CompatibleList.begin(); it != CompatibleList.end(); )
+        for (LfgCompatibleContainer::iterator it = CompatibleList.begin(); it != CompatibleList.end(); )
         {
-            Lfg5GuidsList::iterator itr = it++;
+            LfgCompatibleContainer::iterator itr = it++;
             if (itr->empty())
             {
                 LOG_DEBUG("lfg", "UpdateQueueTimers ERASE compatible");
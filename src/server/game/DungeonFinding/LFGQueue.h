@@ -19,6 +19,7 @@
 #define _LFGQUEUE_H
 
 #include "LFG.h"
+#include <bitset>
 
 namespace lfg
 {
@@ -35,6 +36,29 @@ namespace lfg
         LFG_COMPATIBLES_MATCH                                  // Must be the last one
     };
 
+    /**
+        Necessary conditions of CheckCompatibility, so most incompatible combinations are rejected
+        with a few bit operations instead of merging roles maps and dungeon sets.
+    */
+    struct LfgCompatibilityMask
+    {
+        // LFGDungeons.dbc ids fit, bigger ids disable the dungeon filter
+        static constexpr uint32 MAX_DUNGEON_BITS = 512;
+
+        LfgCompatibilityMask() = default;
+        LfgCompatibilityMask(LfgDungeonSet const& dungeonSet, LfgRolesMap const& rolesMap);
+
+        // Players and dungeons of both masks in one proposal
+        [[nodiscard]] LfgCompatibilityMask Combine(LfgCompatibilityMask const& other) const;
+
+        // False if both together have no role assignment or no common dungeon, true if they may have
+        [[nodiscard]] bool CanMatchWith(LfgCompatibilityMask const& other) const;
+
+        std::bitset<MAX_DUNGEON_BITS> dungeons;
+        bool bigDungeonIds{false};                             // Dungeons with an id >= MAX_DUNGEON_BITS are queued too
+        uint16 roles{0};                                       // Bit (tank * 8 + heal * 4 + dps) set for each role assignment the players can take, see LFGMgr::CheckGroupRoles
+    };
+
     // Stores player or group queue info
     struct LfgQueueData
     {
@@ -42,7 +66,7 @@ namespace lfg
 
         LfgQueueData(time_t _joinTime, LfgDungeonSet  _dungeons, LfgRolesMap  _roles):
             joinTime(_joinTime), lastRefreshTime(_joinTime), tanks(LFG_TANKS_NEEDED), healers(LFG_HEALERS_NEEDED),
-            dps(LFG_DPS_NEEDED), dungeons(std::move(_dungeons)), roles(std::move(_roles))
+            dps(LFG_DPS_NEEDED), dungeons(std::move(_dungeons)), roles(std::move(_roles)), compatibilityMask(dungeons, roles)
         { }
 
         time_t joinTime;                                       // Player queue join time (to calculate wait times)
@@ -53,6 +77,15 @@ namespace lfg
         LfgDungeonSet dungeons;                                // Selected Player/Group Dungeon/s
         LfgRolesMap roles;                                     // Selected Player Role/s
         Lfg5Guids bestCompatible;                              // Best compatible combination of people queued
+        LfgCompatibilityMask compatibilityMask;                // Precomputed from dungeons and roles
+    };
+
+    // Compatible combination of queued groups, with the mask of its members to check new groups against
+    struct LfgCompatible : public Lfg5Guids
+    {
+        LfgCompatible(Lfg5Guids const& key, LfgCompatibilityMask const& mask) : Lfg5Guids(key), compatibilityMask(mask) { }
+
+        LfgCompatibilityMask compatibilityMask;
     };
 
     struct LfgWaitTime
@@ -64,7 +97,7 @@ namespace lfg
 
     typedef std::map<uint32, LfgWaitTime> LfgWaitTimesContainer;
     typedef std::map<ObjectGuid, LfgQueueData> LfgQueueDataContainer;
-    typedef std::list<Lfg5Guids> LfgCompatibleContainer;
+    typedef std::list<LfgCompatible> LfgCompatibleContainer;
 
     /**
         Stores all data related to queue
@@ -2167,13 +2167,33 @@ void WorldObject::SendMessageToSet(WorldPacket const* data, bool self) const
 
 void WorldObject::SendMessageToSetInRange(WorldPacket const* data, float dist, bool /*self*/) const
 {
+    FlushQueuedMovement();
+
     Acore::MessageDistDeliverer notifier(this, data, dist);
     notifier.Visit(GetObjectVisibilityContainer().GetVisiblePlayersMap());
 }
 
 void WorldObject::SendMessageToSet(WorldPacket const* data, Player const* skipped_rcvr) const
 {
-    Acore::MessageDistDeliverer notifier(this, data, 0.0f, Acore::TeamFilter::All, skipped_rcvr);
+    FlushQueuedMovement();
+
+    Unit const* unit = ToUnit();
+    DeliverMessageToSet(data, skipped_rcvr, unit ? unit->m_relayedHeartbeatCount : 0);
+}
+
+void WorldObject::FlushQueuedMovement() const
+{
+    if (Map* map = FindMap())
+        map->FlushMovementRelay(this);
+}
+
+void WorldObject::DeliverMessageToSet(WorldPacket const* data, Player const* skipped_rcvr, uint32 heartbeatCount) const
+{
+    if (Player const* player = ToPlayer())
+        if (player != skipped_rcvr)
+            player->SendDirectMessage(data);
+
+    Acore::MessageDistDeliverer notifier(this, data, 0.0f, Acore::TeamFilter::All, skipped_rcvr, false, heartbeatCount);
     notifier.Visit(GetObjectVisibilityContainer().GetVisiblePlayersMap());
 }
 
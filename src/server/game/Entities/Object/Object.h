@@ -565,6 +565,10 @@ public:
     virtual void SendMessageToSet(WorldPacket const* data, bool self) const;
     virtual void SendMessageToSetInRange(WorldPacket const* data, float dist, bool self) const;
     virtual void SendMessageToSet(WorldPacket const* data, Player const* skipped_rcvr) const;
+    // SendMessageToSet with the heartbeat count the movement heartbeats are spread with, see Acore::MessageDistDeliverer
+    void DeliverMessageToSet(WorldPacket const* data, Player const* skipped_rcvr, uint32 heartbeatCount) const;
+    // Heartbeats of this object still queued by its map go out before anything else it sends to the set
+    void FlushQueuedMovement() const;
 
     virtual uint8 getLevelForTarget(WorldObject const* /*target*/) const { return 1; }
 
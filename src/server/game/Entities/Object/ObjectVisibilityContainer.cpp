@@ -74,7 +74,7 @@ void ObjectVisibilityContainer::LinkWorldObjectVisibility(WorldObject* worldObje
     if (!_visibleWorldObjectsMap)
         return;
 
-    (*_visibleWorldObjectsMap).insert(std::make_pair(worldObject->GetGUID(), worldObject));
+    (*_visibleWorldObjectsMap).insert(VisibleWorldObjectsMap::value_type(worldObject->GetGUID(), worldObject));
     worldObject->GetObjectVisibilityContainer().DirectInsertVisiblePlayerReference(_selfObject->ToPlayer());
 }
 
@@ -95,6 +95,19 @@ VisibleWorldObjectsMap::iterator ObjectVisibilityContainer::UnlinkVisibilityFrom
     return (*_visibleWorldObjectsMap).erase(itr);
 }
 
+void ObjectVisibilityContainer::UnlinkWorldObjectsVisibilityIf(std::function<bool(WorldObject*)> const& predicate)
+{
+    ASSERT(_visibleWorldObjectsMap); // Ensure we aren't for some reason calling this as a non-player object
+    (*_visibleWorldObjectsMap).erase_if([this, &predicate](VisibleWorldObjectsMap::value_type const& entry)
+    {
+        if (!predicate(entry.second))
+            return false;
+
+        entry.second->GetObjectVisibilityContainer().DirectRemoveVisiblePlayerReference(_selfObject->GetGUID());
+        return true;
+    });
+}
+
 VisiblePlayersMap::iterator ObjectVisibilityContainer::UnlinkVisibilityFromWorldObject(Player* player, VisiblePlayersMap::iterator itr)
 {
     player->GetObjectVisibilityContainer().DirectRemoveVisibilityReference(_selfObject->GetGUID());
@@ -109,7 +122,7 @@ void ObjectVisibilityContainer::DirectRemoveVisibilityReference(ObjectGuid guid)
 
 void ObjectVisibilityContainer::DirectInsertVisiblePlayerReference(Player* player)
 {
-    _visiblePlayersMap.insert(std::make_pair(player->GetGUID(), player));
+    _visiblePlayersMap.insert(VisiblePlayersMap::value_type(player->GetGUID(), player));
 }
 
 void ObjectVisibilityContainer::DirectRemoveVisiblePlayerReference(ObjectGuid guid)
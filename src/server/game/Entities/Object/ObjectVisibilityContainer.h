@@ -20,14 +20,178 @@
 
 #include "Common.h"
 #include "ObjectGuid.h"
+#include <algorithm>
+#include <functional>
 #include <memory>
-#include <unordered_map>
+#include <vector>
 
 class Player;
 class WorldObject;
 
-typedef std::unordered_map<ObjectGuid, WorldObject*> VisibleWorldObjectsMap;
-typedef std::unordered_map<ObjectGuid, Player*> VisiblePlayersMap;
+/*
+ * Guid to object map without per entry allocations.
+ * The entries are stored densely in a vector for iteration, an open addressing table
+ * (linear probing, at most half full) maps the guids to their position in that vector.
+ * Erasing moves the last entry into the hole, iterators are invalidated by insertions and erasures.
+ */
+template<class T>
+class FlatVisibilityMap
+{
+public:
+    typedef std::pair<ObjectGuid, T*> value_type;
+    typedef typename std::vector<value_type>::iterator iterator;
+    typedef typename std::vector<value_type>::const_iterator const_iterator;
+
+    iterator begin() { return _entries.begin(); }
+    iterator end() { return _entries.end(); }
+    const_iterator begin() const { return _entries.begin(); }
+    const_iterator end() const { return _entries.end(); }
+
+    [[nodiscard]] std::size_t size() const { return _entries.size(); }
+    [[nodiscard]] bool empty() const { return _entries.empty(); }
+
+    void clear()
+    {
+        _entries.clear();
+        std::fill(_slots.begin(), _slots.end(), EMPTY_SLOT);
+    }
+
+    iterator find(ObjectGuid guid)
+    {
+        std::size_t const slot = FindSlot(guid);
+        return slot != NOT_FOUND ? _entries.begin() + _slots[slot] : _entries.end();
+    }
+
+    const_iterator find(ObjectGuid guid) const
+    {
+        std::size_t const slot = FindSlot(guid);
+        return slot != NOT_FOUND ? _entries.begin() + _slots[slot] : _entries.end();
+    }
+
+    bool insert(value_type const& value)
+    {
+        if ((_entries.size() + 1) * 2 > _slots.size())
+            Rehash(std::max<std::size_t>(MIN_SLOTS, _slots.size() * 2));
+
+        std::size_t slot = HomeSlot(value.first);
+        for (; _slots[slot] != EMPTY_SLOT; slot = (slot + 1) & (_slots.size() - 1))
+            if (_entries[_slots[slot]].first == value.first)
+                return false;
+
+        _slots[slot] = uint32(_entries.size());
+        _entries.push_back(value);
+        return true;
+    }
+
+    std::size_t erase(ObjectGuid guid)
+    {
+        iterator itr = find(guid);
+        if (itr == end())
+            return 0;
+
+        erase(itr);
+        return 1;
+    }
+
+    // Returns the iterator to the next entry that was not visited yet
+    iterator erase(iterator itr)
+    {
+        std::size_t const index = itr - _entries.begin();
+        EraseSlot(FindSlot(itr->first));
+
+        if (index + 1 != _entries.size())
+        {
+            _entries[index] = _entries.back();
+            _slots[FindSlot(_entries[index].first)] = uint32(index);
+        }
+
+        _entries.pop_back();
+        return _entries.begin() + index;
+    }
+
+    // Erases every entry matching the predicate, the predicate is called once per entry in iteration order.
+    // All predicates are evaluated before anything is erased, so the predicate may look up this map.
+    template<class Predicate>
+    std::size_t erase_if(Predicate&& predicate)
+    {
+        std::vector<bool> matches(_entries.size());
+        for (std::size_t i = 0; i < _entries.size(); ++i)
+            matches[i] = predicate(_entries[i]);
+
+        std::size_t kept = 0;
+        for (std::size_t i = 0; i < _entries.size(); ++i)
+            if (!matches[i])
+                _entries[kept++] = _entries[i];
+
+        std::size_t const erased = _entries.size() - kept;
+        if (erased)
+        {
+            _entries.resize(kept);
+            Rehash(_slots.size());
+        }
+
+        return erased;
+    }
+
+private:
+    static constexpr uint32 EMPTY_SLOT = 0xFFFFFFFF;
+    static constexpr std::size_t NOT_FOUND = std::size_t(-1);
+    static constexpr std::size_t MIN_SLOTS = 16;
+
+    std::size_t HomeSlot(ObjectGuid guid) const
+    {
+        // Fibonacci hashing, the low bits of a guid are a plain counter
+        return std::size_t((guid.GetRawValue() * UI64LIT(0x9E3779B97F4A7C15)) >> 32) & (_slots.size() - 1);
+    }
+
+    std::size_t FindSlot(ObjectGuid guid) const
+    {
+        if (_slots.empty())
+            return NOT_FOUND;
+
+        for (std::size_t slot = HomeSlot(guid); _slots[slot] != EMPTY_SLOT; slot = (slot + 1) & (_slots.size() - 1))
+            if (_entries[_slots[slot]].first == guid)
+                return slot;
+
+        return NOT_FOUND;
+    }
+
+    // Backward shift deletion, keeps every probe sequence free of holes
+    void EraseSlot(std::size_t hole)
+    {
+        std::size_t const mask = _slots.size() - 1;
+        for (std::size_t next = (hole + 1) & mask; _slots[next] != EMPTY_SLOT; next = (next + 1) & mask)
+        {
+            std::size_t const home = HomeSlot(_entries[_slots[next]].first);
+            if (((next - home) & mask) >= ((next - hole) & mask))
+            {
+                _slots[hole] = _slots[next];
+                hole = next;
+            }
+        }
+
+        _slots[hole] = EMPTY_SLOT;
+    }
+
+    void Rehash(std::size_t slotCount)
+    {
+        _slots.assign(slotCount, EMPTY_SLOT);
+        for (std::size_t i = 0; i < _entries.size(); ++i)
+        {
+            std::size_t slot = HomeSlot(_entries[i].first);
+            while (_slots[slot] != EMPTY_SLOT)
+                slot = (slot + 1) & (slotCount - 1);
+
+            _slots[slot] = uint32(i);
+        }
+    }
+
+    std::vector<value_type> _entries;
+    std::vector<uint32> _slots;
+};
+
+typedef FlatVisibilityMap<WorldObject> VisibleWorldObjectsMap;
+typedef FlatVisibilityMap<Player> VisiblePlayersMap;
 
 // Class that manages the visibility containers of a worldobject
 class ObjectVisibilityContainer
@@ -48,6 +212,9 @@ public:
 
     // These helpers aren't ideal, but needed in a few spots for cleaning up references
     VisibleWorldObjectsMap::iterator UnlinkVisibilityFromPlayer(WorldObject* worldObject, VisibleWorldObjectsMap::iterator itr);
+    // Unlinks every visible worldobject matching the predicate in a single pass,
+    // the predicate may query but must not link or unlink worldobjects of this player
+    void UnlinkWorldObjectsVisibilityIf(std::function<bool(WorldObject*)> const& predicate);
     VisiblePlayersMap::iterator UnlinkVisibilityFromWorldObject(Player* player, VisiblePlayersMap::iterator itr);
 
     // Returns a list of all players who can see us
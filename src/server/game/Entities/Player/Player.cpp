@@ -286,6 +286,9 @@ Player::Player(WorldSession* session): Unit(), m_mover(this), _cinematicMgr(*thi
 
     m_mailsUpdated = false;
     unReadMails = 0;
+    m_mailItemsLoaded = false;
+    m_mailItemsUnloadTimer = 0;
+    m_mailMemoryUsage = 0;
     m_nextMailDelivereTime = time_t(0);
 
     m_resetTalentsCost = 0;
@@ -418,6 +421,7 @@ Player::Player(WorldSession* session): Unit(), m_mover(this), _cinematicMgr(*thi
     _wasOutdoor = true;
 
     GetObjectVisibilityContainer().InitForPlayer();
+    ResetVisibilityUpdateCell();
 
     sScriptMgr->OnConstructPlayer(this);
 
@@ -452,6 +456,8 @@ Player::~Player()
     for (ItemMap::iterator iter = mMitems.begin(); iter != mMitems.end(); ++iter)
         delete iter->second;                                //if item is duplicated... then server may crash ... but that item should be deallocated
 
+    RemoveMailMemoryMetric();
+
     delete PlayerTalkClass;
 
     for (std::size_t x = 0; x < ItemSetEff.size(); x++)
@@ -2321,6 +2327,8 @@ void Player::SetGMVisible(bool on)
         m_ExtraFlags |= PLAYER_EXTRA_GM_INVISIBLE;
         SetServerSideVisibility(SERVERSIDE_VISIBILITY_GM, GetSession()->GetSecurity());
     }
+
+    sWhoListCacheMgr->MarkDirty(GetGUID());
 }
 
 bool Player::IsGroupVisibleFor(Player const* p) const
@@ -4399,7 +4407,7 @@ void Player::DeleteFromDB(ObjectGuid::LowType lowGuid, uint32 accountId, bool up
             return;
     }
 
-    if (CharacterCacheEntry const* cache = sCharacterCache->GetCharacterCacheByGuid(playerGuid))
+    if (Optional<CharacterCacheEntry> cache = sCharacterCache->GetCharacterCacheByGuid(playerGuid))
     {
         std::string name = cache->Name;
         sCharacterCache->DeleteCharacterCacheEntry(playerGuid, name);
@@ -5074,6 +5082,12 @@ void Player::LeftChannel(Channel* c)
     m_channels.remove(c);
 }
 
+void Player::UpdateChannelIgnore(ObjectGuid ignored, bool ignore)
+{
+    for (Channel* channel : m_channels)
+        channel->UpdateIgnore(this, ignored, ignore);
+}
+
 void Player::CleanupChannels()
 {
     while (!m_channels.empty())
@@ -5833,6 +5847,8 @@ void Player::SendMessageToSet(WorldPacket const* data, bool self) const
 
 void Player::SendMessageToSetInRange(WorldPacket const* data, float dist, bool self) const
 {
+    FlushQueuedMovement();
+
     if (self)
         SendDirectMessage(data);
 
@@ -5842,11 +5858,9 @@ void Player::SendMessageToSetInRange(WorldPacket const* data, float dist, bool s
 
 void Player::SendMessageToSet(WorldPacket const* data, Player const* skipped_rcvr) const
 {
-    if (skipped_rcvr != this)
-        SendDirectMessage(data);
+    FlushQueuedMovement();
 
-    Acore::MessageDistDeliverer notifier(this, data, 0.0f, Acore::TeamFilter::All, skipped_rcvr);
-    notifier.Visit(GetObjectVisibilityContainer().GetVisiblePlayersMap());
+    DeliverMessageToSet(data, skipped_rcvr, m_relayedHeartbeatCount);
 }
 
 void Player::SendDirectMessage(WorldPacket const* data) const
@@ -15811,6 +15825,9 @@ void Player::SetIsSpectator(bool on)
             }
         }
     }
+
+    // spectators are listed in Dalaran
+    sWhoListCacheMgr->MarkDirty(GetGUID());
 }
 
 bool Player::NeedSendSpectatorData() const
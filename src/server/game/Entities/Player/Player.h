@@ -40,6 +40,7 @@
 #include "SpellInfo.h"
 #include "TradeData.h"
 #include "Unit.h"
+#include "WhoListCacheMgr.h"
 #include "WorldSession.h"
 #include <set>
 #include <string>
@@ -76,6 +77,9 @@ typedef void(*bgZoneRef)(Battleground*, WorldPackets::WorldState::InitWorldState
 #define DEATH_EXPIRE_STEP (5*MINUTE)
 #define MAX_DEATH_COUNT 3
 
+// Mailed items not used by the mail handlers for this long are released again
+#define MAIL_ITEMS_UNLOAD_DELAY (5*MINUTE*IN_MILLISECONDS)
+
 #define PLAYER_SKILL_INDEX(x)       (PLAYER_SKILL_INFO_1_1 + ((x)*3))
 #define PLAYER_SKILL_VALUE_INDEX(x) (PLAYER_SKILL_INDEX(x)+1)
 #define PLAYER_SKILL_BONUS_INDEX(x) (PLAYER_SKILL_INDEX(x)+2)
@@ -1707,6 +1711,16 @@ public:
         return mMitems.erase(itemLowGuid);
     }
 
+    /// Mailed items are created on first use by the mail list or an item take/return and released again after MAIL_ITEMS_UNLOAD_DELAY,
+    /// WorldSession::LoadMailedItems queries the CHAR_SEL_MAILITEMS result passed here
+    void LoadMailedItems(PreparedQueryResult result);
+    void UnloadMailedItems();
+    [[nodiscard]] bool IsMailedItemsLoaded() const { return m_mailItemsLoaded; }
+    [[nodiscard]] bool HasMailedItemsToLoad() const;
+    [[nodiscard]] std::size_t GetMailMemoryUsage() const;
+    void UpdateMailMemoryMetric();
+    void RemoveMailMemoryMetric();
+
     void PetSpellInitialize();
     void CharmSpellInitialize();
     void PossessSpellInitialize();
@@ -1920,6 +1934,7 @@ public:
         SetUInt32Value(PLAYER_GUILDID, GuildId);
         // xinef: update global storage
         sCharacterCache->UpdateCharacterGuildId(GetGUID(), GetGuildId());
+        sWhoListCacheMgr->MarkDirty(GetGUID());
     }
     void SetRank(uint8 rankId) { SetUInt32Value(PLAYER_GUILDRANK, rankId); }
     [[nodiscard]] uint8 GetRank() const { return uint8(GetUInt32Value(PLAYER_GUILDRANK)); }
@@ -2094,6 +2109,7 @@ public:
 
     void JoinedChannel(Channel* c);
     void LeftChannel(Channel* c);
+    void UpdateChannelIgnore(ObjectGuid ignored, bool ignore);
     void CleanupChannels();
     void ClearChannelWatch();
     void UpdateLFGChannel();
@@ -2428,6 +2444,14 @@ public:
     // currently visible objects at player client
     std::vector<Unit*> m_newVisible; // pussywizard
 
+    // sight position cell, time and visibility state of the last full visibility update
+    CellCoord m_visibilityUpdateCell;
+    uint32 m_visibilityUpdateTime;
+    uint32 m_visibilityUpdatePhaseMask;
+    ObjectGuid m_visibilityUpdateGroup;
+    int32 m_visibilityUpdateGMVisibility;
+    int32 m_visibilityUpdateGMDetect;
+
     [[nodiscard]] bool HaveAtClient(WorldObject const* u) const;
     [[nodiscard]] bool HaveAtClient(ObjectGuid guid) const;
 
@@ -2438,6 +2462,9 @@ public:
     void GetInitialVisiblePackets(Unit* target);
     void UpdateObjectVisibility(bool forced = true, bool fromUpdate = false) override;
     void UpdateVisibilityForPlayer(bool mapChange = false);
+    [[nodiscard]] bool CanUpdateVisibilityIncrementally() const;
+    void SetVisibilityUpdateCell();
+    void ResetVisibilityUpdateCell();
     void UpdateVisibilityOf(WorldObject* target);
     void UpdateTriggerVisibility();
 
@@ -2921,6 +2948,10 @@ protected:
     uint32 m_drunkTimer;
     uint32 m_weaponChangeTimer;
 
+    bool m_mailItemsLoaded;
+    uint32 m_mailItemsUnloadTimer;
+    std::size_t m_mailMemoryUsage;
+
     uint32 m_zoneUpdateId;
     uint32 m_zoneUpdateTimer;
     uint32 m_areaUpdateId;
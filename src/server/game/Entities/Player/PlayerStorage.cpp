@@ -42,6 +42,7 @@
 #include "LootItemStorage.h"
 #include "MailMgr.h"
 #include "MapMgr.h"
+#include "Metric.h"
 #include "ObjectAccessor.h"
 #include "ObjectMgr.h"
 #include "Opcodes.h"
@@ -67,6 +68,7 @@
 #include "Util.h"
 #include "World.h"
 #include "WorldPacket.h"
+#include <atomic>
 
 /// @todo: this import is not necessary for compilation and marked as unused by the IDE
 //  however, for some reasons removing it would cause a damn linking issue
@@ -6233,15 +6235,13 @@ Item* Player::_LoadMailedItem(ObjectGuid const& playerGuid, Player* player, uint
     }
 
     // Rehydrate looters for BoP-tradeable mail items; only the LFG mail path writes this flag, gated on the same config.
+    // The looters come with the CHAR_SEL_MAILITEMS row, no query per item
     if (item->IsBOPTradable() && sWorld->getBoolConfig(CONFIG_SET_BOP_ITEM_TRADEABLE))
     {
-        CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_ITEM_BOP_TRADE);
-        stmt->SetData(0, item->GetGUID().GetCounter());
-
-        if (PreparedQueryResult result = CharacterDatabase.Query(stmt))
+        if (!fields[15].IsNull())
         {
             AllowedLooterSet looters;
-            for (std::string_view guidStr : Acore::Tokenize((*result)[0].Get<std::string_view>(), ' ', false))
+            for (std::string_view guidStr : Acore::Tokenize(fields[15].Get<std::string_view>(), ' ', false))
             {
                 if (Optional<ObjectGuid::LowType> guid = Acore::StringTo<ObjectGuid::LowType>(guidStr))
                     looters.insert(ObjectGuid::Create<HighGuid::Player>(*guid));
@@ -6330,17 +6330,151 @@ void Player::_LoadMail(PreparedQueryResult mailsResult, PreparedQueryResult mail
         } while (mailsResult->NextRow());
     }
 
+    // Only which item is attached to which mail, the items themselves are loaded by LoadMailedItems
     if (mailItemsResult)
     {
         do
         {
             Field* fields = mailItemsResult->Fetch();
-            uint32 mailId = fields[14].Get<uint32>();
-            _LoadMailedItem(GetGUID(), this, mailId, mailById[mailId], fields);
+            std::unordered_map<uint32, Mail*>::const_iterator itr = mailById.find(fields[0].Get<uint32>());
+            if (itr != mailById.end())
+                itr->second->AddItem(fields[1].Get<uint32>(), fields[2].Get<uint32>());
         } while (mailItemsResult->NextRow());
     }
 
     UpdateNextMailTimeAndUnreads();
+    UpdateMailMemoryMetric();
+}
+
+// Players are updated on map threads, the mailed items may be released there
+static std::atomic<int64> MailMemoryUsageTotal = 0;
+static std::atomic<int32> MailedItemsLoadedPlayers = 0;
+
+bool Player::HasMailedItemsToLoad() const
+{
+    if (m_mailItemsLoaded)
+        return false;
+
+    // Items delivered while online are already there
+    for (Mail const* mail : m_mail)
+    {
+        if (mail->state == MAIL_STATE_DELETED)
+            continue;
+
+        for (MailItemInfo const& itemInfo : mail->items)
+            if (!mMitems.contains(itemInfo.item_guid))
+                return true;
+    }
+
+    return false;
+}
+
+void Player::LoadMailedItems(PreparedQueryResult result)
+{
+    m_mailItemsUnloadTimer = MAIL_ITEMS_UNLOAD_DELAY;
+
+    // Already loaded by an earlier request while this query was pending
+    if (m_mailItemsLoaded)
+        return;
+
+    m_mailItemsLoaded = true;
+    ++MailedItemsLoadedPlayers;
+
+    std::unordered_map<ObjectGuid::LowType, Mail*> missingItems;
+    for (Mail* mail : m_mail)
+    {
+        if (mail->state == MAIL_STATE_DELETED)
+            continue;
+
+        for (MailItemInfo const& itemInfo : mail->items)
+            if (!GetMItem(itemInfo.item_guid))
+                missingItems[itemInfo.item_guid] = mail;
+    }
+
+    if (missingItems.empty())
+    {
+        UpdateMailMemoryMetric();
+        return;
+    }
+
+    if (result)
+    {
+        do
+        {
+            Field* fields = result->Fetch();
+            uint32 mailId = fields[14].Get<uint32>();
+
+            // Rows of items taken or returned since, whose deletion is not saved yet
+            std::unordered_map<ObjectGuid::LowType, Mail*>::iterator itr = missingItems.find(fields[11].Get<uint32>());
+            if (itr == missingItems.end() || itr->second->messageID != mailId)
+                continue;
+
+            // Invalid items are deleted from the mail by _LoadMailedItem, drop them from the headers as well
+            if (!_LoadMailedItem(GetGUID(), this, mailId, nullptr, fields))
+                continue;
+
+            missingItems.erase(itr);
+        } while (result->NextRow());
+    }
+
+    for (auto const& [itemGuid, mail] : missingItems)
+        mail->RemoveItem(itemGuid);
+
+    UpdateMailMemoryMetric();
+}
+
+void Player::UnloadMailedItems()
+{
+    // Items with unsaved changes stay until the next attempt
+    for (ItemMap::value_type const& itemPair : mMitems)
+    {
+        if (itemPair.second->GetState() != ITEM_UNCHANGED)
+        {
+            m_mailItemsUnloadTimer = MAIL_ITEMS_UNLOAD_DELAY;
+            return;
+        }
+    }
+
+    for (ItemMap::value_type const& itemPair : mMitems)
+        delete itemPair.second;
+
+    mMitems.clear();
+    m_mailItemsLoaded = false;
+    --MailedItemsLoadedPlayers;
+
+    UpdateMailMemoryMetric();
+}
+
+std::size_t Player::GetMailMemoryUsage() const
+{
+    std::size_t size = 0;
+    for (Mail const* mail : m_mail)
+        size += sizeof(Mail) + mail->subject.capacity() + mail->body.capacity() + mail->items.capacity() * sizeof(MailItemInfo) + mail->removedItems.capacity() * sizeof(uint32);
+
+    for (ItemMap::value_type const& itemPair : mMitems)
+        size += (itemPair.second->IsBag() ? sizeof(Bag) : sizeof(Item)) + itemPair.second->GetValuesCount() * sizeof(uint32);
+
+    return size;
+}
+
+// Reported as totals over all players, one series per character would not scale
+void Player::UpdateMailMemoryMetric()
+{
+    std::size_t const usage = GetMailMemoryUsage();
+    int64 const total = MailMemoryUsageTotal += int64(usage) - int64(m_mailMemoryUsage);
+    m_mailMemoryUsage = usage;
+
+    METRIC_VALUE("player_mail_memory", uint64(std::max<int64>(total, 0)));
+    METRIC_VALUE("player_mail_items_loaded", uint64(std::max<int32>(MailedItemsLoadedPlayers.load(), 0)));
+}
+
+void Player::RemoveMailMemoryMetric()
+{
+    MailMemoryUsageTotal -= int64(m_mailMemoryUsage);
+    m_mailMemoryUsage = 0;
+
+    if (m_mailItemsLoaded)
+        --MailedItemsLoadedPlayers;
 }
 
 void Player::LoadPet()
@@ -318,6 +318,14 @@ void Player::Update(uint32 p_time)
     if (m_deathState == DeathState::JustDied)
         KillPlayer();
 
+    if (m_mailItemsLoaded)
+    {
+        if (p_time >= m_mailItemsUnloadTimer)
+            UnloadMailedItems();
+        else
+            m_mailItemsUnloadTimer -= p_time;
+    }
+
     if (m_nextSave)
     {
         if (p_time >= m_nextSave)
@@ -1271,6 +1279,8 @@ void Player::UpdateZone(uint32 newZone, uint32 newArea, bool force)
                                       // just area change, works strange...
         if (Guild* guild = GetGuild())
             guild->UpdateMemberData(this, GUILD_MEMBER_DATA_ZONEID, newZone);
+
+        sWhoListCacheMgr->MarkDirty(GetGUID());
     }
 
     GetMap()->UpdatePlayerZoneStats(m_zoneUpdateId, newZone);
@@ -1612,7 +1622,58 @@ void Player::UpdateVisibilityForPlayer(bool mapChange)
     notifier.SendToSelf();
 
     if (mapChange)
+    {
         m_last_notify_position.Relocate(-5000.0f, -5000.0f, -5000.0f, 0.0f);
+        ResetVisibilityUpdateCell();
+    }
+}
+
+static ObjectGuid GetVisibilityGroupGuid(Player const* player)
+{
+    Group const* group = player->GetGroup();
+    return group ? group->GetGUID() : ObjectGuid::Empty;
+}
+
+bool Player::CanUpdateVisibilityIncrementally() const
+{
+    if (!sWorld->getBoolConfig(CONFIG_VISIBILITY_INCREMENTAL_UPDATE))
+        return false;
+
+    // Far sight depends on the orientation and ghosts see through their corpse
+    if (GetFarSightDistance() || isDead())
+        return false;
+
+    if (GetMSTimeDiffToNow(m_visibilityUpdateTime) >= sWorld->getIntConfig(CONFIG_VISIBILITY_FULL_UPDATE_INTERVAL))
+        return false;
+
+    // Phase, group and GM visibility changes keep the player in place but change what is seen from both sides
+    if (GetPhaseMask() != m_visibilityUpdatePhaseMask || GetVisibilityGroupGuid(this) != m_visibilityUpdateGroup
+        || m_serverSideVisibility.GetValue(SERVERSIDE_VISIBILITY_GM) != m_visibilityUpdateGMVisibility
+        || m_serverSideVisibilityDetect.GetValue(SERVERSIDE_VISIBILITY_GM) != m_visibilityUpdateGMDetect)
+        return false;
+
+    return Acore::ComputeCellCoord(GetSightPosition().GetPositionX(), GetSightPosition().GetPositionY()) == m_visibilityUpdateCell;
+}
+
+void Player::SetVisibilityUpdateCell()
+{
+    m_visibilityUpdateCell = Acore::ComputeCellCoord(GetSightPosition().GetPositionX(), GetSightPosition().GetPositionY());
+    m_visibilityUpdateTime = getMSTime();
+    m_visibilityUpdatePhaseMask = GetPhaseMask();
+    m_visibilityUpdateGroup = GetVisibilityGroupGuid(this);
+    m_visibilityUpdateGMVisibility = m_serverSideVisibility.GetValue(SERVERSIDE_VISIBILITY_GM);
+    m_visibilityUpdateGMDetect = m_serverSideVisibilityDetect.GetValue(SERVERSIDE_VISIBILITY_GM);
+}
+
+void Player::ResetVisibilityUpdateCell()
+{
+    // Never matches a valid cell
+    m_visibilityUpdateCell = CellCoord(TOTAL_NUMBER_OF_CELLS_PER_MAP, TOTAL_NUMBER_OF_CELLS_PER_MAP);
+    m_visibilityUpdateTime = 0;
+    m_visibilityUpdatePhaseMask = 0;
+    m_visibilityUpdateGroup.Clear();
+    m_visibilityUpdateGMVisibility = 0;
+    m_visibilityUpdateGMDetect = 0;
 }
 
 void Player::UpdateObjectVisibility(bool forced, bool fromUpdate)
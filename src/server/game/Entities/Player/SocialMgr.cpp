@@ -196,6 +196,16 @@ bool PlayerSocial::HasIgnore(ObjectGuid const& ignore_guid) const
     return _checkContact(ignore_guid, SOCIAL_FLAG_IGNORED);
 }
 
+GuidVector PlayerSocial::GetIgnoredGuids() const
+{
+    GuidVector ignores;
+    for (auto const& itr : m_playerSocialMap)
+        if (itr.second.Flags & SOCIAL_FLAG_IGNORED)
+            ignores.push_back(itr.first);
+
+    return ignores;
+}
+
 SocialMgr::SocialMgr()
 {
 }
@@ -115,6 +115,7 @@ class PlayerSocial
         ObjectGuid const& GetPlayerGUID() const { return m_playerGUID; }
         void SetPlayerGUID(ObjectGuid const& guid) { m_playerGUID = guid; }
         uint32 GetNumberOfSocialsWithFlag(SocialFlag flag) const;
+        GuidVector GetIgnoredGuids() const;
     private:
         bool _checkContact(ObjectGuid const& guid, SocialFlag flags) const;
         typedef std::map<ObjectGuid, FriendInfo> PlayerSocialMap;
@@ -439,6 +439,7 @@ Unit::Unit() : WorldObject(),
     m_delayed_unit_relocation_timer = 0;
     m_delayed_unit_ai_notify_timer = 0;
     bRequestForcedVisibilityUpdate = false;
+    m_relayedHeartbeatCount = 0;
 
     m_applyResilience = false;
     _instantCast = false;
@@ -12322,6 +12323,7 @@ void Unit::SetLevel(uint8 lvl, bool showLevelChange)
     if (IsPlayer())
     {
         sCharacterCache->UpdateCharacterLevel(GetGUID(), lvl);
+        sWhoListCacheMgr->MarkDirty(GetGUID());
     }
 }
 
@@ -16382,7 +16384,7 @@ void Unit::ExecuteDelayedUnitRelocationEvent()
 
         GetMap()->LoadGridsInRange(*player, MAX_VISIBILITY_DISTANCE);
 
-        Acore::PlayerRelocationNotifier notifier(*player);
+        Acore::PlayerRelocationNotifier notifier(*player, player->CanUpdateVisibilityIncrementally());
         Cell::VisitObjects(player->GetSightPosition().GetPositionX(), player->GetSightPosition().GetPositionY(), player->GetMap(), notifier, player->GetSightRange());
         Cell::VisitFarVisibleObjects(player->GetSightPosition().GetPositionX(), player->GetSightPosition().GetPositionY(), player->GetMap(), notifier, VISIBILITY_DISTANCE_GIGANTIC);
         notifier.SendToSelf();
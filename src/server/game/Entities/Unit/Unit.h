@@ -2109,6 +2109,9 @@ public:
     uint16 m_delayed_unit_ai_notify_timer;
     bool bRequestForcedVisibilityUpdate;
 
+    // Movement heartbeats relayed to other players, see Acore::MessageDistDeliverer
+    uint32 m_relayedHeartbeatCount;
+
     // Movement info
     Movement::MoveSpline* movespline;
 
@@ -39,6 +39,7 @@ void HashMapHolder<T>::Insert(T* o)
     std::unique_lock<std::shared_mutex> lock(*GetLock());
 
     GetContainer()[o->GetGUID()] = o;
+    GetIndex().Insert(o->GetGUID().GetRawValue(), o);
 }
 
 template<class T>
@@ -47,15 +48,16 @@ void HashMapHolder<T>::Remove(T* o)
     std::unique_lock<std::shared_mutex> lock(*GetLock());
 
     GetContainer().erase(o->GetGUID());
+    GetIndex().Remove(o->GetGUID().GetRawValue());
 }
 
 template<class T>
 T* HashMapHolder<T>::Find(ObjectGuid guid)
 {
-    std::shared_lock<std::shared_mutex> lock(*GetLock());
+    if (!guid)
+        return nullptr;
 
-    typename MapType::iterator itr = GetContainer().find(guid);
-    return (itr != GetContainer().end()) ? itr->second : nullptr;
+    return GetIndex().Find(guid.GetRawValue());
 }
 
 template<class T>
@@ -72,6 +74,13 @@ std::shared_mutex* HashMapHolder<T>::GetLock()
     return &_lock;
 }
 
+template<class T>
+Acore::ConcurrentPointerMap<T>& HashMapHolder<T>::GetIndex()
+{
+    static Acore::ConcurrentPointerMap<T> _index;
+    return _index;
+}
+
 HashMapHolder<Player>::MapType const& ObjectAccessor::GetPlayers()
 {
     return HashMapHolder<Player>::GetContainer();
@@ -82,7 +91,38 @@ template class HashMapHolder<MotionTransport>;
 
 namespace PlayerNameMapHolder
 {
-    typedef std::unordered_map<std::string, Player*> MapType;
+    // Names are stored normalized, ASCII letters of a looked up name match in any case
+    constexpr char AsciiToLower(char c)
+    {
+        return (c >= 'A' && c <= 'Z') ? char(c - 'A' + 'a') : c;
+    }
+
+    struct NameHash
+    {
+        using is_transparent = void;
+
+        std::size_t operator()(std::string_view name) const
+        {
+            std::size_t hash = 14695981039346656037ull;
+            for (char c : name)
+                hash = (hash ^ uint8(AsciiToLower(c))) * 1099511628211ull;
+
+            return hash;
+        }
+    };
+
+    struct NameEqual
+    {
+        using is_transparent = void;
+
+        bool operator()(std::string_view left, std::string_view right) const
+        {
+            return left.size() == right.size() && std::equal(left.begin(), left.end(), right.begin(),
+                [](char l, char r) { return AsciiToLower(l) == AsciiToLower(r); });
+        }
+    };
+
+    typedef std::unordered_map<std::string, Player*, NameHash, NameEqual> MapType;
     static MapType PlayerNameMap;
 
     void Insert(Player* p)
@@ -102,11 +142,19 @@ namespace PlayerNameMapHolder
 
     Player* Find(std::string const& name)
     {
+        auto itr = PlayerNameMap.find(std::string_view(name));
+        if (itr != PlayerNameMap.end())
+            return itr->second;
+
+        // Only letters outside of ASCII need the full normalization to match
+        if (std::all_of(name.begin(), name.end(), [](char c) { return uint8(c) < 0x80; }))
+            return nullptr;
+
         std::string charName(name);
         if (!normalizePlayerName(charName))
             return nullptr;
 
-        auto itr = PlayerNameMap.find(charName);
+        itr = PlayerNameMap.find(charName);
         return (itr != PlayerNameMap.end()) ? itr->second : nullptr;
     }
 
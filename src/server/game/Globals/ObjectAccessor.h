@@ -18,6 +18,7 @@
 #ifndef ACORE_OBJECTACCESSOR_H
 #define ACORE_OBJECTACCESSOR_H
 
+#include "ConcurrentPointerMap.h"
 #include "Define.h"
 #include "GridDefines.h"
 #include "Object.h"
@@ -50,11 +51,16 @@ public:
 
     static void Remove(T* o);
 
+    // Lock-free, does not take GetLock()
     static T* Find(ObjectGuid guid);
 
     static MapType& GetContainer();
 
     static std::shared_mutex* GetLock();
+
+private:
+    // Lookup index for Find, updated together with the container under the exclusive lock
+    static Acore::ConcurrentPointerMap<T>& GetIndex();
 };
 
 namespace ObjectAccessor
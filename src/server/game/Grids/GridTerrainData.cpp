@@ -3,32 +3,113 @@
 #include "GridTerrainData.h"
 #include "Log.h"
 #include "MapDefines.h"
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+#include <cstring>
 #include <filesystem>
+#include <fstream>
 #include <G3D/Ray.h>
 
 uint16 const holetab_h[4] = { 0x1111, 0x2222, 0x4444, 0x8888 };
 uint16 const holetab_v[4] = { 0x000F, 0x00F0, 0x0F00, 0xF000 };
 
+// Bounds checked access to the map file contents, arrays are returned in place when their alignment allows it
+class GridTerrainData::FileReader
+{
+public:
+    FileReader(GridTerrainData& owner, char const* data, std::size_t size) : _owner(owner), _data(data), _size(size), _position(0) { }
+
+    void Seek(uint32 offset) { _position = offset; }
+
+    template<typename T>
+    bool Read(T& value)
+    {
+        if (_position + sizeof(T) > _size)
+            return false;
+
+        std::memcpy(&value, _data + _position, sizeof(T));
+        _position += sizeof(T);
+        return true;
+    }
+
+    template<typename T>
+    T const* ReadArray(std::size_t count)
+    {
+        std::size_t const bytes = count * sizeof(T);
+        if (_position + bytes > _size)
+            return nullptr;
+
+        char const* source = _data + _position;
+        _position += bytes;
+
+        if (reinterpret_cast<std::uintptr_t>(source) % alignof(T) == 0)
+            return reinterpret_cast<T const*>(source);
+
+        std::unique_ptr<uint32[]>& copy = _owner._alignedCopies.emplace_back(std::make_unique<uint32[]>((bytes + sizeof(uint32) - 1) / sizeof(uint32)));
+        std::memcpy(copy.get(), source, bytes);
+        return reinterpret_cast<T const*>(copy.get());
+    }
+
+private:
+    GridTerrainData& _owner;
+    char const* _data;
+    std::size_t _size;
+    std::size_t _position;
+};
+
 GridTerrainData::GridTerrainData()
 {
     _gridGetHeight = &GridTerrainData::getHeightFromFlat;
 }
 
-TerrainMapDataReadResult GridTerrainData::Load(std::string const& mapFileName)
+GridTerrainData::~GridTerrainData() = default;
+
+TerrainMapDataReadResult GridTerrainData::Load(std::string const& mapFileName, bool memoryMapped)
 {
     // Check if file exists, we do this first as we need to
     // differentiate between file existing and any other file errors
     if (!std::filesystem::exists(mapFileName))
         return TerrainMapDataReadResult::NotFound;
 
-    // Start the input stream and check for any errors
-    std::ifstream fileStream(mapFileName, std::ios::binary);
-    if (fileStream.fail())
-        return TerrainMapDataReadResult::ReadError;
+    char const* data = nullptr;
+    std::size_t size = 0;
+
+    if (memoryMapped)
+    {
+        try
+        {
+            boost::interprocess::file_mapping file(mapFileName.c_str(), boost::interprocess::read_only);
+            _fileImage = std::make_unique<boost::interprocess::mapped_region>(file, boost::interprocess::read_only);
+        }
+        catch (boost::interprocess::interprocess_exception const&)
+        {
+            return TerrainMapDataReadResult::ReadError;
+        }
+
+        data = static_cast<char const*>(_fileImage->get_address());
+        size = _fileImage->get_size();
+    }
+    else
+    {
+        // Start the input stream and check for any errors
+        std::ifstream fileStream(mapFileName, std::ios::binary | std::ios::ate);
+        if (fileStream.fail())
+            return TerrainMapDataReadResult::ReadError;
+
+        size = std::size_t(fileStream.tellg());
+        _fileBuffer = std::make_unique<char[]>(size);
+        fileStream.seekg(0);
+        if (!fileStream.read(_fileBuffer.get(), size))
+            return TerrainMapDataReadResult::ReadError;
+
+        data = _fileBuffer.get();
+    }
+
+    FileReader reader(*this, data, size);
 
     // Read the map header
     map_fileheader header;
-    if (!fileStream.read(reinterpret_cast<char*>(&header), sizeof(header)))
+    if (!reader.Read(header))
         return TerrainMapDataReadResult::ReadError;
 
     // Check for valid map and version magics
@@ -36,49 +117,49 @@ TerrainMapDataReadResult GridTerrainData::Load(std::string const& mapFileName)
         return TerrainMapDataReadResult::InvalidMagic;
 
     // Load area data
-    if (header.areaMapOffset && !LoadAreaData(fileStream, header.areaMapOffset))
+    if (header.areaMapOffset && !LoadAreaData(reader, header.areaMapOffset))
         return TerrainMapDataReadResult::InvalidAreaData;
 
     // Load height data
-    if (header.heightMapOffset && !LoadHeightData(fileStream, header.heightMapOffset))
+    if (header.heightMapOffset && !LoadHeightData(reader, header.heightMapOffset))
         return TerrainMapDataReadResult::InvalidHeightData;
 
     // Load liquid data
-    if (header.liquidMapOffset && !LoadLiquidData(fileStream, header.liquidMapOffset))
+    if (header.liquidMapOffset && !LoadLiquidData(reader, header.liquidMapOffset))
         return TerrainMapDataReadResult::InvalidLiquidData;
 
     // Load hole data
-    if (header.holesSize && !LoadHolesData(fileStream, header.holesOffset))
+    if (header.holesSize && !LoadHolesData(reader, header.holesOffset))
         return TerrainMapDataReadResult::InvalidHoleData;
 
     return TerrainMapDataReadResult::Success;
 }
 
-bool GridTerrainData::LoadAreaData(std::ifstream& fileStream, uint32 const offset)
+bool GridTerrainData::LoadAreaData(FileReader& reader, uint32 const offset)
 {
-    fileStream.seekg(offset);
+    reader.Seek(offset);
 
     map_areaHeader header;
-    if (!fileStream.read(reinterpret_cast<char*>(&header), sizeof(header)) || header.fourcc != MapAreaMagic.asUInt)
+    if (!reader.Read(header) || header.fourcc != MapAreaMagic.asUInt)
         return false;
 
     _loadedAreaData = std::make_unique<LoadedAreaData>();
     _loadedAreaData->gridArea = header.gridArea;
     if (!(header.flags & MAP_AREA_NO_AREA))
     {
-        _loadedAreaData->areaMap = std::make_unique<LoadedAreaData::AreaMapType>();
-        if (!fileStream.read(reinterpret_cast<char*>(_loadedAreaData->areaMap.get()), sizeof(LoadedAreaData::AreaMapType)))
+        _loadedAreaData->areaMap = reader.ReadArray<LoadedAreaData::AreaMapType>(1);
+        if (!_loadedAreaData->areaMap)
             return false;
     }
     return true;
 }
 
-bool GridTerrainData::LoadHeightData(std::ifstream& fileStream, uint32 const offset)
+bool GridTerrainData::LoadHeightData(FileReader& reader, uint32 const offset)
 {
-    fileStream.seekg(offset);
+    reader.Seek(offset);
 
     map_heightHeader header;
-    if (!fileStream.read(reinterpret_cast<char*>(&header), sizeof(header)) || header.fourcc != MapHeightMagic.asUInt)
+    if (!reader.Read(header) || header.fourcc != MapHeightMagic.asUInt)
         return false;
 
     _loadedHeightData = std::make_unique<LoadedHeightData>();
@@ -88,8 +169,9 @@ bool GridTerrainData::LoadHeightData(std::ifstream& fileStream, uint32 const off
         if ((header.flags & MAP_HEIGHT_AS_INT16))
         {
             _loadedHeightData->uint16HeightData = std::make_unique<LoadedHeightData::Uint16HeightData>();
-            if (!fileStream.read(reinterpret_cast<char*>(&_loadedHeightData->uint16HeightData->v9), sizeof(_loadedHeightData->uint16HeightData->v9))
-                || !fileStream.read(reinterpret_cast<char*>(&_loadedHeightData->uint16HeightData->v8), sizeof(_loadedHeightData->uint16HeightData->v8)))
+            _loadedHeightData->uint16HeightData->v9 = reader.ReadArray<uint16>(129 * 129);
+            _loadedHeightData->uint16HeightData->v8 = reader.ReadArray<uint16>(128 * 128);
+            if (!_loadedHeightData->uint16HeightData->v9 || !_loadedHeightData->uint16HeightData->v8)
                 return false;
 
             _loadedHeightData->uint16HeightData->gridIntHeightMultiplier = (header.gridMaxHeight - header.gridHeight) / 65535;
@@ -98,8 +180,9 @@ bool GridTerrainData::LoadHeightData(std::ifstream& fileStream, uint32 const off
         else if ((header.flags & MAP_HEIGHT_AS_INT8))
         {
             _loadedHeightData->uint8HeightData = std::make_unique<LoadedHeightData::Uint8HeightData>();
-            if (!fileStream.read(reinterpret_cast<char*>(&_loadedHeightData->uint8HeightData->v9), sizeof(_loadedHeightData->uint8HeightData->v9))
-                || !fileStream.read(reinterpret_cast<char*>(&_loadedHeightData->uint8HeightData->v8), sizeof(_loadedHeightData->uint8HeightData->v8)))
+            _loadedHeightData->uint8HeightData->v9 = reader.ReadArray<uint8>(129 * 129);
+            _loadedHeightData->uint8HeightData->v8 = reader.ReadArray<uint8>(128 * 128);
+            if (!_loadedHeightData->uint8HeightData->v9 || !_loadedHeightData->uint8HeightData->v8)
                 return false;
 
             _loadedHeightData->uint8HeightData->gridIntHeightMultiplier = (header.gridMaxHeight - header.gridHeight) / 255;
@@ -108,8 +191,9 @@ bool GridTerrainData::LoadHeightData(std::ifstream& fileStream, uint32 const off
         else
         {
             _loadedHeightData->floatHeightData = std::make_unique<LoadedHeightData::FloatHeightData>();
-            if (!fileStream.read(reinterpret_cast<char*>(&_loadedHeightData->floatHeightData->v9), sizeof(_loadedHeightData->floatHeightData->v9))
-                || !fileStream.read(reinterpret_cast<char*>(&_loadedHeightData->floatHeightData->v8), sizeof(_loadedHeightData->floatHeightData->v8)))
+            _loadedHeightData->floatHeightData->v9 = reader.ReadArray<float>(129 * 129);
+            _loadedHeightData->floatHeightData->v8 = reader.ReadArray<float>(128 * 128);
+            if (!_loadedHeightData->floatHeightData->v9 || !_loadedHeightData->floatHeightData->v8)
                 return false;
 
             _gridGetHeight = &GridTerrainData::getHeightFromFloat;
@@ -122,8 +206,7 @@ bool GridTerrainData::LoadHeightData(std::ifstream& fileStream, uint32 const off
     {
         std::array<int16, 9> maxHeights;
         std::array<int16, 9> minHeights;
-        if (!fileStream.read(reinterpret_cast<char*>(maxHeights.data()), sizeof(maxHeights)) ||
-            !fileStream.read(reinterpret_cast<char*>(minHeights.data()), sizeof(minHeights)))
+        if (!reader.Read(maxHeights) || !reader.Read(minHeights))
             return false;
 
         static uint32 constexpr indices[8][3] =
@@ -163,12 +246,12 @@ bool GridTerrainData::LoadHeightData(std::ifstream& fileStream, uint32 const off
     return true;
 }
 
-bool GridTerrainData::LoadLiquidData(std::ifstream& fileStream, uint32 const offset)
+bool GridTerrainData::LoadLiquidData(FileReader& reader, uint32 const offset)
 {
-    fileStream.seekg(offset);
+    reader.Seek(offset);
 
     map_liquidHeader header;
-    if (!fileStream.read(reinterpret_cast<char*>(&header), sizeof(header)) || header.fourcc != MapLiquidMagic.asUInt)
+    if (!reader.Read(header) || header.fourcc != MapLiquidMagic.asUInt)
         return false;
 
     _loadedLiquidData = std::make_unique<LoadedLiquidData>();
@@ -182,30 +265,30 @@ bool GridTerrainData::LoadLiquidData(std::ifstream& fileStream, uint32 const off
 
     if (!(header.flags & MAP_LIQUID_NO_TYPE))
     {
-        _loadedLiquidData->liquidEntry = std::make_unique<LoadedLiquidData::LiquidEntryType>();
-        if (!fileStream.read(reinterpret_cast<char*>(_loadedLiquidData->liquidEntry.get()), sizeof(LoadedLiquidData::LiquidEntryType)))
+        _loadedLiquidData->liquidEntry = reader.ReadArray<LoadedLiquidData::LiquidEntryType>(1);
+        if (!_loadedLiquidData->liquidEntry)
             return false;
 
-        _loadedLiquidData->liquidFlags = std::make_unique<LoadedLiquidData::LiquidFlagsType>();
-        if (!fileStream.read(reinterpret_cast<char*>(_loadedLiquidData->liquidFlags.get()), sizeof(LoadedLiquidData::LiquidFlagsType)))
+        _loadedLiquidData->liquidFlags = reader.ReadArray<LoadedLiquidData::LiquidFlagsType>(1);
+        if (!_loadedLiquidData->liquidFlags)
             return false;
     }
     if (!(header.flags & MAP_LIQUID_NO_HEIGHT))
     {
-        _loadedLiquidData->liquidMap = std::make_unique<LoadedLiquidData::LiquidMapType>();
-        _loadedLiquidData->liquidMap->resize(_loadedLiquidData->liquidWidth * _loadedLiquidData->liquidHeight);
-        if (!fileStream.read(reinterpret_cast<char*>(_loadedLiquidData->liquidMap->data()), _loadedLiquidData->liquidMap->size() * sizeof(float)))
+        _loadedLiquidData->liquidMap = reader.ReadArray<float>(_loadedLiquidData->liquidWidth * _loadedLiquidData->liquidHeight);
+        if (!_loadedLiquidData->liquidMap)
             return false;
     }
     return true;
 }
 
-bool GridTerrainData::LoadHolesData(std::ifstream& fileStream, uint32 const offset)
+bool GridTerrainData::LoadHolesData(FileReader& reader, uint32 const offset)
 {
-    fileStream.seekg(offset);
+    reader.Seek(offset);
 
     _loadedHoleData = std::make_unique<LoadedHoleData>();
-    if (!fileStream.read(reinterpret_cast<char*>(&_loadedHoleData->holes), sizeof(_loadedHoleData->holes)))
+    _loadedHoleData->holes = reader.ReadArray<LoadedHoleData::HolesType>(1);
+    if (!_loadedHoleData->holes)
         return false;
 
     return true;
@@ -338,7 +421,7 @@ float GridTerrainData::getHeightFromUint8(float x, float y) const
         return INVALID_HEIGHT;
 
     int32 a, b, c;
-    uint8* V9_h1_ptr = &_loadedHeightData->uint8HeightData->v9[x_int * 128 + x_int + y_int];
+    uint8 const* V9_h1_ptr = &_loadedHeightData->uint8HeightData->v9[x_int * 128 + x_int + y_int];
     if (x + y < 1)
     {
         if (x > y)
@@ -408,7 +491,7 @@ float GridTerrainData::getHeightFromUint16(float x, float y) const
         return INVALID_HEIGHT;
 
     int32 a, b, c;
-    uint16* V9_h1_ptr = &_loadedHeightData->uint16HeightData->v9[x_int * 128 + x_int + y_int];
+    uint16 const* V9_h1_ptr = &_loadedHeightData->uint16HeightData->v9[x_int * 128 + x_int + y_int];
     if (x + y < 1)
     {
         if (x > y)
@@ -469,7 +552,7 @@ bool GridTerrainData::isHole(int row, int col) const
     int holeRow = row % 8 / 2;
     int holeCol = (col - (cellCol * 8)) / 2;
 
-    uint16 hole = _loadedHoleData->holes[cellRow * 16 + cellCol];
+    uint16 hole = (*_loadedHoleData->holes)[cellRow * 16 + cellCol];
 
     return (hole & holetab_h[holeCol] & holetab_v[holeRow]) != 0;
 }
@@ -523,7 +606,7 @@ float GridTerrainData::getLiquidLevel(float x, float y) const
     if (cy_int < 0 || cy_int >= _loadedLiquidData->liquidWidth)
         return INVALID_HEIGHT;
 
-    return _loadedLiquidData->liquidMap->at(cx_int * _loadedLiquidData->liquidWidth + cy_int);
+    return _loadedLiquidData->liquidMap[cx_int * _loadedLiquidData->liquidWidth + cy_int];
 }
 
 // Get water state on map
@@ -586,7 +669,7 @@ LiquidData const GridTerrainData::GetLiquidData(float x, float y, float z, float
             if (lx_int >= 0 && lx_int < _loadedLiquidData->liquidHeight && ly_int >= 0 && ly_int < _loadedLiquidData->liquidWidth)
             {
                 // Get water level
-                float liquid_level = _loadedLiquidData->liquidMap ? _loadedLiquidData->liquidMap->at(lx_int * _loadedLiquidData->liquidWidth + ly_int) : _loadedLiquidData->liquidLevel;
+                float liquid_level = _loadedLiquidData->liquidMap ? _loadedLiquidData->liquidMap[lx_int * _loadedLiquidData->liquidWidth + ly_int] : _loadedLiquidData->liquidLevel;
                 // Get ground level
                 float ground_level = getHeight(x, y);
 
@@ -22,6 +22,7 @@
 #include <fstream>
 #include <G3D/Plane.h>
 #include <memory>
+#include <vector>
 
 #define MAX_HEIGHT            100000.0f                     // can be use for find ground height at surface
 #define INVALID_HEIGHT       -100000.0f                     // for check, must be equal to VMAP_INVALID_HEIGHT, real value for unknown height is VMAP_INVALID_HEIGHT_VALUE
@@ -112,13 +113,15 @@ struct map_liquidHeader
 // ******************************************
 // Loaded map data structures
 // ******************************************
+// The arrays point either into the memory mapped map file or into the buffer the file was read into,
+// see GridTerrainData::Load
 
 struct LoadedAreaData
 {
     typedef std::array<uint16, 16 * 16> AreaMapType;
 
     uint16 gridArea;
-    std::unique_ptr<AreaMapType> areaMap;
+    AreaMapType const* areaMap = nullptr;
 };
 
 struct LoadedHeightData
@@ -127,31 +130,22 @@ struct LoadedHeightData
 
     struct Uint16HeightData
     {
-        typedef std::array<uint16, 129 * 129> V9Type;
-        typedef std::array<uint16, 128 * 128> V8Type;
-
-        V9Type v9;
-        V8Type v8;
+        uint16 const* v9 = nullptr; // 129 * 129
+        uint16 const* v8 = nullptr; // 128 * 128
         float gridIntHeightMultiplier;
     };
 
     struct Uint8HeightData
     {
-        typedef std::array<uint8, 129 * 129> V9Type;
-        typedef std::array<uint8, 128 * 128> V8Type;
-
-        V9Type v9;
-        V8Type v8;
+        uint8 const* v9 = nullptr; // 129 * 129
+        uint8 const* v8 = nullptr; // 128 * 128
         float gridIntHeightMultiplier;
     };
 
     struct FloatHeightData
     {
-        typedef std::array<float, 129 * 129> V9Type;
-        typedef std::array<float, 128 * 128> V8Type;
-
-        V9Type v9;
-        V8Type v8;
+        float const* v9 = nullptr; // 129 * 129
+        float const* v8 = nullptr; // 128 * 128
     };
 
     float gridHeight;
@@ -165,7 +159,6 @@ struct LoadedLiquidData
 {
     typedef std::array<uint16, 16 * 16> LiquidEntryType;
     typedef std::array<uint8, 16 * 16> LiquidFlagsType;
-    typedef std::vector<float> LiquidMapType;
 
     uint16 liquidGlobalEntry;
     uint8 liquidGlobalFlags;
@@ -174,16 +167,16 @@ struct LoadedLiquidData
     uint8 liquidWidth;
     uint8 liquidHeight;
     float liquidLevel;
-    std::unique_ptr<LiquidEntryType> liquidEntry;
-    std::unique_ptr<LiquidFlagsType> liquidFlags;
-    std::unique_ptr<LiquidMapType> liquidMap;
+    LiquidEntryType const* liquidEntry = nullptr;
+    LiquidFlagsType const* liquidFlags = nullptr;
+    float const* liquidMap = nullptr; // liquidWidth * liquidHeight
 };
 
 struct LoadedHoleData
 {
     typedef std::array<uint16, 16 * 16> HolesType;
 
-    HolesType holes;
+    HolesType const* holes = nullptr;
 };
 
 enum LiquidStatus : uint32
@@ -218,12 +211,25 @@ enum class TerrainMapDataReadResult
     InvalidHoleData
 };
 
+namespace boost::interprocess
+{
+    class mapped_region;
+}
+
 class GridTerrainData
 {
-    bool LoadAreaData(std::ifstream& fileStream, uint32 const offset);
-    bool LoadHeightData(std::ifstream& fileStream, uint32 const offset);
-    bool LoadLiquidData(std::ifstream& fileStream, uint32 const offset);
-    bool LoadHolesData(std::ifstream& fileStream, uint32 const offset);
+    class FileReader;
+
+    bool LoadAreaData(FileReader& reader, uint32 const offset);
+    bool LoadHeightData(FileReader& reader, uint32 const offset);
+    bool LoadLiquidData(FileReader& reader, uint32 const offset);
+    bool LoadHolesData(FileReader& reader, uint32 const offset);
+
+    // Backing store of the loaded arrays, either the mapped file or the file contents
+    std::unique_ptr<boost::interprocess::mapped_region> _fileImage;
+    std::unique_ptr<char[]> _fileBuffer;
+    // Arrays stored at an offset not suitably aligned for their type
+    std::vector<std::unique_ptr<uint32[]>> _alignedCopies;
 
     std::unique_ptr<LoadedAreaData> _loadedAreaData;
     std::unique_ptr<LoadedHeightData> _loadedHeightData;
@@ -242,8 +248,11 @@ class GridTerrainData
 
 public:
     GridTerrainData();
-    ~GridTerrainData() { };
-    TerrainMapDataReadResult Load(std::string const& mapFileName);
+    ~GridTerrainData();
+
+    // memoryMapped: keep the file mapped read-only instead of copying it to the heap, its pages are then
+    // shared with the file cache and can be dropped by the OS
+    TerrainMapDataReadResult Load(std::string const& mapFileName, bool memoryMapped = false);
 
     uint16 getArea(float x, float y) const;
     inline float getHeight(float x, float y) const { return (this->*_gridGetHeight)(x, y); }
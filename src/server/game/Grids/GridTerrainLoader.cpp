@@ -1,4 +1,5 @@
 #include "GridTerrainLoader.h"
+#include "GridTerrainPrefetcher.h"
 #include "IVMapMgr.h"
 #include "Map.h"
 #include "MMapMgr.h"
@@ -8,16 +9,20 @@
 
 void GridTerrainLoader::LoadTerrain()
 {
-    LoadMap();
+    std::unique_ptr<PrefetchedGridTerrain> prefetched;
+    if (GridTerrainPrefetcher* prefetcher = _map->GetGridTerrainPrefetcher())
+        prefetched = prefetcher->Take(GridCoord(_grid.GetX(), _grid.GetY()));
+
+    LoadMap(prefetched.get());
 
     if (_map->GetInstanceId() == 0)
     {
         LoadVMap();
-        LoadMMap();
+        LoadMMap(prefetched.get());
     }
 }
 
-void GridTerrainLoader::LoadMap()
+void GridTerrainLoader::LoadMap(PrefetchedGridTerrain* prefetched)
 {
     // Instances will point to the parent maps terrain data, no need to load anything.
     if (_map->GetInstanceId() != 0)
@@ -30,10 +35,21 @@ void GridTerrainLoader::LoadMap()
     // map file name
     std::string const mapFileName = Acore::StringFormat("{}maps/{:03}{:02}{:02}.map", sWorld->GetDataPath(), _map->GetId(), _grid.GetX(), _grid.GetY());
 
-    // loading data
-    LOG_DEBUG("maps", "Loading map {}", mapFileName);
-    std::unique_ptr<GridTerrainData> terrainData = std::make_unique<GridTerrainData>();
-    TerrainMapDataReadResult loadResult = terrainData->Load(mapFileName);
+    // loading data, unless it was already read in the background
+    std::unique_ptr<GridTerrainData> terrainData;
+    TerrainMapDataReadResult loadResult;
+    if (prefetched)
+    {
+        terrainData = std::move(prefetched->TerrainData);
+        loadResult = prefetched->TerrainResult;
+    }
+    else
+    {
+        LOG_DEBUG("maps", "Loading map {}", mapFileName);
+        terrainData = std::make_unique<GridTerrainData>();
+        loadResult = terrainData->Load(mapFileName, sWorld->getBoolConfig(CONFIG_GRID_TERRAIN_MEMORY_MAPPED));
+    }
+
     if (loadResult == TerrainMapDataReadResult::Success)
         _grid.SetTerrainData(std::move(terrainData));
     else
@@ -69,9 +85,17 @@ void GridTerrainLoader::LoadVMap()
     }
 }
 
-void GridTerrainLoader::LoadMMap()
+void GridTerrainLoader::LoadMMap(PrefetchedGridTerrain* prefetched)
 {
-    int const mmapLoadResult = _map->GetMapCollisionData().LoadMMapTile(_grid.GetX(), _grid.GetY());
+    int mmapLoadResult;
+    if (prefetched && prefetched->NavMeshTile)
+    {
+        mmapLoadResult = _map->GetMapCollisionData().AddMMapTile(_grid.GetX(), _grid.GetY(), prefetched->NavMeshTile, prefetched->NavMeshTileSize);
+        prefetched->NavMeshTile = nullptr;
+    }
+    else
+        mmapLoadResult = _map->GetMapCollisionData().LoadMMapTile(_grid.GetX(), _grid.GetY());
+
     switch (mmapLoadResult)
     {
     case MMAP::MMAP_LOAD_RESULT_OK:
@@ -21,6 +21,7 @@
 #include "GridDefines.h"
 
 class Map;
+struct PrefetchedGridTerrain;
 
 class GridTerrainLoader
 {
@@ -34,9 +35,9 @@ public:
     static bool ExistVMap(uint32 mapid, int gx, int gy);
 
 private:
-    void LoadMap();
+    void LoadMap(PrefetchedGridTerrain* prefetched);
     void LoadVMap();
-    void LoadMMap();
+    void LoadMMap(PrefetchedGridTerrain* prefetched);
 
     MapGridType& _grid;
     Map* _map;
@@ -0,0 +1,279 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "GridTerrainPrefetcher.h"
+#include "DisableMgr.h"
+#include "GridTerrainData.h"
+#include "Log.h"
+#include "MMapMgr.h"
+#include "Map.h"
+#include "MapTree.h"
+#include "MotionMaster.h"
+#include "PCQueue.h"
+#include "Player.h"
+#include "StringFormat.h"
+#include "VMapFactory.h"
+#include "VMapMgr2.h"
+#include "WaypointMovementGenerator.h"
+#include "World.h"
+#include <atomic>
+#include <fstream>
+#include <functional>
+#include <limits>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace
+{
+    // Upper bound of prefetched grids waiting for their creation per map, the prediction can be wrong
+    constexpr std::size_t MAX_PREFETCHED_GRIDS = 32;
+
+    ProducerConsumerQueue<std::function<void()>> Jobs;
+    std::vector<std::thread> Workers;
+    std::atomic<bool> WorkersCanceled = false;
+
+    uint32 PackGridCoord(GridCoord const& gridCoord)
+    {
+        return gridCoord.x_coord * MAX_NUMBER_OF_GRIDS + gridCoord.y_coord;
+    }
+}
+
+// Shared with the queued jobs, so a job never outlives the data it writes to
+struct GridTerrainPrefetcher::Store
+{
+    uint32 MapId = 0;
+    bool LoadVMap = false;
+    bool LoadMMap = false;
+
+    std::mutex Lock;
+    std::unordered_set<uint32> Pending;
+    std::unordered_map<uint32, std::unique_ptr<PrefetchedGridTerrain>> Ready;
+};
+
+PrefetchedGridTerrain::~PrefetchedGridTerrain()
+{
+    if (NavMeshTile)
+        dtFree(NavMeshTile);
+}
+
+GridTerrainPrefetcher::GridTerrainPrefetcher(Map* map) : _map(map), _store(std::make_shared<Store>())
+{
+    _store->MapId = map->GetId();
+    _store->LoadVMap = VMAP::VMapFactory::createOrGetVMapMgr()->isMapLoadingEnabled();
+    _store->LoadMMap = DisableMgr::IsPathfindingEnabled(map);
+
+    _predictTimer.SetInterval(IN_MILLISECONDS);
+}
+
+GridTerrainPrefetcher::~GridTerrainPrefetcher() = default;
+
+void GridTerrainPrefetcher::ActivateWorkers(uint32 threads)
+{
+    WorkersCanceled = false;
+
+    for (uint32 i = 0; i < threads; ++i)
+    {
+        Workers.emplace_back([]()
+        {
+            while (!WorkersCanceled)
+            {
+                std::function<void()> job;
+                Jobs.WaitAndPop(job);
+
+                if (!WorkersCanceled && job)
+                    job();
+            }
+        });
+    }
+}
+
+void GridTerrainPrefetcher::DeactivateWorkers()
+{
+    WorkersCanceled = true;
+    Jobs.Cancel();
+
+    for (std::thread& worker : Workers)
+        if (worker.joinable())
+            worker.join();
+
+    Workers.clear();
+}
+
+void GridTerrainPrefetcher::Update(uint32 diff)
+{
+    if (Workers.empty() || !_map->HavePlayers())
+        return;
+
+    _predictTimer.Update(diff);
+    if (!_predictTimer.Passed())
+        return;
+
+    _predictTimer.Reset();
+
+    // Drop predictions that were not used in time and grids created while their job was running
+    {
+        uint32 const expireTime = 2 * sWorld->getIntConfig(CONFIG_GRID_PREFETCH_LOOKAHEAD) * IN_MILLISECONDS;
+
+        std::lock_guard<std::mutex> guard(_store->Lock);
+        for (auto itr = _store->Ready.begin(); itr != _store->Ready.end();)
+        {
+            GridCoord const gridCoord(itr->first / MAX_NUMBER_OF_GRIDS, itr->first % MAX_NUMBER_OF_GRIDS);
+            if (GetMSTimeDiffToNow(itr->second->PrefetchTime) > expireTime || _map->IsGridCreated(gridCoord))
+                itr = _store->Ready.erase(itr);
+            else
+                ++itr;
+        }
+    }
+
+    for (MapReference const& ref : _map->GetPlayers())
+        if (Player* player = ref.GetSource())
+            if (player->IsInWorld())
+                PredictGrids(player);
+}
+
+void GridTerrainPrefetcher::PredictGrids(Player* player)
+{
+    float const lookAhead = float(sWorld->getIntConfig(CONFIG_GRID_PREFETCH_LOOKAHEAD));
+
+    // Taxi: follow the remaining nodes of the path for as far as the flight goes in the look ahead time
+    if (player->GetMotionMaster()->GetCurrentMovementGeneratorType() == FLIGHT_MOTION_TYPE)
+    {
+        if (FlightPathMovementGenerator* flight = dynamic_cast<FlightPathMovementGenerator*>(player->GetMotionMaster()->top()))
+        {
+            TaxiPathNodeList const& path = flight->GetPath();
+
+            float remaining = player->GetSpeed(MOVE_RUN) * lookAhead;
+            float lastX = player->GetPositionX();
+            float lastY = player->GetPositionY();
+
+            for (uint32 i = flight->GetCurrentNode(); i < path.size() && remaining > 0.0f; ++i)
+            {
+                TaxiPathNodeEntry const* node = path[i];
+                if (node->mapid != _map->GetId())
+                    break;
+
+                RequestAlong(lastX, lastY, node->x, node->y);
+                remaining -= std::hypot(node->x - lastX, node->y - lastY);
+                lastX = node->x;
+                lastY = node->y;
+            }
+
+            return;
+        }
+    }
+
+    if (!player->isMoving())
+        return;
+
+    UnitMoveType moveType = MOVE_RUN;
+    if (player->IsFlying())
+        moveType = MOVE_FLIGHT;
+    else if (player->IsInWater())
+        moveType = MOVE_SWIM;
+
+    float orientation = player->GetOrientation();
+    if (player->HasUnitMovementFlag(MOVEMENTFLAG_BACKWARD))
+        orientation = Position::NormalizeOrientation(orientation + float(M_PI));
+
+    float const distance = player->GetSpeed(moveType) * lookAhead;
+    RequestAlong(player->GetPositionX(), player->GetPositionY(),
+        player->GetPositionX() + std::cos(orientation) * distance, player->GetPositionY() + std::sin(orientation) * distance);
+}
+
+void GridTerrainPrefetcher::RequestAlong(float startX, float startY, float endX, float endY)
+{
+    // Sample twice per grid so a diagonal segment cannot skip one
+    float const length = std::hypot(endX - startX, endY - startY);
+    uint32 const steps = uint32(length / (SIZE_OF_GRIDS / 2)) + 1;
+
+    for (uint32 i = 0; i <= steps; ++i)
+    {
+        float const x = startX + (endX - startX) * i / steps;
+        float const y = startY + (endY - startY) * i / steps;
+        if (!Acore::IsValidMapCoord(x, y))
+            return;
+
+        Request(Acore::ComputeGridCoord(x, y));
+    }
+}
+
+void GridTerrainPrefetcher::Request(GridCoord const& gridCoord)
+{
+    if (_map->IsGridCreated(gridCoord))
+        return;
+
+    uint32 const key = PackGridCoord(gridCoord);
+    {
+        std::lock_guard<std::mutex> guard(_store->Lock);
+        if (_store->Ready.size() + _store->Pending.size() >= MAX_PREFETCHED_GRIDS)
+            return;
+
+        if (_store->Ready.count(key) || !_store->Pending.insert(key).second)
+            return;
+    }
+
+    Jobs.Push([store = _store, gridCoord]() { Prefetch(store, gridCoord); });
+}
+
+std::unique_ptr<PrefetchedGridTerrain> GridTerrainPrefetcher::Take(GridCoord const& gridCoord)
+{
+    std::lock_guard<std::mutex> guard(_store->Lock);
+
+    auto itr = _store->Ready.find(PackGridCoord(gridCoord));
+    if (itr == _store->Ready.end())
+        return nullptr;
+
+    std::unique_ptr<PrefetchedGridTerrain> prefetched = std::move(itr->second);
+    _store->Ready.erase(itr);
+    return prefetched;
+}
+
+void GridTerrainPrefetcher::Prefetch(std::shared_ptr<Store> store, GridCoord gridCoord)
+{
+    std::unique_ptr<PrefetchedGridTerrain> prefetched = std::make_unique<PrefetchedGridTerrain>();
+
+    // Grid files use the same coordinates as MapGridManager::CreateGrid
+    uint32 const gridX = gridCoord.x_coord;
+    uint32 const gridY = gridCoord.y_coord;
+
+    std::string const mapFileName = Acore::StringFormat("{}maps/{:03}{:02}{:02}.map", sWorld->GetDataPath(), store->MapId, gridX, gridY);
+    prefetched->TerrainData = std::make_unique<GridTerrainData>();
+    prefetched->TerrainResult = prefetched->TerrainData->Load(mapFileName, sWorld->getBoolConfig(CONFIG_GRID_TERRAIN_MEMORY_MAPPED));
+    if (prefetched->TerrainResult != TerrainMapDataReadResult::Success)
+        prefetched->TerrainData.reset();
+
+    // The vmap tile has to be inserted into the static tree by the map thread, only warm up the file cache
+    if (store->LoadVMap)
+    {
+        std::string const vmapFileName = sWorld->GetDataPath() + "vmaps/" + VMAP::StaticMapTree::getTileFileName(store->MapId, gridX, gridY);
+        std::ifstream vmapFile(vmapFileName, std::ios::binary);
+        vmapFile.ignore(std::numeric_limits<std::streamsize>::max());
+    }
+
+    if (store->LoadMMap)
+        prefetched->NavMeshTile = MMAP::MMapMgr::ReadTile(store->MapId, gridX, gridY, prefetched->NavMeshTileSize);
+
+    prefetched->PrefetchTime = getMSTime();
+
+    LOG_DEBUG("maps", "GridTerrainPrefetcher: prefetched grid [{}, {}] of map {}", gridX, gridY, store->MapId);
+
+    std::lock_guard<std::mutex> guard(store->Lock);
+    store->Pending.erase(PackGridCoord(gridCoord));
+    store->Ready[PackGridCoord(gridCoord)] = std::move(prefetched);
+}
@@ -0,0 +1,83 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef ACORE_GRID_TERRAIN_PREFETCHER_H
+#define ACORE_GRID_TERRAIN_PREFETCHER_H
+
+#include "GridDefines.h"
+#include "GridTerrainData.h"
+#include "Timer.h"
+#include <memory>
+
+class Map;
+class Player;
+
+// Terrain of a grid read from disk ahead of its creation
+struct PrefetchedGridTerrain
+{
+    PrefetchedGridTerrain() = default;
+    ~PrefetchedGridTerrain();
+
+    PrefetchedGridTerrain(PrefetchedGridTerrain const&) = delete;
+    PrefetchedGridTerrain& operator=(PrefetchedGridTerrain const&) = delete;
+
+    std::unique_ptr<GridTerrainData> TerrainData;
+    TerrainMapDataReadResult TerrainResult = TerrainMapDataReadResult::NotFound;
+
+    // dtAlloc'ed tile, the navmesh takes ownership once it is added
+    unsigned char* NavMeshTile = nullptr;
+    uint32 NavMeshTileSize = 0;
+
+    uint32 PrefetchTime = 0;
+};
+
+/*
+ * Predicts which grids the players of a continent are about to enter (movement direction and speed,
+ * or the remaining taxi path) and reads their terrain, vmap and mmap tiles on background threads.
+ *
+ * Only the I/O and parsing happen off-thread: the map thread still links the terrain data to the grid,
+ * adds the navmesh tile and loads the vmap tile (from the warmed file cache), then spawns objects,
+ * since the navmesh and the static vmap tree are read concurrently by the map thread.
+ */
+class GridTerrainPrefetcher
+{
+    struct Store;
+
+public:
+    explicit GridTerrainPrefetcher(Map* map);
+    ~GridTerrainPrefetcher();
+
+    // Map thread
+    void Update(uint32 diff);
+    std::unique_ptr<PrefetchedGridTerrain> Take(GridCoord const& gridCoord);
+
+    static void ActivateWorkers(uint32 threads);
+    static void DeactivateWorkers();
+
+private:
+    void PredictGrids(Player* player);
+    void RequestAlong(float startX, float startY, float endX, float endY);
+    void Request(GridCoord const& gridCoord);
+
+    static void Prefetch(std::shared_ptr<Store> store, GridCoord gridCoord);
+
+    Map* _map;
+    std::shared_ptr<Store> _store;
+    IntervalTimer _predictTimer;
+};
+
+#endif
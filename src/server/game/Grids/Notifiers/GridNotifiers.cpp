@@ -20,6 +20,7 @@
 #include "ObjectAccessor.h"
 #include "Transport.h"
 #include "UpdateData.h"
+#include "World.h"
 #include "WorldPacket.h"
 
 using namespace Acore;
@@ -29,10 +30,24 @@ void VisibleNotifier::Visit(GameObjectMapType& m)
     for (GameObjectMapType::iterator iter = m.begin(); iter != m.end(); ++iter)
     {
         GameObject* go = iter->GetSource();
-        i_player.UpdateVisibilityOf(go, i_data, i_visibleNow);
+        UpdateVisibilityOf(go);
     }
 }
 
+bool VisibleNotifier::IsVisibilityUnchanged(WorldObject const* target) const
+{
+    // Objects entering the sight range are always tested, the ones leaving it are removed by SendToSelf
+    if (!i_player.HaveAtClient(target))
+        return false;
+
+    // Stealth and invisibility detection depend on the distance
+    if (Unit const* unit = target->ToUnit())
+        if (unit->HasStealthAura() || unit->HasInvisibilityAura())
+            return false;
+
+    return true;
+}
+
 void VisibleNotifier::SendToSelf()
 {
     // Update far visible objects
@@ -58,25 +73,23 @@ void VisibleNotifier::SendToSelf()
         }
     }
 
-    VisibleWorldObjectsMap* visibleWorldObjects = i_player.GetObjectVisibilityContainer().GetVisibleWorldObjectsMap();
-    for (VisibleWorldObjectsMap::iterator itr = visibleWorldObjects->begin(); itr != visibleWorldObjects->end();)
+    // Objects out of sight are unlinked in a single pass over the visibility map
+    i_player.GetObjectVisibilityContainer().UnlinkWorldObjectsVisibilityIf([this](WorldObject* obj)
     {
-        WorldObject* obj = itr->second;
         if (!i_player.IsWorldObjectOutOfSightRange(obj)
             || i_player.CanSeeOrDetect(obj, false, true))
-        {
-            ++itr;
-            continue;
-        }
+            return false;
 
         i_data.AddOutOfRangeGUID(obj->GetGUID());
 
         if (Player* objPlayer = obj->ToPlayer())
             objPlayer->UpdateVisibilityOf(&i_player);
 
-        // Clean up references
-        itr = i_player.GetObjectVisibilityContainer().UnlinkVisibilityFromPlayer(obj, itr);
-    }
+        return true;
+    });
+
+    if (!i_incremental && !i_gobjOnly)
+        i_player.SetVisibilityUpdateCell();
 
     if (!i_data.HasData())
         return;
@@ -149,7 +162,13 @@ void PlayerRelocationNotifier::Visit(PlayerMapType& m)
     for (PlayerMapType::iterator iter = m.begin(); iter != m.end(); ++iter)
     {
         Player* player = iter->GetSource();
-        i_player.UpdateVisibilityOf(player, i_data, i_visibleNow);
+        UpdateVisibilityOf(player);
+
+        // Still in sight range of a player that sees us, nothing changes for them unless we are stealthed
+        if (i_incremental && player->HaveAtClient(&i_player) && !player->IsWorldObjectOutOfSightRange(&i_player)
+            && !i_player.HasStealthAura() && !i_player.HasInvisibilityAura())
+            continue;
+
         player->UpdateVisibilityOf(&i_player); // this notifier with different Visit(PlayerMapType&) than VisibleNotifier is needed to update visibility of self for other players when we move (eg. stealth detection changes)
     }
 }
@@ -202,18 +221,61 @@ void AIRelocationNotifier::Visit(PlayerMapType& m)
 // Uses visibility map
 void MessageDistDeliverer::Visit(VisiblePlayersMap const& m)
 {
+    Unit const* heartbeatSource = nullptr;
+    if (i_message->GetOpcode() == MSG_MOVE_HEARTBEAT && sWorld->getBoolConfig(CONFIG_INTEREST_MANAGEMENT))
+        heartbeatSource = i_source->ToUnit();
+
+    uint32 relayed = 0;
+    uint32 skipped = 0;
+
     for (auto const& kvPair : m)
     {
         Player const* target = kvPair.second;
-        if (i_distSq != 0.0f && target->GetSightPosition().GetExactDist2dSq(i_source) > i_distSq)
+        float const distSq = target->GetSightPosition().GetExactDist2dSq(i_source);
+        if (i_distSq != 0.0f && distSq > i_distSq)
             continue;
 
         // @todo: Might not need this check anymore
         if (skipped_receiver == target)
             continue;
 
+        if (heartbeatSource)
+        {
+            if (!IsHeartbeatRelevantFor(heartbeatSource, target, distSq, i_heartbeatCount))
+            {
+                ++skipped;
+                continue;
+            }
+
+            ++relayed;
+        }
+
         target->SendDirectMessage(i_message);
     }
+
+    if (heartbeatSource)
+        heartbeatSource->GetMap()->AddRelayedHeartbeats(relayed, skipped);
+}
+
+bool MessageDistDeliverer::IsHeartbeatRelevantFor(Unit const* source, Player const* target, float distSq, uint32 heartbeatCount)
+{
+    float const fullRateDistance = float(sWorld->getIntConfig(CONFIG_INTEREST_FULL_RATE_DISTANCE));
+    if (distSq <= fullRateDistance * fullRateDistance)
+        return true;
+
+    // Group members, the selected target and combat opponents always get every heartbeat
+    if (target->GetTarget() == source->GetGUID() || target->GetVictim() == source || source->GetVictim() == target)
+        return true;
+
+    if (Player const* sourcePlayer = source->GetCharmerOrOwnerPlayerOrPlayerItself())
+        if (sourcePlayer->IsInSameGroupWith(target))
+            return true;
+
+    // The receivers are spread over the heartbeats
+    uint32 const divisor = GetHeartbeatDivisor(std::sqrt(distSq), fullRateDistance, float(sWorld->getIntConfig(CONFIG_INTEREST_DISTANCE_STEP)),
+        sWorld->getIntConfig(CONFIG_INTEREST_MAX_DIVISOR));
+
+    return (heartbeatCount + target->GetGUID().GetCounter()) % divisor == 0;
 }
 
 void MessageDistDeliverer::Visit(PlayerMapType& m)
@@ -45,10 +45,12 @@ namespace Acore
         Player& i_player;
         std::vector<Unit*>& i_visibleNow;
         bool i_gobjOnly;
+        // Only re-test objects whose visibility can change by moving inside the sight range
+        bool i_incremental;
         UpdateData i_data;
 
-        VisibleNotifier(Player& player, bool gobjOnly) :
-            i_player(player), i_visibleNow(player.m_newVisible), i_gobjOnly(gobjOnly)
+        VisibleNotifier(Player& player, bool gobjOnly, bool incremental = false) :
+            i_player(player), i_visibleNow(player.m_newVisible), i_gobjOnly(gobjOnly), i_incremental(incremental)
         {
             i_visibleNow.clear();
         }
@@ -57,6 +59,10 @@ namespace Acore
         template<class T> void Visit(std::vector<T>& m);
         template<class T> void Visit(GridRefMgr<T>& m);
         void SendToSelf(void);
+
+    protected:
+        template<class T> void UpdateVisibilityOf(T* target);
+        bool IsVisibilityUnchanged(WorldObject const* target) const;
     };
 
     struct VisibleChangesNotifier
@@ -72,7 +78,7 @@ namespace Acore
 
     struct PlayerRelocationNotifier : public VisibleNotifier
     {
-        PlayerRelocationNotifier(Player& player): VisibleNotifier(player, false) { }
+        PlayerRelocationNotifier(Player& player, bool incremental = false): VisibleNotifier(player, false, incremental) { }
 
         template<class T> void Visit(std::vector<T>& m) { VisibleNotifier::Visit(m); }
         template<class T> void Visit(GridRefMgr<T>& m) { VisibleNotifier::Visit(m); }
@@ -117,6 +123,11 @@ namespace Acore
         bool required3dDist;
 
         MessageDistDeliverer(WorldObject const* src, WorldPacket const* msg, float dist, TeamFilter teamFilter = TeamFilter::All, Player const* skipped = nullptr, bool req3dDist = false) :
+            MessageDistDeliverer(src, msg, dist, teamFilter, skipped, req3dDist, src->ToUnit() ? src->ToUnit()->m_relayedHeartbeatCount : 0)
+        { }
+
+        // heartbeatCount is the one of the source when the packet was sent, the deferred movement relay passes the one it was queued with
+        MessageDistDeliverer(WorldObject const* src, WorldPacket const* msg, float dist, TeamFilter teamFilter, Player const* skipped, bool req3dDist, uint32 heartbeatCount) :
             i_source(src),
             i_message(msg),
             i_phaseMask(src->GetPhaseMask()),
@@ -124,7 +135,8 @@ namespace Acore
             teamFilter(src->IsPlayer() ? teamFilter : TeamFilter::All),
             teamId(src->IsPlayer() ? src->ToPlayer()->GetTeamId() : TEAM_NEUTRAL),
             skipped_receiver(skipped),
-            required3dDist(req3dDist)
+            required3dDist(req3dDist),
+            i_heartbeatCount(heartbeatCount)
         { }
 
         void Visit(VisiblePlayersMap const& m);
@@ -134,6 +146,19 @@ namespace Acore
 
         template <class SKIP> void Visit(GridRefMgr<SKIP>&) { }
 
+        // Interest management: distant players only get a part of the movement heartbeats of a unit
+        static bool IsHeartbeatRelevantFor(Unit const* source, Player const* target, float distSq, uint32 heartbeatCount);
+
+        // A player at this distance gets one out of the returned number of heartbeats,
+        // one more is skipped per distance step beyond the full rate distance
+        static uint32 GetHeartbeatDivisor(float dist, float fullRateDistance, float distanceStep, uint32 maxDivisor)
+        {
+            if (dist <= fullRateDistance)
+                return 1;
+
+            return std::min<uint32>(maxDivisor, 1 + uint32((dist - fullRateDistance) / distanceStep));
+        }
+
         void SendPacket(Player* player) const
         {
             // never send packet to self
@@ -160,6 +185,9 @@ namespace Acore
 
             player->SendDirectMessage(i_message);
         }
+
+    private:
+        uint32 i_heartbeatCount;
     };
 
     struct MessageDistDelivererToHostile
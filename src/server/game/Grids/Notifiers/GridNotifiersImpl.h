@@ -29,7 +29,7 @@ template<class T>
 inline void Acore::VisibleNotifier::Visit(std::vector<T>& m)
 {
     for (typename std::vector<T>::iterator iter = m.begin(); iter != m.end(); ++iter)
-        i_player.UpdateVisibilityOf((*iter), i_data, i_visibleNow);
+        UpdateVisibilityOf(*iter);
 }
 
 template<class T>
@@ -40,7 +40,20 @@ inline void Acore::VisibleNotifier::Visit(GridRefMgr<T>& m)
         return;
 
     for (typename GridRefMgr<T>::iterator iter = m.begin(); iter != m.end(); ++iter)
-        i_player.UpdateVisibilityOf(iter->GetSource(), i_data, i_visibleNow);
+        UpdateVisibilityOf(iter->GetSource());
+}
+
+template<class T>
+inline void Acore::VisibleNotifier::UpdateVisibilityOf(T* target)
+{
+    if (i_incremental && IsVisibilityUnchanged(target))
+    {
+        // Objects near players are kept in the map update list
+        i_player.GetMap()->AddObjectToPendingUpdateList(target);
+        return;
+    }
+
+    i_player.UpdateVisibilityOf(target, i_data, i_visibleNow);
 }
 
 // SEARCHERS & LIST SEARCHERS & WORKERS
@@ -1883,6 +1883,8 @@ void Group::UpdatePlayerOutOfRange(Player* player)
 
 void Group::BroadcastPacket(WorldPacket const* packet, bool ignorePlayersInBGRaid, int group, ObjectGuid ignore)
 {
+    // Copied once on the first recipient and shared by the sessions of the others
+    std::shared_ptr<WorldPacket const> sharedPacket;
     for (GroupReference* itr = GetFirstMember(); itr != nullptr; itr = itr->next())
     {
         Player* player = itr->GetSource();
@@ -1890,7 +1892,12 @@ void Group::BroadcastPacket(WorldPacket const* packet, bool ignorePlayersInBGRai
             continue;
 
         if (group == -1 || itr->getSubGroup() == group)
-            player->SendDirectMessage(packet);
+        {
+            if (!sharedPacket)
+                sharedPacket = std::make_shared<WorldPacket const>(*packet);
+
+            player->GetSession()->SendSharedPacket(sharedPacket);
+        }
     }
 }
 
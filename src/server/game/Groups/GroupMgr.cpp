@@ -53,6 +53,8 @@ void GroupMgr::InitGroupIds()
 
 void GroupMgr::RegisterGroupId(ObjectGuid::LowType groupId)
 {
+    std::unique_lock<std::shared_mutex> lock(_lock);
+
     // Allocation was done in InitGroupIds()
     _groupIds[groupId] = true;
 
@@ -64,6 +66,8 @@ void GroupMgr::RegisterGroupId(ObjectGuid::LowType groupId)
 
 ObjectGuid::LowType GroupMgr::GenerateGroupId()
 {
+    std::unique_lock<std::shared_mutex> lock(_lock);
+
     ObjectGuid::LowType newGroupId = _nextGroupId;
 
     // find the lowest available id starting from the current _nextGroupId
@@ -80,6 +84,8 @@ ObjectGuid::LowType GroupMgr::GenerateGroupId()
 
 Group* GroupMgr::GetGroupByGUID(ObjectGuid::LowType groupId) const
 {
+    std::shared_lock<std::shared_mutex> lock(_lock);
+
     GroupContainer::const_iterator itr = GroupStore.find(groupId);
     if (itr != GroupStore.end())
         return itr->second;
@@ -89,11 +95,13 @@ Group* GroupMgr::GetGroupByGUID(ObjectGuid::LowType groupId) const
 
 void GroupMgr::AddGroup(Group* group)
 {
+    std::unique_lock<std::shared_mutex> lock(_lock);
     GroupStore[group->GetGUID().GetCounter()] = group;
 }
 
 void GroupMgr::RemoveGroup(Group* group)
 {
+    std::unique_lock<std::shared_mutex> lock(_lock);
     GroupStore.erase(group->GetGUID().GetCounter());
 }
 
@@ -19,6 +19,7 @@
 #define _GROUPMGR_H
 
 #include "Group.h"
+#include <shared_mutex>
 
 class GroupMgr
 {
@@ -46,6 +47,8 @@ protected:
     GroupIds            _groupIds;
     ObjectGuid::LowType _nextGroupId;
     GroupContainer      GroupStore;
+    // Battlefields create and disband groups on their map thread while other maps look groups up
+    mutable std::shared_mutex _lock;
 };
 
 #define sGroupMgr GroupMgr::instance()
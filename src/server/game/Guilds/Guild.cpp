@@ -1205,11 +1205,25 @@ bool Guild::SetName(std::string_view const& name)
     stmt->SetData(0, m_name);
     stmt->SetData(1, GetId());
     CharacterDatabase.Execute(stmt);
+
+    for (auto const& [guid, member] : m_members)
+        sWhoListCacheMgr->MarkDirty(member.GetGUID());
+
     return true;
 }
 
 void Guild::HandleRoster(WorldSession* session)
 {
+    bool sendOfficerNote = _HasRankRight(session->GetPlayer(), GR_RIGHT_VIEWOFFNOTE);
+
+    // Roster requests of many members (e.g. after a guild event) are answered with the same packet
+    if (std::shared_ptr<WorldPacket const> rosterPacket = m_roster.GetPacket(sendOfficerNote, GameTime::GetGameTimeMS()))
+    {
+        LOG_DEBUG("guild", "SMSG_GUILD_ROSTER [{}] (cached)", session->GetPlayerInfo());
+        session->SendSharedPacket(rosterPacket);
+        return;
+    }
+
     WorldPackets::Guild::GuildRoster roster;
 
     roster.RankData.reserve(m_ranks.size());
@@ -1226,7 +1240,6 @@ void Guild::HandleRoster(WorldSession* session)
         }
     }
 
-    bool sendOfficerNote = _HasRankRight(session->GetPlayer(), GR_RIGHT_VIEWOFFNOTE);
     roster.MemberData.reserve(m_members.size());
     for (auto const& [guid, member] : m_members)
     {
@@ -1251,8 +1264,11 @@ void Guild::HandleRoster(WorldSession* session)
     roster.WelcomeText = m_motd;
     roster.InfoText = m_info;
 
+    std::shared_ptr<WorldPacket const> rosterPacket = std::make_shared<WorldPacket const>(*roster.Write());
+    m_roster.StorePacket(sendOfficerNote, rosterPacket);
+
     LOG_DEBUG("guild", "SMSG_GUILD_ROSTER [{}]", session->GetPlayerInfo());
-    session->SendPacket(roster.Write());
+    session->SendSharedPacket(rosterPacket);
 }
 
 void Guild::HandleQuery(WorldSession* session)
@@ -1316,6 +1332,8 @@ void Guild::HandleSetInfo(WorldSession* session, std::string_view info)
         stmt->SetData(0, m_info);
         stmt->SetData(1, m_id);
         CharacterDatabase.Execute(stmt);
+
+        _InvalidateRoster();
     }
 }
 
@@ -1384,6 +1402,7 @@ void Guild::HandleSetMemberNote(WorldSession* session, std::string_view name, st
         else
             member->SetOfficerNote(note);
 
+        _InvalidateRoster();
         HandleRoster(session);
     }
 }
@@ -1775,6 +1794,8 @@ void Guild::HandleMemberLogout(WorldSession* session)
         member->UpdateLogoutTime();
         member->ResetFlags();
     }
+
+    m_roster.RemoveOnlineMember(player->GetGUID());
     _BroadcastEvent(GE_SIGNED_OFF, player->GetGUID(), player->GetName());
 }
 
@@ -1914,6 +1935,8 @@ void Guild::SendLoginInfo(WorldSession* session)
     Player* player = session->GetPlayer();
 
     HandleRoster(session);
+
+    m_roster.AddOnlineMember(player->GetGUID(), player);
     _BroadcastEvent(GE_SIGNED_ON, player->GetGUID(), player->GetName());
 
     if (Member* member = GetMember(player->GetGUID()))
@@ -1921,6 +1944,8 @@ void Guild::SendLoginInfo(WorldSession* session)
         member->SetStats(player);
         member->AddFlag(GUILDMEMBER_STATUS_ONLINE);
     }
+
+    _InvalidateRoster();
 }
 
 // Loading methods
@@ -2144,26 +2169,37 @@ void Guild::BroadcastToGuild(WorldSession* session, bool officerOnly, std::strin
     {
         WorldPacket data;
         ChatHandler::BuildChatPacket(data, officerOnly ? CHAT_MSG_OFFICER : CHAT_MSG_GUILD, Language(language), session->GetPlayer(), nullptr, msg);
-        for (auto const& [guid, member] : m_members)
-            if (Player* player = member.FindPlayer())
-                if (_HasRankRight(player, officerOnly ? GR_RIGHT_OFFCHATLISTEN : GR_RIGHT_GCHATLISTEN) && !player->GetSocial()->HasIgnore(session->GetPlayer()->GetGUID()))
-                    player->SendDirectMessage(&data);
+        std::shared_ptr<WorldPacket const> packet = std::make_shared<WorldPacket const>(std::move(data));
+        for (auto const& [guid, player] : m_roster.GetOnlineMembers())
+            if (_HasRankRight(player, officerOnly ? GR_RIGHT_OFFCHATLISTEN : GR_RIGHT_GCHATLISTEN) && !player->GetSocial()->HasIgnore(session->GetPlayer()->GetGUID()))
+                player->GetSession()->SendSharedPacket(packet);
     }
 }
 
 void Guild::BroadcastPacketToRank(WorldPacket const* packet, uint8 rankId) const
 {
-    for (auto const& [guid, member] : m_members)
-        if (member.IsRank(rankId))
-            if (Player* player = member.FindPlayer())
-                player->SendDirectMessage(packet);
+    std::shared_ptr<WorldPacket const> sharedPacket;
+    for (auto const& [guid, player] : m_roster.GetOnlineMembers())
+    {
+        Member const* member = GetMember(guid);
+        if (!member || !member->IsRank(rankId))
+            continue;
+
+        if (!sharedPacket)
+            sharedPacket = std::make_shared<WorldPacket const>(*packet);
+
+        player->GetSession()->SendSharedPacket(sharedPacket);
+    }
 }
 
 void Guild::BroadcastPacket(WorldPacket const* packet) const
 {
-    for (auto const& [guid, member] : m_members)
-        if (Player* player = member.FindPlayer())
-            player->SendDirectMessage(packet);
+    if (m_roster.GetOnlineMembers().empty())
+        return;
+
+    std::shared_ptr<WorldPacket const> sharedPacket = std::make_shared<WorldPacket const>(*packet);
+    for (auto const& [guid, player] : m_roster.GetOnlineMembers())
+        player->GetSession()->SendSharedPacket(sharedPacket);
 }
 
 void Guild::MassInviteToEvent(WorldSession* session, uint32 minLevel, uint32 maxLevel, uint32 minRank)
@@ -2327,6 +2363,8 @@ void Guild::DeleteMember(ObjectGuid guid, bool isDisbanding, bool isKicked, bool
     sScriptMgr->OnGuildRemoveMember(this, player, isDisbanding, isKicked);
 
     m_members.erase(lowguid);
+    m_roster.RemoveOnlineMember(guid);
+    _InvalidateRoster();
 
     // If player not online data in data field will be loaded from guild tabs no need to update it !!
     if (player)
@@ -2350,6 +2388,7 @@ bool Guild::ChangeMemberRank(ObjectGuid guid, uint8 newRank)
         if (Member* member = GetMember(guid))
         {
             member->ChangeRank(newRank);
+            _InvalidateRoster();
 
             if (newRank == GR_GUILDMASTER)
             {
@@ -2843,6 +2882,9 @@ void Guild::_BroadcastEvent(GuildEvents guildEvent, ObjectGuid guid,
         event.Params[2] = *param3;
     }
     event.Guid = guid;
+
+    // Every roster change is announced with an event, the members request the roster again
+    _InvalidateRoster();
     BroadcastPacket(event.Write());
     LOG_DEBUG("guild", "SMSG_GUILD_EVENT [Broadcast] Event: {}", guildEvent);
 }
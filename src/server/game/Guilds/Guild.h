@@ -18,10 +18,12 @@
 #ifndef AZEROTHCORE_GUILD_H
 #define AZEROTHCORE_GUILD_H
 
+#include "GuildRoster.h"
 #include "Item.h"
 #include "ObjectMgr.h"
 #include "Optional.h"
 #include "Player.h"
+#include <memory>
 #include <set>
 #include <unordered_map>
 
@@ -750,10 +752,9 @@ public:
     template<class Do>
     void BroadcastWorker(Do& _do, Player* except = nullptr)
     {
-        for (auto const& m_member : m_members)
-            if (Player* player = m_member.second.FindPlayer())
-                if (player != except)
-                    _do(player);
+        for (auto const& [guid, player] : m_roster.GetOnlineMembers())
+            if (player != except)
+                _do(player);
     }
 
     // Members
@@ -795,6 +796,10 @@ protected:
     std::unordered_map<uint32, Member> m_members;
     std::vector<BankTab> m_bankTabs;
 
+    // Members logged in, added by SendLoginInfo and removed at logout or removal from the guild.
+    // The cached roster is dropped on every change of the members, ranks, notes, MOTD or guild info.
+    mutable GuildRoster m_roster;
+
     // These are actually ordered lists. The first element is the oldest entry.
     LogHolder<EventLogEntry> m_eventLog;
     std::array<LogHolder<BankEventLogEntry>, GUILD_BANK_MAX_TABS + 1> m_bankEventLog = {};
@@ -813,6 +818,8 @@ private:
 
     inline uint8 _GetLowestRankId() const { return uint8(m_ranks.size() - 1); }
 
+    inline void _InvalidateRoster() const { m_roster.Invalidate(); }
+
     inline uint8 _GetPurchasedTabsSize() const { return uint8(m_bankTabs.size()); }
     inline BankTab* GetBankTab(uint8 tabId) { return tabId < m_bankTabs.size() ? &m_bankTabs[tabId] : nullptr; }
     inline BankTab const* GetBankTab(uint8 tabId) const { return tabId < m_bankTabs.size() ? &m_bankTabs[tabId] : nullptr; }
@@ -0,0 +1,56 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "GuildRoster.h"
+
+void GuildRoster::AddOnlineMember(ObjectGuid guid, Player* player)
+{
+    _onlineMembers[guid] = player;
+    Invalidate();
+}
+
+bool GuildRoster::RemoveOnlineMember(ObjectGuid guid)
+{
+    if (!_onlineMembers.erase(guid))
+        return false;
+
+    Invalidate();
+    return true;
+}
+
+Player* GuildRoster::FindOnlineMember(ObjectGuid guid) const
+{
+    auto itr = _onlineMembers.find(guid);
+    return itr != _onlineMembers.end() ? itr->second : nullptr;
+}
+
+std::shared_ptr<WorldPacket const> GuildRoster::GetPacket(bool officerNotes, Milliseconds now)
+{
+    // Levels, zones and logout times are not tracked, a new tick builds the roster again
+    if (_buildTime != now)
+    {
+        Invalidate();
+        _buildTime = now;
+    }
+
+    return _packets[officerNotes ? 1 : 0];
+}
+
+void GuildRoster::StorePacket(bool officerNotes, std::shared_ptr<WorldPacket const> packet)
+{
+    _packets[officerNotes ? 1 : 0] = std::move(packet);
+}
@@ -0,0 +1,58 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _GUILDROSTER_H
+#define _GUILDROSTER_H
+
+#include "Duration.h"
+#include "ObjectGuid.h"
+#include <array>
+#include <memory>
+#include <unordered_map>
+
+class Player;
+class WorldPacket;
+
+/*
+ * Members of a guild that are logged in and the SMSG_GUILD_ROSTER packets shared by the requests of one world tick.
+ * The online flags are part of the roster, so a member logging in or out drops the packets as well.
+ */
+class GuildRoster
+{
+public:
+    typedef std::unordered_map<ObjectGuid, Player*> OnlineMemberMap;
+
+    // Replaces the pointer of a member who is already online
+    void AddOnlineMember(ObjectGuid guid, Player* player);
+    // Returns false if the member was not online
+    bool RemoveOnlineMember(ObjectGuid guid);
+
+    [[nodiscard]] Player* FindOnlineMember(ObjectGuid guid) const;
+    [[nodiscard]] OnlineMemberMap const& GetOnlineMembers() const { return _onlineMembers; }
+
+    // Packet with or without the officer notes, nullptr if it was not built yet in the world tick of now
+    [[nodiscard]] std::shared_ptr<WorldPacket const> GetPacket(bool officerNotes, Milliseconds now);
+    void StorePacket(bool officerNotes, std::shared_ptr<WorldPacket const> packet);
+    void Invalidate() { _packets.fill(nullptr); }
+
+private:
+    OnlineMemberMap _onlineMembers;
+    std::array<std::shared_ptr<WorldPacket const>, 2> _packets;
+    Milliseconds _buildTime = 0ms;
+};
+
+#endif
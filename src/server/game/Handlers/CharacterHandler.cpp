@@ -131,7 +131,7 @@ bool LoginQueryHolder::Initialize()
     stmt->SetData(0, lowGuid);
     res &= SetPreparedQuery(PLAYER_LOGIN_QUERY_LOAD_MAILS, stmt);
 
-    stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_MAILITEMS);
+    stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_MAILITEMS_INFO);
     stmt->SetData(0, lowGuid);
     res &= SetPreparedQuery(PLAYER_LOGIN_QUERY_LOAD_MAIL_ITEMS, stmt);
 
@@ -655,7 +655,7 @@ void WorldSession::HandleCharDeleteOpcode(WorldPacket& recvData)
         return;
     }
 
-    if (CharacterCacheEntry const* playerData = sCharacterCache->GetCharacterCacheByGuid(guid))
+    if (Optional<CharacterCacheEntry> playerData = sCharacterCache->GetCharacterCacheByGuid(guid))
     {
         accountId = playerData->AccountId;
         name = playerData->Name;
@@ -1061,6 +1061,7 @@ void WorldSession::HandlePlayerLoginFromDB(LoginQueryHolder const& holder)
         pCurrChar->SetStandState(UNIT_STAND_STATE_STAND);
 
     m_playerLoading = false;
+    sWhoListCacheMgr->MarkDirty(pCurrChar->GetGUID());
 
     // Handle Login-Achievements (should be handled after loading)
     _player->UpdateAchievementCriteria(ACHIEVEMENT_CRITERIA_TYPE_ON_LOGIN, 1);
@@ -1267,6 +1268,7 @@ void WorldSession::HandlePlayerLoginToCharInWorld(Player* pCurrChar)
         ChatHandler(pCurrChar->GetSession()).SendNotification(LANG_GM_ON);
 
     m_playerLoading = false;
+    sWhoListCacheMgr->MarkDirty(pCurrChar->GetGUID());
 }
 
 void WorldSession::HandlePlayerLoginToCharOutOfWorld(Player* /*pCurrChar*/)
@@ -1680,7 +1682,7 @@ void WorldSession::HandleCharCustomizeCallback(std::shared_ptr<CharacterCustomiz
     }
 
     // get the players old (at this moment current) race
-    CharacterCacheEntry const* playerData = sCharacterCache->GetCharacterCacheByGuid(customizeInfo->Guid);
+    Optional<CharacterCacheEntry> playerData = sCharacterCache->GetCharacterCacheByGuid(customizeInfo->Guid);
     if (!playerData)
     {
         SendCharCustomize(CHAR_CREATE_ERROR, customizeInfo.get());
@@ -1990,7 +1992,7 @@ void WorldSession::HandleCharFactionOrRaceChangeCallback(std::shared_ptr<Charact
     ObjectGuid::LowType lowGuid = factionChangeInfo->Guid.GetCounter();
 
     // get the players old (at this moment current) race
-    CharacterCacheEntry const* playerData = sCharacterCache->GetCharacterCacheByGuid(factionChangeInfo->Guid);
+    Optional<CharacterCacheEntry> playerData = sCharacterCache->GetCharacterCacheByGuid(factionChangeInfo->Guid);
     if (!playerData)
     {
         SendCharFactionChange(CHAR_CREATE_ERROR, factionChangeInfo.get());
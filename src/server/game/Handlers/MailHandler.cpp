@@ -62,6 +62,30 @@ bool WorldSession::CanOpenMailBox(ObjectGuid guid)
     return true;
 }
 
+void WorldSession::LoadMailedItems(std::function<void()>&& callback)
+{
+    if (!_player->HasMailedItemsToLoad())
+    {
+        _player->LoadMailedItems(PreparedQueryResult());
+        callback();
+        return;
+    }
+
+    CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_MAILITEMS);
+    stmt->SetData(0, _player->GetGUID().GetCounter());
+
+    _queryProcessor.AddCallback(CharacterDatabase.AsyncQuery(stmt)
+        .WithPreparedCallback([this, playerGuid = _player->GetGUID(), callback = std::move(callback)](PreparedQueryResult result)
+    {
+        // the player may have logged out before the db response
+        if (!_player || _player->GetGUID() != playerGuid)
+            return;
+
+        _player->LoadMailedItems(std::move(result));
+        callback();
+    }));
+}
+
 void WorldSession::HandleSendMail(WorldPacket& recvData)
 {
     ObjectGuid mailbox;
@@ -190,7 +214,7 @@ void WorldSession::HandleSendMail(WorldPacket& recvData)
     else
     {
         // xinef: get data from global storage
-        if (CharacterCacheEntry const* playerData = sCharacterCache->GetCharacterCacheByGuid(receiverGuid))
+        if (Optional<CharacterCacheEntry> playerData = sCharacterCache->GetCharacterCacheByGuid(receiverGuid))
         {
             rc_teamId = Player::TeamIdForRace(playerData->Race);
             mails_count = playerData->MailCount;
@@ -441,6 +465,15 @@ void WorldSession::HandleMailReturnToSender(WorldPacket& recvData)
     recvData >> mailId;
     recvData.read_skip<uint64>();                          // original sender GUID for return to, not used
 
+    if (!CanOpenMailBox(mailbox))
+        return;
+
+    LoadMailedItems(std::bind(&WorldSession::HandleMailReturnToSenderCallback, this, mailbox, mailId));
+}
+
+void WorldSession::HandleMailReturnToSenderCallback(ObjectGuid mailbox, uint32 mailId)
+{
+    // the player may have left the mailbox while the items were loaded
     if (!CanOpenMailBox(mailbox))
         return;
 
@@ -523,6 +556,15 @@ void WorldSession::HandleMailTakeItem(WorldPacket& recvData)
     recvData >> mailId;
     recvData >> itemLowGuid;    // item guid low
 
+    if (!CanOpenMailBox(mailbox))
+        return;
+
+    LoadMailedItems(std::bind(&WorldSession::HandleMailTakeItemCallback, this, mailbox, mailId, itemLowGuid));
+}
+
+void WorldSession::HandleMailTakeItemCallback(ObjectGuid mailbox, uint32 mailId, uint32 itemLowGuid)
+{
+    // the player may have left the mailbox while the items were loaded
     if (!CanOpenMailBox(mailbox))
         return;
 
@@ -678,6 +720,16 @@ void WorldSession::HandleGetMailList(WorldPacket& recvData)
     ObjectGuid mailbox;
     recvData >> mailbox;
 
+    if (!CanOpenMailBox(mailbox))
+        return;
+
+    // Items are only needed from here on, until they are released by Player::Update
+    LoadMailedItems(std::bind(&WorldSession::HandleGetMailListCallback, this, mailbox));
+}
+
+void WorldSession::HandleGetMailListCallback(ObjectGuid mailbox)
+{
+    // the player may have left the mailbox while the items were loaded
     if (!CanOpenMailBox(mailbox))
         return;
 
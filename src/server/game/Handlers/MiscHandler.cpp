@@ -291,8 +291,13 @@ void WorldSession::HandleWhoOpcode(WorldPacket& recvData)
     data << uint32(matchCount);         // placeholder, count of players matching criteria
     data << uint32(displaycount);       // placeholder, count of players displayed
 
-    for (auto const& target : sWhoListCacheMgr->GetWhoList())
+    std::vector<WhoListPlayerInfo const*> candidates;
+    sWhoListCacheMgr->GetWhoList().GetCandidates(levelMin, levelMax, racemask, classmask, zoneids.data(), zonesCount, candidates);
+
+    for (WhoListPlayerInfo const* candidate : candidates)
     {
+        WhoListPlayerInfo const& target = *candidate;
+
         if (target.GetTeamId() != team && !HasPermission(rbac::RBAC_PERM_TWO_SIDE_WHO_LIST))
             continue;
 
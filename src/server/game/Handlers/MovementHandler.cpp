@@ -409,9 +409,12 @@ void WorldSession::HandleMovementOpcodes(WorldPacket& recvData)
         return;
 
     /* process position-change */
+    if (opcode == MSG_MOVE_HEARTBEAT)
+        ++mover->m_relayedHeartbeatCount;
+
     WorldPacket data(opcode, recvData.size());
     WriteMovementInfo(&data, &movementInfo);
-    mover->SendMessageToSet(&data, _player);
+    mover->GetMap()->SendMovementToSet(mover, std::move(data), _player);
 }
 
 void WorldSession::SynchronizeMovement(MovementInfo& movementInfo)
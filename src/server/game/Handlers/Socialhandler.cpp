@@ -50,7 +50,7 @@ void WorldSession::HandleAddFriendOpcode(WorldPacket& recv_data)
     if (!friendGuid)
         return;
 
-    CharacterCacheEntry const* playerData = sCharacterCache->GetCharacterCacheByGuid(friendGuid);
+    Optional<CharacterCacheEntry> playerData = sCharacterCache->GetCharacterCacheByGuid(friendGuid);
     if (!playerData)
         return;
 
@@ -129,6 +129,8 @@ void WorldSession::HandleAddIgnoreOpcode(WorldPacket& recv_data)
         // ignore list full
         if (!GetPlayer()->GetSocial()->AddToSocialList(ignoreGuid, SOCIAL_FLAG_IGNORED))
             ignoreResult = FRIEND_IGNORE_FULL;
+        else
+            GetPlayer()->UpdateChannelIgnore(ignoreGuid, true);
     }
 
     sSocialMgr->SendFriendStatus(GetPlayer(), ignoreResult, ignoreGuid, false);
@@ -142,6 +144,7 @@ void WorldSession::HandleDelIgnoreOpcode(WorldPacket& recv_data)
     recv_data >> IgnoreGUID;
 
     _player->GetSocial()->RemoveFromSocialList(IgnoreGUID, SOCIAL_FLAG_IGNORED);
+    _player->UpdateChannelIgnore(IgnoreGUID, false);
     sSocialMgr->SendFriendStatus(GetPlayer(), FRIEND_IGNORE_REMOVED, IgnoreGUID, false);
 }
 
@@ -16,6 +16,7 @@
  */
 
 #include "Map.h"
+#include "BattlefieldMgr.h"
 #include "Battleground.h"
 #include "CellImpl.h"
 #include "Chat.h"
@@ -23,6 +24,7 @@
 #include "DynamicTree.h"
 #include "GameTime.h"
 #include "Geometry.h"
+#include "GridTerrainPrefetcher.h"
 #include "GridNotifiers.h"
 #include "Group.h"
 #include "InstanceScript.h"
@@ -30,11 +32,13 @@
 #include "LFGMgr.h"
 #include "MapGrid.h"
 #include "MapInstanced.h"
+#include "MapMgr.h"
 #include "Metric.h"
 #include "MiscPackets.h"
 #include "Object.h"
 #include "ObjectAccessor.h"
 #include "ObjectMgr.h"
+#include "OutdoorPvPMgr.h"
 #include "Pet.h"
 #include "PoolMgr.h"
 #include "ScriptMgr.h"
@@ -88,6 +92,8 @@ void Map::OnCreateMap()
     // Instances load all grids by default (both base map and child maps)
     if (GetInstanceId())
         LoadAllGrids();
+    else if (!Instanceable() && sWorld->getBoolConfig(CONFIG_GRID_PREFETCH_ENABLE) && !sWorld->getBoolConfig(CONFIG_PRELOAD_ALL_NON_INSTANCED_MAP_GRIDS))
+        _gridTerrainPrefetcher = std::make_unique<GridTerrainPrefetcher>(this);
 
     sScriptMgr->OnCreateMap(this);
 }
@@ -413,6 +419,13 @@ void Map::MarkNearbyCellsOf(WorldObject* obj)
     }
 }
 
+void Map::FlushMovementBundles()
+{
+    for (MapReference const& ref : m_mapRefMgr)
+        if (Player* player = ref.GetSource())
+            player->GetSession()->FlushMovementBundle(false);
+}
+
 void Map::UpdatePlayerZoneStats(uint32 oldZone, uint32 newZone)
 {
     // Nothing to do if no change
@@ -435,6 +448,8 @@ void Map::Update(const uint32 t_diff, const uint32 s_diff, bool  /*thread*/)
     if (t_diff)
         _mapCollisionData.GetDynamicTree().update(t_diff);
 
+    _deferMovementRelay = MapMovementRelay::IsEnabledFor(m_mapRefMgr.getSize());
+
     // Update world sessions and players
     for (m_mapRefIter = m_mapRefMgr.begin(); m_mapRefIter != m_mapRefMgr.end(); ++m_mapRefIter)
     {
@@ -452,11 +467,22 @@ void Map::Update(const uint32 t_diff, const uint32 s_diff, bool  /*thread*/)
         }
     }
 
+    _deferMovementRelay = false;
+    _movementRelay.Deliver(this, *sMapMgr->GetMapUpdater());
+
     Events.Update(t_diff);
 
+    // Outdoor pvp and battlefields of the continent, otherwise updated by the world thread
+    if (!Instanceable() && sWorld->getBoolConfig(CONFIG_MAP_PVP_UPDATE))
+    {
+        sOutdoorPvPMgr->UpdateMap(this, s_diff);
+        sBattlefieldMgr->UpdateMap(this, s_diff);
+    }
+
     if (!t_diff)
     {
         HandleDelayedVisibility();
+        FlushMovementBundles();
         return;
     }
 
@@ -500,6 +526,9 @@ void Map::Update(const uint32 t_diff, const uint32 s_diff, bool  /*thread*/)
         }
     }
 
+    if (_gridTerrainPrefetcher)
+        _gridTerrainPrefetcher->Update(t_diff);
+
     UpdateNonPlayerObjects(t_diff);
 
     SendObjectUpdates();
@@ -523,6 +552,8 @@ void Map::Update(const uint32 t_diff, const uint32 s_diff, bool  /*thread*/)
 
     sScriptMgr->OnMapUpdate(this, t_diff);
 
+    FlushMovementBundles();
+
     METRIC_VALUE("map_creatures", uint64(GetObjectsStore().Size<Creature>()),
         METRIC_TAG("map_id", std::to_string(GetId())),
         METRIC_TAG("map_instanceid", std::to_string(GetInstanceId())));
@@ -530,6 +561,20 @@ void Map::Update(const uint32 t_diff, const uint32 s_diff, bool  /*thread*/)
     METRIC_VALUE("map_gameobjects", uint64(GetObjectsStore().Size<GameObject>()),
         METRIC_TAG("map_id", std::to_string(GetId())),
         METRIC_TAG("map_instanceid", std::to_string(GetInstanceId())));
+
+    if (sWorld->getBoolConfig(CONFIG_INTEREST_MANAGEMENT))
+    {
+        METRIC_VALUE("map_heartbeats_relayed", uint64(_relayedHeartbeats),
+            METRIC_TAG("map_id", std::to_string(GetId())),
+            METRIC_TAG("map_instanceid", std::to_string(GetInstanceId())));
+
+        METRIC_VALUE("map_heartbeats_skipped", uint64(_skippedHeartbeats),
+            METRIC_TAG("map_id", std::to_string(GetId())),
+            METRIC_TAG("map_instanceid", std::to_string(GetInstanceId())));
+    }
+
+    _relayedHeartbeats = 0;
+    _skippedHeartbeats = 0;
 }
 
 void Map::UpdateNonPlayerObjects(uint32 const diff)
@@ -1856,6 +1901,14 @@ void Map::SendToPlayers(WorldPacket const* data) const
         itr->GetSource()->SendDirectMessage(data);
 }
 
+void Map::SendMovementToSet(Unit const* mover, WorldPacket&& data, Player const* skippedReceiver)
+{
+    if (_deferMovementRelay)
+        _movementRelay.Send(mover, std::move(data), skippedReceiver);
+    else
+        mover->SendMessageToSet(&data, skippedReceiver);
+}
+
 template bool Map::AddToMap(Corpse*, bool);
 template bool Map::AddToMap(Creature*, bool);
 template bool Map::AddToMap(GameObject*, bool);
@@ -2298,6 +2351,15 @@ BattlegroundMap::~BattlegroundMap()
     }
 }
 
+void BattlegroundMap::Update(const uint32 t_diff, const uint32 s_diff, bool /*thread*/)
+{
+    Map::Update(t_diff, s_diff);
+
+    // Otherwise BattlegroundMgr::Update does it on the world thread
+    if (m_bg && sWorld->getBoolConfig(CONFIG_MAP_PVP_UPDATE))
+        m_bg->Update(s_diff);
+}
+
 void BattlegroundMap::InitVisibilityDistance()
 {
     //init visibility distance for BG/Arenas
@@ -29,6 +29,7 @@
 #include "GridRefMgr.h"
 #include "MapCollisionData.h"
 #include "MapGridManager.h"
+#include "MapMovementRelay.h"
 #include "MapRefMgr.h"
 #include "ObjectDefines.h"
 #include "ObjectGuid.h"
@@ -38,6 +39,7 @@
 #include "SpawnData.h"
 #include "Timer.h"
 #include "GridTerrainData.h"
+#include <atomic>
 #include <bitset>
 #include <list>
 #include <memory>
@@ -67,6 +69,7 @@ class StaticTransport;
 class MotionTransport;
 class PathGenerator;
 class WorldSession;
+class GridTerrainPrefetcher;
 
 enum WeatherState : uint32;
 
@@ -325,6 +328,12 @@ public:
 
     void SendToPlayers(WorldPacket const* data) const;
 
+    void AddRelayedHeartbeats(uint32 relayed, uint32 skipped) { _relayedHeartbeats += relayed; _skippedHeartbeats += skipped; }
+
+    // Relays the packet right away, or heartbeats after all sessions of the map were updated, see MapMovementRelay
+    void SendMovementToSet(Unit const* mover, WorldPacket&& data, Player const* skippedReceiver);
+    void FlushMovementRelay(WorldObject const* source) { _movementRelay.Flush(source); }
+
     typedef MapRefMgr PlayerList;
     [[nodiscard]] PlayerList const& GetPlayers() const { return m_mapRefMgr; }
 
@@ -564,6 +573,8 @@ public:
     MapCollisionData& GetMapCollisionData() { return _mapCollisionData; }
     MapCollisionData const& GetMapCollisionData()  const { return _mapCollisionData; }
 
+    GridTerrainPrefetcher* GetGridTerrainPrefetcher() { return _gridTerrainPrefetcher.get(); }
+
 private:
 
     template<class T> void InitializeObject(T* obj);
@@ -584,6 +595,14 @@ private:
     void ScriptsProcess();
 
     void SendObjectUpdates();
+    void FlushMovementBundles();
+
+    // Movement heartbeats sent and held back by interest management since the last map update
+    std::atomic<uint32> _relayedHeartbeats = 0;
+    std::atomic<uint32> _skippedHeartbeats = 0;
+
+    MapMovementRelay _movementRelay;
+    bool _deferMovementRelay = false;
 
 protected:
     // Type specific code for add/remove to/from grid
@@ -595,6 +614,7 @@ protected:
     MapGridManager _mapGridManager;
     MapEntry const* i_mapEntry;
     MapCollisionData _mapCollisionData;
+    std::unique_ptr<GridTerrainPrefetcher> _gridTerrainPrefetcher;
     uint8 i_spawnMode;
     uint32 i_InstanceId;
     uint32 m_unloadTimer;
@@ -744,6 +764,7 @@ public:
     BattlegroundMap(uint32 id, uint32 InstanceId, Map* _parent, uint8 spawnMode);
     ~BattlegroundMap() override;
 
+    void Update(const uint32, const uint32, bool thread = true) override;
     bool AddPlayerToMap(Player*) override;
     void RemovePlayerFromMap(Player*, bool) override;
     EnterState CannotEnter(Player* player, bool loginCheck = false) override;
@@ -68,6 +68,17 @@ int MapCollisionData::LoadMMapTile(uint32 tileX, uint32 tileY)
     return MMAP::MMapMgr::LoadTile(_mmapData._navMesh.get(), _map.GetId(), tileX, tileY);
 }
 
+int MapCollisionData::AddMMapTile(uint32 tileX, uint32 tileY, unsigned char* data, uint32 size)
+{
+    if (!DisableMgr::IsPathfindingEnabled(&_map) || !_mmapData._navMesh)
+    {
+        dtFree(data);
+        return MMAP::MMAP_LOAD_RESULT_IGNORED;
+    }
+
+    return MMAP::MMapMgr::AddTile(_mmapData._navMesh.get(), _map.GetId(), tileX, tileY, data, size);
+}
+
 bool StaticVMapCollisionData::isInLineOfSight(float x1, float y1, float z1, float x2, float y2, float z2, VMAP::ModelIgnoreFlags ignoreFlags) const
 {
 #if defined(ENABLE_VMAP_CHECKS)
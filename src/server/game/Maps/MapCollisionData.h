@@ -21,6 +21,7 @@
 #include "DynamicTree.h"
 #include "MapTree.h"
 #include "MMapMgr.h"
+#include "PathCorridorCache.h"
 #include "IVMapMgr.h"
 
 class Map;
@@ -61,12 +62,15 @@ class MMapData
 public:
     dtNavMesh const* GetNavMesh() const { return _navMesh.get(); }
     dtNavMeshQuery const* GetNavMeshQuery();
+    PathCorridorCache& GetPathCorridorCache() { return _pathCorridorCache; }
 
 protected:
     // _navMesh is a shared_ptr as it will point to a parent maps nav mesh (if exists) to save on memory
     std::shared_ptr<dtNavMesh> _navMesh;
     // navMeshQuery is not thread safe and needs its own instance per map
     MMAP::ManagedNavMeshQuery _navMeshQuery;
+    // like the query, per map as it is only used by the map thread
+    PathCorridorCache _pathCorridorCache;
 };
 
 // Map collision data holders (dynamic&static vmap, mmaps)
@@ -78,6 +82,8 @@ public:
 
     int LoadVMapTile(uint32 tileX, uint32 tileY);
     int LoadMMapTile(uint32 tileX, uint32 tileY);
+    // Adds a tile read ahead by MMapMgr::ReadTile, takes ownership of data
+    int AddMMapTile(uint32 tileX, uint32 tileY, unsigned char* data, uint32 size);
 
     DynamicVMapCollisionData& GetDynamicTree() { return _dynamicVMapData; }
     DynamicVMapCollisionData const& GetDynamicTree() const { return _dynamicVMapData; }
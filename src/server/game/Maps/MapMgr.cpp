@@ -20,6 +20,7 @@
 #include "DatabaseEnv.h"
 #include "GridDefines.h"
 #include "GridTerrainLoader.h"
+#include "GridTerrainPrefetcher.h"
 #include "Group.h"
 #include "InstanceSaveMgr.h"
 #include "LFGMgr.h"
@@ -59,6 +60,9 @@ void MapMgr::Initialize()
     // Start mtmaps if needed
     if (num_threads > 0)
         m_updater.activate(num_threads);
+
+    if (sWorld->getBoolConfig(CONFIG_GRID_PREFETCH_ENABLE))
+        GridTerrainPrefetcher::ActivateWorkers(sWorld->getIntConfig(CONFIG_GRID_PREFETCH_THREADS));
 }
 
 void MapMgr::InitializeVisibilityDistanceInfo()
@@ -335,6 +339,8 @@ void MapMgr::UnloadAll()
 
     if (m_updater.activated())
         m_updater.deactivate();
+
+    GridTerrainPrefetcher::DeactivateWorkers();
 }
 
 void MapMgr::GetNumInstances(uint32& dungeons, uint32& battlegrounds, uint32& arenas)
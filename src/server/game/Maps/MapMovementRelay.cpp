@@ -0,0 +1,161 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "MapMovementRelay.h"
+#include "GridNotifiers.h"
+#include "Map.h"
+#include "MapUpdater.h"
+#include "Metric.h"
+#include "Opcodes.h"
+#include "Unit.h"
+#include "World.h"
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+
+// Shared with the queued jobs, a job that starts after the delivery finished finds no batch left
+struct MapMovementRelay::Delivery
+{
+    explicit Delivery(Sender const& sender) : Send(sender) { }
+
+    Sender Send;
+    std::vector<MoverRelays> Movers;
+    std::vector<std::pair<std::size_t, std::size_t>> Batches;
+
+    std::atomic<std::size_t> NextBatch{0};
+    std::size_t DoneBatches = 0;
+    std::mutex Lock;
+    std::condition_variable Done;
+};
+
+bool MapMovementRelay::IsEnabledFor(uint32 playerCount)
+{
+    return sWorld->getBoolConfig(CONFIG_MAP_PARALLEL_MOVEMENT_RELAY)
+        && playerCount >= sWorld->getIntConfig(CONFIG_MAP_PARALLEL_MOVEMENT_RELAY_MIN_PLAYERS);
+}
+
+void MapMovementRelay::Send(Unit const* mover, WorldPacket&& packet, Player const* skippedReceiver)
+{
+    if (packet.GetOpcode() == MSG_MOVE_HEARTBEAT)
+    {
+        Add(mover, std::move(packet), skippedReceiver);
+        return;
+    }
+
+    Flush(mover);
+    _sender(mover, packet, skippedReceiver, mover->m_relayedHeartbeatCount);
+}
+
+void MapMovementRelay::Add(Unit const* mover, WorldPacket&& packet, Player const* skippedReceiver)
+{
+    auto [itr, inserted] = _moverIndex.emplace(mover, _movers.size());
+    if (inserted)
+        _movers.push_back({ mover, Acore::ComputeCellCoord(mover->GetPositionX(), mover->GetPositionY()).GetId(), {} });
+
+    _movers[itr->second].Relays.push_back({ skippedReceiver, mover->m_relayedHeartbeatCount, std::move(packet) });
+}
+
+void MapMovementRelay::FlushMover(WorldObject const* mover)
+{
+    auto itr = _moverIndex.find(mover);
+    if (itr == _moverIndex.end())
+        return;
+
+    // The entry stays empty until the delivery, a heartbeat queued after this one starts a new entry
+    MoverRelays& moverRelays = _movers[itr->second];
+    _moverIndex.erase(itr);
+
+    SendRelays(_sender, moverRelays);
+    moverRelays.Relays.clear();
+}
+
+void MapMovementRelay::Deliver(Map* map, MapUpdater& updater)
+{
+    if (_movers.empty())
+        return;
+
+    std::shared_ptr<Delivery> delivery = std::make_shared<Delivery>(_sender);
+    delivery->Movers.swap(_movers);
+    _moverIndex.clear();
+
+    // Movers flushed during the update left their entry empty
+    std::vector<MoverRelays>& movers = delivery->Movers;
+    movers.erase(std::remove_if(movers.begin(), movers.end(), [](MoverRelays const& moverRelays) { return moverRelays.Relays.empty(); }), movers.end());
+    if (movers.empty())
+        return;
+
+    std::stable_sort(movers.begin(), movers.end(), [](MoverRelays const& left, MoverRelays const& right) { return left.CellId < right.CellId; });
+
+    for (std::size_t begin = 0; begin < movers.size();)
+    {
+        std::size_t end = begin + 1;
+        while (end < movers.size() && movers[end].CellId == movers[begin].CellId)
+            ++end;
+
+        delivery->Batches.emplace_back(begin, end);
+        begin = end;
+    }
+
+    if (delivery->Batches.size() > 1 && updater.activated())
+    {
+        // The map thread takes batches as well, one worker less is enough
+        std::size_t const helpers = std::min(delivery->Batches.size(), updater.thread_count()) - 1;
+        for (std::size_t i = 0; i < helpers; ++i)
+            updater.schedule_job([delivery]() { DeliverBatches(*delivery); });
+    }
+
+    DeliverBatches(*delivery);
+
+    std::unique_lock<std::mutex> guard(delivery->Lock);
+    delivery->Done.wait(guard, [&delivery]() { return delivery->DoneBatches == delivery->Batches.size(); });
+
+    METRIC_VALUE("map_movement_relay_batches", uint64(delivery->Batches.size()),
+        METRIC_TAG("map_id", std::to_string(map->GetId())),
+        METRIC_TAG("map_instanceid", std::to_string(map->GetInstanceId())));
+}
+
+void MapMovementRelay::SendToSet(Unit const* mover, WorldPacket const& packet, Player const* skippedReceiver, uint32 heartbeatCount)
+{
+    mover->DeliverMessageToSet(&packet, skippedReceiver, heartbeatCount);
+}
+
+void MapMovementRelay::SendRelays(Sender const& sender, MoverRelays const& moverRelays)
+{
+    if (!moverRelays.Mover->IsInWorld())
+        return;
+
+    for (Relay const& relay : moverRelays.Relays)
+        sender(moverRelays.Mover, relay.Packet, relay.SkippedReceiver, relay.HeartbeatCount);
+}
+
+void MapMovementRelay::DeliverBatches(Delivery& delivery)
+{
+    std::size_t done = 0;
+    for (std::size_t batch; (batch = delivery.NextBatch.fetch_add(1, std::memory_order_relaxed)) < delivery.Batches.size(); ++done)
+        for (std::size_t i = delivery.Batches[batch].first; i < delivery.Batches[batch].second; ++i)
+            SendRelays(delivery.Send, delivery.Movers[i]);
+
+    if (!done)
+        return;
+
+    std::lock_guard<std::mutex> guard(delivery.Lock);
+    delivery.DoneBatches += done;
+    if (delivery.DoneBatches == delivery.Batches.size())
+        delivery.Done.notify_all();
+}
@@ -0,0 +1,107 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef ACORE_MAP_MOVEMENT_RELAY_H
+#define ACORE_MAP_MOVEMENT_RELAY_H
+
+#include "WorldPacket.h"
+#include <functional>
+#include <unordered_map>
+#include <vector>
+
+class Map;
+class MapUpdater;
+class Player;
+class Unit;
+class WorldObject;
+
+/*
+ * Movement packets of the players of a map, relayed to the players in sight after all sessions were updated.
+ *
+ * The movement handlers change the state of the map and stay serial, the relay to every player in sight is
+ * what grows with the crowd. The relays are grouped into batches per cell of the mover, which the map thread
+ * and idle MapUpdater workers deliver in parallel. Nothing on the map changes during the delivery: movers and
+ * receivers are only read and WorldSession::SendPacket is thread-safe.
+ *
+ * Only the heartbeats wait for the delivery. Anything else the mover sends to the players in sight, its other
+ * movement packets, spell casts or a teleport, first flushes its queued heartbeats, so the players in sight never
+ * get a heartbeat after a packet that was sent later.
+ *
+ * All heartbeats of a mover go to the batch of the cell it was in first, in the order they were handled.
+ * The batches are built in cell order and do not depend on the threads delivering them.
+ */
+class MapMovementRelay
+{
+public:
+    // Sends a packet of the mover to the players in sight, called by the map thread and the workers at the same time
+    typedef std::function<void(Unit const* mover, WorldPacket const& packet, Player const* skippedReceiver, uint32 heartbeatCount)> Sender;
+
+    MapMovementRelay() : MapMovementRelay(&SendToSet) { }
+    explicit MapMovementRelay(Sender sender) : _sender(std::move(sender)) { }
+
+    MapMovementRelay(MapMovementRelay const&) = delete;
+    MapMovementRelay& operator=(MapMovementRelay const&) = delete;
+
+    // MapUpdate.ParallelMovementRelay and its MinPlayers threshold
+    static bool IsEnabledFor(uint32 playerCount);
+
+    // Queues the heartbeats, any other packet is sent right away after the queued heartbeats of the mover
+    void Send(Unit const* mover, WorldPacket&& packet, Player const* skippedReceiver);
+    void Add(Unit const* mover, WorldPacket&& packet, Player const* skippedReceiver);
+    [[nodiscard]] bool IsEmpty() const { return _movers.empty(); }
+
+    // Sends the queued heartbeats of the mover, called before it sends anything else to the players in sight
+    void Flush(WorldObject const* mover)
+    {
+        if (!_moverIndex.empty())
+            FlushMover(mover);
+    }
+
+    // Map thread, blocks until every packet was sent
+    void Deliver(Map* map, MapUpdater& updater);
+
+private:
+    struct Relay
+    {
+        Player const* SkippedReceiver;
+        // The mover keeps counting while the packets wait for the delivery
+        uint32 HeartbeatCount;
+        WorldPacket Packet;
+    };
+
+    struct MoverRelays
+    {
+        Unit const* Mover;
+        // Cell of the first packet, the mover may cross a cell border between two of them
+        uint32 CellId;
+        std::vector<Relay> Relays;
+    };
+
+    struct Delivery;
+
+    void FlushMover(WorldObject const* mover);
+
+    static void SendToSet(Unit const* mover, WorldPacket const& packet, Player const* skippedReceiver, uint32 heartbeatCount);
+    static void SendRelays(Sender const& sender, MoverRelays const& moverRelays);
+    static void DeliverBatches(Delivery& delivery);
+
+    Sender _sender;
+    std::vector<MoverRelays> _movers;
+    std::unordered_map<WorldObject const*, std::size_t> _moverIndex;
+};
+
+#endif
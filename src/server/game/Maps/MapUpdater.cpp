@@ -90,6 +90,21 @@ private:
     uint32 m_diff;
 };
 
+class JobRequest : public UpdateRequest
+{
+public:
+    JobRequest(MapUpdater& u, std::function<void()> job) : m_updater(u), m_job(std::move(job)) {}
+
+    void call() override
+    {
+        m_job();
+        m_updater.update_finished();
+    }
+private:
+    MapUpdater& m_updater;
+    std::function<void()> m_job;
+};
+
 MapUpdater::MapUpdater() : pending_requests(0), _cancelationToken(false)
 {
 }
@@ -153,6 +168,11 @@ void MapUpdater::schedule_lfg_update(uint32 diff)
     schedule_task(new LFGUpdateRequest(*this, diff));
 }
 
+void MapUpdater::schedule_job(std::function<void()> job)
+{
+    schedule_task(new JobRequest(*this, std::move(job)));
+}
+
 bool MapUpdater::activated()
 {
     return !_workerThreads.empty();
@@ -21,6 +21,7 @@
 #include "Define.h"
 #include "PCQueue.h"
 #include <condition_variable>
+#include <functional>
 #include <thread>
 #include <atomic>
 
@@ -37,10 +38,12 @@ public:
     void schedule_update(Map& map, uint32 diff, uint32 s_diff);
     void schedule_map_preload(uint32 mapid);
     void schedule_lfg_update(uint32 diff);
+    void schedule_job(std::function<void()> job);
     void wait();
     void activate(std::size_t num_threads);
     void deactivate();
     bool activated();
+    std::size_t thread_count() const { return _workerThreads.size(); }
     void update_finished();
 
 private:
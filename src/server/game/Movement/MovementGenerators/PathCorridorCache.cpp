@@ -0,0 +1,103 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "PathCorridorCache.h"
+#include "DetourNavMeshQuery.h"
+#include "Timer.h"
+#include "World.h"
+#include <functional>
+
+std::size_t PathCorridorCache::KeyHash::operator()(Key const& key) const
+{
+    std::size_t hash = std::hash<dtPolyRef>()(key.StartPoly);
+    hash ^= std::hash<dtPolyRef>()(key.EndPoly) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+    hash ^= std::hash<uint32>()((uint32(key.IncludeFlags) << 16) | key.ExcludeFlags) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+    return hash;
+}
+
+bool PathCorridorCache::IsEnabled()
+{
+    return sWorld->getIntConfig(CONFIG_MMAP_PATH_CACHE_SIZE) > 0;
+}
+
+PathCorridorCache::Key PathCorridorCache::MakeKey(dtPolyRef startPoly, dtPolyRef endPoly, dtQueryFilter const& filter)
+{
+    return { startPoly, endPoly, filter.getIncludeFlags(), filter.getExcludeFlags() };
+}
+
+PathCorridorCache::Corridor const* PathCorridorCache::Find(dtPolyRef startPoly, dtPolyRef endPoly, dtNavMeshQuery const& query, dtQueryFilter const& filter)
+{
+    auto itr = _entries.find(MakeKey(startPoly, endPoly, filter));
+    if (itr == _entries.end())
+        return nullptr;
+
+    if (GetMSTimeDiffToNow(itr->second.StoreTime) > sWorld->getIntConfig(CONFIG_MMAP_PATH_CACHE_DURATION))
+    {
+        _entries.erase(itr);
+        return nullptr;
+    }
+
+    // the salt of a poly ref changes when its tile is unloaded, so a reloaded tile invalidates the corridor too
+    for (dtPolyRef polyRef : itr->second.Polys)
+    {
+        if (!query.isValidPolyRef(polyRef, &filter))
+        {
+            _entries.erase(itr);
+            return nullptr;
+        }
+    }
+
+    return &itr->second.Polys;
+}
+
+void PathCorridorCache::Store(dtPolyRef startPoly, dtPolyRef endPoly, dtQueryFilter const& filter, dtPolyRef const* polys, uint32 polyCount)
+{
+    uint32 const maxSize = sWorld->getIntConfig(CONFIG_MMAP_PATH_CACHE_SIZE);
+    if (!maxSize)
+        return;
+
+    Key const key = MakeKey(startPoly, endPoly, filter);
+    if (_entries.size() >= maxSize && !_entries.count(key))
+        MakeRoom(maxSize);
+
+    Entry& entry = _entries[key];
+    entry.Polys.assign(polys, polys + polyCount);
+    entry.StoreTime = getMSTime();
+    entry.StoreOrder = _nextStoreOrder++;
+}
+
+void PathCorridorCache::MakeRoom(uint32 maxSize)
+{
+    uint32 const duration = sWorld->getIntConfig(CONFIG_MMAP_PATH_CACHE_DURATION);
+    auto oldest = _entries.end();
+    for (auto itr = _entries.begin(); itr != _entries.end();)
+    {
+        if (GetMSTimeDiffToNow(itr->second.StoreTime) > duration)
+            itr = _entries.erase(itr);
+        else
+        {
+            if (oldest == _entries.end() || itr->second.StoreOrder < oldest->second.StoreOrder)
+                oldest = itr;
+
+            ++itr;
+        }
+    }
+
+    // Still full of fresh corridors, make room for the newest one
+    if (_entries.size() >= maxSize)
+        _entries.erase(oldest);
+}
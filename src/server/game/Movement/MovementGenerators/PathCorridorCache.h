@@ -0,0 +1,86 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _PATH_CORRIDOR_CACHE_H
+#define _PATH_CORRIDOR_CACHE_H
+
+#include "Define.h"
+#include "DetourNavMesh.h"
+#include <unordered_map>
+#include <vector>
+
+class dtNavMeshQuery;
+class dtQueryFilter;
+
+/*
+ * Recently found polygon corridors of a map, keyed by their start and end polygon and the query filter.
+ * Units chasing the same target keep asking for the same start/end polygon pair, so the A* search of
+ * dtNavMeshQuery::findPath is only run once; the point path is still built from the actual positions.
+ * Paths are still generated synchronously on the map update thread, the cache only saves repeated searches.
+ *
+ * Not thread safe, owned by the MMapData of a single map.
+ */
+class PathCorridorCache
+{
+public:
+    typedef std::vector<dtPolyRef> Corridor;
+
+    // Cached corridor younger than the configured duration whose polys are all still loaded, or nullptr.
+    // A corridor crossing an unloaded or reloaded tile is dropped.
+    Corridor const* Find(dtPolyRef startPoly, dtPolyRef endPoly, dtNavMeshQuery const& query, dtQueryFilter const& filter);
+    // Evicts the expired corridors when full, then the oldest one
+    void Store(dtPolyRef startPoly, dtPolyRef endPoly, dtQueryFilter const& filter, dtPolyRef const* polys, uint32 polyCount);
+    void Clear() { _entries.clear(); }
+
+    [[nodiscard]] std::size_t GetSize() const { return _entries.size(); }
+
+    [[nodiscard]] static bool IsEnabled();
+
+private:
+    struct Key
+    {
+        dtPolyRef StartPoly;
+        dtPolyRef EndPoly;
+        uint16 IncludeFlags;
+        uint16 ExcludeFlags;
+
+        bool operator==(Key const& right) const
+        {
+            return StartPoly == right.StartPoly && EndPoly == right.EndPoly && IncludeFlags == right.IncludeFlags && ExcludeFlags == right.ExcludeFlags;
+        }
+    };
+
+    struct KeyHash
+    {
+        std::size_t operator()(Key const& key) const;
+    };
+
+    struct Entry
+    {
+        Corridor Polys;
+        uint32 StoreTime;
+        uint64 StoreOrder;
+    };
+
+    static Key MakeKey(dtPolyRef startPoly, dtPolyRef endPoly, dtQueryFilter const& filter);
+    void MakeRoom(uint32 maxSize);
+
+    std::unordered_map<Key, Entry, KeyHash> _entries;
+    uint64 _nextStoreOrder = 0;
+};
+
+#endif
@@ -23,6 +23,7 @@
 #include "MMapMgr.h"
 #include "Map.h"
 #include "Metric.h"
+#include "PathCorridorCache.h"
 
 // Blades Edge Arena Ropes normalization
 namespace
@@ -127,7 +128,7 @@ PathGenerator::PathGenerator(WorldObject const* owner) :
     _polyLength(0), _type(PATHFIND_BLANK), _useStraightPath(false), _forceDestination(false),
     _slopeCheck(false), _pointPathLimit(MAX_POINT_PATH_LENGTH), _useRaycast(false),
     _endPosition(G3D::Vector3::zero()), _source(owner), _navMesh(nullptr),
-    _navMeshQuery(nullptr)
+    _navMeshQuery(nullptr), _corridorCache(nullptr)
 {
     memset(_pathPolyRefs, 0, sizeof(_pathPolyRefs));
 
@@ -135,6 +136,9 @@ PathGenerator::PathGenerator(WorldObject const* owner) :
     {
         _navMesh = _source->GetMap()->GetMapCollisionData().GetMMapData().GetNavMesh();
         _navMeshQuery = _source->GetMap()->GetMapCollisionData().GetMMapData().GetNavMeshQuery();
+
+        if (PathCorridorCache::IsEnabled())
+            _corridorCache = &_source->GetMap()->GetMapCollisionData().GetMMapData().GetPathCorridorCache();
     }
 
     CreateFilter();
@@ -565,6 +569,8 @@ void PathGenerator::BuildPolyPath(G3D::Vector3 const& startPos, G3D::Vector3 con
                 return;
             }
         }
+        else if (LoadCachedCorridor(startPoly, endPoly))
+            dtResult = DT_SUCCESS;
         else
         {
             dtResult = _navMeshQuery->findPath(
@@ -576,6 +582,11 @@ void PathGenerator::BuildPolyPath(G3D::Vector3 const& startPos, G3D::Vector3 con
                 _pathPolyRefs,     // [out] path
                 (int*)&_polyLength,
                 MAX_PATH_LENGTH);   // max number of polygons in output path
+
+            // only complete corridors are worth reusing
+            if (_corridorCache && _polyLength && dtStatusSucceed(dtResult) && !dtStatusDetail(dtResult, DT_PARTIAL_RESULT)
+                && _pathPolyRefs[_polyLength - 1] == endPoly)
+                _corridorCache->Store(startPoly, endPoly, _filter, _pathPolyRefs, _polyLength);
         }
 
         if (!_polyLength || dtStatusFailed(dtResult))
@@ -612,6 +623,20 @@ void PathGenerator::BuildPolyPath(G3D::Vector3 const& startPos, G3D::Vector3 con
     BuildPointPath(startPoint, endPoint);
 }
 
+bool PathGenerator::LoadCachedCorridor(dtPolyRef startPoly, dtPolyRef endPoly)
+{
+    if (!_corridorCache)
+        return false;
+
+    PathCorridorCache::Corridor const* corridor = _corridorCache->Find(startPoly, endPoly, *_navMeshQuery, _filter);
+    if (!corridor || corridor->empty() || corridor->size() > MAX_PATH_LENGTH)
+        return false;
+
+    std::copy(corridor->begin(), corridor->end(), _pathPolyRefs);
+    _polyLength = corridor->size();
+    return true;
+}
+
 void PathGenerator::BuildPointPath(float const* startPoint, float const* endPoint)
 {
     float pathPoints[MAX_POINT_PATH_LENGTH * VERTEX_SIZE];
@@ -26,6 +26,7 @@
 #include "SharedDefines.h"
 #include <G3D/Vector3.h>
 
+class PathCorridorCache;
 class Unit;
 class WorldObject;
 
@@ -147,6 +148,7 @@ class PathGenerator
         WorldObject const* const _source;       // the object that is moving
         dtNavMesh const* _navMesh;              // the nav mesh
         dtNavMeshQuery const* _navMeshQuery;    // the nav mesh query used to find the path
+        PathCorridorCache* _corridorCache;      // recently found poly paths of the map
 
         dtQueryFilterExt _filter;  // use single filter for all movements, update it when needed
 
@@ -164,6 +166,7 @@ class PathGenerator
         [[nodiscard]] bool HaveTile(G3D::Vector3 const& p) const;
 
         void BuildPolyPath(G3D::Vector3 const& startPos, G3D::Vector3 const& endPos);
+        bool LoadCachedCorridor(dtPolyRef startPoly, dtPolyRef endPoly);
         void BuildPointPath(float const* startPoint, float const* endPoint);
         void BuildShortcut();
 
@@ -17,9 +17,11 @@
 
 #include "OutdoorPvPMgr.h"
 #include "DisableMgr.h"
+#include "Map.h"
 #include "ObjectMgr.h"
 #include "Player.h"
 #include "ScriptMgr.h"
+#include "World.h"
 
 OutdoorPvPMgr::OutdoorPvPMgr()
 {
@@ -35,6 +37,7 @@ OutdoorPvPMgr* OutdoorPvPMgr::instance()
 
 void OutdoorPvPMgr::Die()
 {
+    m_OutdoorPvPByMap.clear();
     m_OutdoorPvPSet.clear();
     m_OutdoorPvPDatas.clear();
 }
@@ -100,6 +103,9 @@ void OutdoorPvPMgr::InitOutdoorPvP()
             continue;
         }
 
+        if (Map* map = pvp->GetMap())
+            m_OutdoorPvPByMap[map->GetId()].OutdoorPvPs.push_back(pvp.get());
+
         m_OutdoorPvPSet.emplace_back(std::move(pvp));
     }
 
@@ -161,8 +167,14 @@ void OutdoorPvPMgr::Update(uint32 diff)
 
     if (m_UpdateTimer > OUTDOORPVP_OBJECTIVE_UPDATE_INTERVAL)
     {
+        bool const mapUpdate = sWorld->getBoolConfig(CONFIG_MAP_PVP_UPDATE);
+
         for (auto const& itr : m_OutdoorPvPSet)
         {
+            // updated by the map thread of its continent instead
+            if (mapUpdate && itr->GetMap())
+                continue;
+
             itr->Update(m_UpdateTimer);
         }
 
@@ -170,6 +182,24 @@ void OutdoorPvPMgr::Update(uint32 diff)
     }
 }
 
+void OutdoorPvPMgr::UpdateMap(Map* map, uint32 diff)
+{
+    auto itr = m_OutdoorPvPByMap.find(map->GetId());
+    if (itr == m_OutdoorPvPByMap.end())
+        return;
+
+    MapOutdoorPvP& mapOutdoorPvP = itr->second;
+    mapOutdoorPvP.UpdateTimer += diff;
+
+    if (mapOutdoorPvP.UpdateTimer > OUTDOORPVP_OBJECTIVE_UPDATE_INTERVAL)
+    {
+        for (OutdoorPvP* pvp : mapOutdoorPvP.OutdoorPvPs)
+            pvp->Update(mapOutdoorPvP.UpdateTimer);
+
+        mapOutdoorPvP.UpdateTimer = 0;
+    }
+}
+
 bool OutdoorPvPMgr::HandleCustomSpell(Player* player, uint32 spellId, GameObject* go)
 {
     // pussywizard: no mutex because not affecting other players
@@ -74,6 +74,9 @@ public:
 
     void Update(uint32 diff);
 
+    // called by the map thread of a continent with MapUpdate.PvP
+    void UpdateMap(Map* map, uint32 diff);
+
     void HandleGossipOption(Player* player, Creature* creatured, uint32 gossipid);
 
     bool CanTalkTo(Player* player, Creature* creature, GossipMenuItems const& gso);
@@ -97,6 +100,15 @@ private:
 
     // update interval
     uint32 m_UpdateTimer;
+
+    // outdoor pvp events of each continent, filled on init so every map thread only touches its own entry
+    struct MapOutdoorPvP
+    {
+        std::vector<OutdoorPvP*> OutdoorPvPs;
+        uint32 UpdateTimer = 0;
+    };
+
+    std::unordered_map<uint32 /*mapid*/, MapOutdoorPvP> m_OutdoorPvPByMap;
 };
 
 #define sOutdoorPvPMgr OutdoorPvPMgr::instance()
@@ -26,6 +26,7 @@ void ScriptMgr::OnBattlegroundStart(Battleground* bg)
 
 void ScriptMgr::OnBattlegroundEndReward(Battleground* bg, Player* player, TeamId winnerTeamId)
 {
+    std::lock_guard<std::recursive_mutex> lock(_pvpEndHooksLock);
     CALL_ENABLED_HOOKS(AllBattlegroundScript, ALLBATTLEGROUNDHOOK_ON_BATTLEGROUND_END_REWARD, script->OnBattlegroundEndReward(bg, player, winnerTeamId));
 }
 
@@ -91,6 +92,7 @@ bool ScriptMgr::OnBeforeSendExitMessageArenaQueue(BattlegroundQueue* queue, Grou
 
 void ScriptMgr::OnBattlegroundEnd(Battleground* bg, TeamId winnerTeam)
 {
+    std::lock_guard<std::recursive_mutex> lock(_pvpEndHooksLock);
     CALL_ENABLED_HOOKS(AllBattlegroundScript, ALLBATTLEGROUNDHOOK_ON_BATTLEGROUND_END, script->OnBattlegroundEnd(bg, winnerTeam));
 }
 
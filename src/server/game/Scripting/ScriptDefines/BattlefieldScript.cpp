@@ -46,6 +46,7 @@ void ScriptMgr::OnBattlefieldBeforeInvitePlayerToWar(Battlefield* bf, Player* pl
 
 void ScriptMgr::OnBattlefieldWarEnd(Battlefield* bf, bool endByTimer)
 {
+    std::lock_guard<std::recursive_mutex> lock(_pvpEndHooksLock);
     CALL_ENABLED_HOOKS(BattlefieldScript, BATTLEFIELDHOOK_ON_WAR_END, script->OnBattlefieldWarEnd(bf, endByTimer));
 }
 
@@ -37,6 +37,7 @@
 #include "Weather.h"
 #include "World.h"
 #include <atomic>
+#include <mutex>
 
 // Add support old api modules
 #include "AllScriptsObjects.h"
@@ -736,6 +737,10 @@ private:
     //atomic op counter for active scripts amount
     std::atomic<long> _scheduledScripts;
 
+    // With MapUpdate.PvP battlegrounds and battlefields end on their map threads,
+    // their end hooks are serialized so scripts keep seeing them one at a time (a hook may end another one)
+    std::recursive_mutex _pvpEndHooksLock;
+
     ScriptLoaderCallbackType _script_loader_callback;
     ModulesLoaderCallbackType _modules_loader_callback;
 };
@@ -0,0 +1,204 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _LOGINQUEUE_H
+#define _LOGINQUEUE_H
+
+#include "Define.h"
+#include "Errors.h"
+#include <unordered_map>
+#include <vector>
+
+/*
+ * Login queue with O(log n) positions.
+ *
+ * Every queued session takes the next slot, a Fenwick tree over the slots counts the sessions still
+ * queued before a given one. Slots of sessions that left stay empty until the slots run out, then
+ * the queue is renumbered in one pass.
+ *
+ * Position changes are not sent when a session leaves: UpdatePositions reports every session whose
+ * position changed since it was last reported, once per session update instead of once per leave.
+ */
+template<class T>
+class LoginQueue
+{
+    static constexpr uint32 MinCapacity = 64;
+
+    struct Entry
+    {
+        T* Session = nullptr;
+        uint32 ReportedPosition = 0;
+    };
+
+public:
+    LoginQueue() { Reset(MinCapacity); }
+
+    /// Queues the session at the end, returns its position
+    uint32 Push(T* session)
+    {
+        ASSERT(session && !_slots.count(session));
+
+        if (_tail == _entries.size())
+            Renumber();
+
+        uint32 const slot = _tail++;
+        _entries[slot].Session = session;
+        Add(slot, 1);
+        _slots[session] = slot;
+
+        _entries[slot].ReportedPosition = uint32(_slots.size());
+        return _entries[slot].ReportedPosition;
+    }
+
+    bool Remove(T* session)
+    {
+        auto itr = _slots.find(session);
+        if (itr == _slots.end())
+            return false;
+
+        RemoveSlot(itr->second);
+        _slots.erase(itr);
+        return true;
+    }
+
+    T* Front()
+    {
+        while (_head < _tail && !_entries[_head].Session)
+            ++_head;
+
+        return _head < _tail ? _entries[_head].Session : nullptr;
+    }
+
+    void PopFront()
+    {
+        if (T* session = Front())
+            Remove(session);
+    }
+
+    /// 1 for the front of the queue, 0 if the session is not queued
+    [[nodiscard]] uint32 GetPosition(T* session) const
+    {
+        auto itr = _slots.find(session);
+        return itr != _slots.end() ? Prefix(itr->second) : 0;
+    }
+
+    [[nodiscard]] uint32 Size() const { return uint32(_slots.size()); }
+    [[nodiscard]] bool Empty() const { return _slots.empty(); }
+
+    void Clear()
+    {
+        _slots.clear();
+        Reset(MinCapacity);
+    }
+
+    /// Calls report(session, position) for the sessions whose position changed since it was last reported
+    template<class Report>
+    void UpdatePositions(Report&& report)
+    {
+        if (!_positionsChanged)
+            return;
+
+        _positionsChanged = false;
+
+        uint32 position = 0;
+        for (uint32 slot = _head; slot < _tail; ++slot)
+        {
+            Entry& entry = _entries[slot];
+            if (!entry.Session)
+                continue;
+
+            if (entry.ReportedPosition != ++position)
+            {
+                entry.ReportedPosition = position;
+                report(entry.Session, position);
+            }
+        }
+    }
+
+private:
+    void RemoveSlot(uint32 slot)
+    {
+        _entries[slot] = Entry();
+        Add(slot, -1);
+        _positionsChanged = true;
+    }
+
+    void Add(uint32 slot, int32 value)
+    {
+        for (uint32 i = slot + 1; i <= _entries.size(); i += i & -i)
+            _tree[i] += value;
+    }
+
+    [[nodiscard]] uint32 Prefix(uint32 slot) const
+    {
+        uint32 sum = 0;
+        for (uint32 i = slot + 1; i > 0; i -= i & -i)
+            sum += _tree[i];
+
+        return sum;
+    }
+
+    // Moves the queued sessions to the first slots, keeps at least half of the slots free
+    void Renumber()
+    {
+        std::vector<Entry> entries;
+        entries.reserve(_slots.size());
+        for (uint32 slot = _head; slot < _tail; ++slot)
+            if (_entries[slot].Session)
+                entries.push_back(_entries[slot]);
+
+        uint32 capacity = MinCapacity;
+        while (capacity < entries.size() * 2)
+            capacity *= 2;
+
+        Reset(capacity);
+
+        for (Entry const& entry : entries)
+        {
+            _slots[entry.Session] = _tail;
+            _entries[_tail++] = entry;
+        }
+
+        // Linear Fenwick tree build, every slot below the tail is taken
+        for (uint32 i = 1; i <= _entries.size(); ++i)
+        {
+            if (i <= _tail)
+                _tree[i] += 1;
+
+            uint32 const parent = i + (i & -i);
+            if (parent <= _entries.size())
+                _tree[parent] += _tree[i];
+        }
+    }
+
+    void Reset(uint32 capacity)
+    {
+        _entries.assign(capacity, Entry());
+        _tree.assign(capacity + 1, 0);
+        _head = 0;
+        _tail = 0;
+    }
+
+    std::vector<Entry> _entries;
+    std::vector<int32> _tree;
+    std::unordered_map<T*, uint32> _slots;
+    uint32 _head = 0;
+    uint32 _tail = 0;
+    bool _positionsChanged = false;
+};
+
+#endif
@@ -82,6 +82,39 @@ bool MapSessionFilter::Process(WorldPacket* packet)
     return player->IsInWorld();
 }
 
+bool SessionLocalFilter::Process(WorldPacket* packet)
+{
+    // The handlers below only write their own session and queue database work. What they read besides that
+    // (templates, the character cache, other players) is not written while the world thread waits for this pass.
+    // The world thread would otherwise handle them itself, map thread (PROCESS_THREADSAFE) opcodes gain nothing here.
+    switch (packet->GetOpcode())
+    {
+        // Character screen and account data
+        case CMSG_CHAR_ENUM:
+        case CMSG_REALM_SPLIT:
+        case CMSG_READY_FOR_ACCOUNT_DATA_TIMES:
+        case CMSG_REQUEST_ACCOUNT_DATA:
+        case CMSG_UPDATE_ACCOUNT_DATA:
+        // Name of every unit a client meets, the most frequent query by far: character cache and the connected player
+        case CMSG_NAME_QUERY:
+        // Quest log, gossip and books: static templates and locales
+        case CMSG_QUEST_QUERY:
+        case CMSG_NPC_TEXT_QUERY:
+        case CMSG_PAGE_TEXT_QUERY:
+        case CMSG_ITEM_NAME_QUERY:
+        // Clock and played time, sent by every client at login and on a timer
+        case CMSG_QUERY_TIME:
+        case CMSG_WORLD_STATE_UI_TIMER_UPDATE:
+        case CMSG_PLAYED_TIME:
+            break;
+        default:
+            return false;
+    }
+
+    // Kicks and bans reach other sessions and the ban tables, the packet that triggers one is left to the world thread
+    return !m_pSession->AntiDOS.IsKickOrBanDue(*packet, GameTime::GetGameTime().count());
+}
+
 //we should process ALL packets when player is not in world/logged in
 //OR packet handler is not thread-safe!
 bool WorldSessionFilter::Process(WorldPacket* packet)
@@ -180,9 +213,7 @@ WorldSession::~WorldSession()
     delete _RBACData;
 
     ///- empty incoming packet queue
-    WorldPacket* packet = nullptr;
-    while (_recvQueue.next(packet))
-        delete packet;
+    _recvQueue.Clear();
 
     LoginDatabase.Execute("UPDATE account SET online = 0 WHERE id = {};", GetAccountId());     // One-time query
 }
@@ -298,11 +329,32 @@ ObjectGuid::LowType WorldSession::GetGuidLow() const
     return GetPlayer() ? GetPlayer()->GetGUID().GetCounter() : 0;
 }
 
+void WorldSession::SetSecurity(AccountTypes security)
+{
+    _security = security;
+
+    // the who list caches the security of each player
+    if (_player)
+        sWhoListCacheMgr->MarkDirty(_player->GetGUID());
+}
+
 /// Send a packet to the client
 void WorldSession::SendPacket(WorldPacket const* packet)
+{
+    if (PrepareSendPacket(*packet))
+        m_Socket->SendPacket(*packet);
+}
+
+void WorldSession::SendSharedPacket(std::shared_ptr<WorldPacket const> const& packet)
+{
+    if (PrepareSendPacket(*packet))
+        m_Socket->SendPacket(packet);
+}
+
+bool WorldSession::PrepareSendPacket(WorldPacket const& packet)
 {
     if (!m_Socket)
-        return;
+        return false;
 
 #if defined(ACORE_DEBUG)
     // Code for network use statistic
@@ -320,10 +372,10 @@ void WorldSession::SendPacket(WorldPacket const* packet)
     if ((cur_time - lastTime) < 60)
     {
         sendPacketCount += 1;
-        sendPacketBytes += packet->size();
+        sendPacketBytes += packet.size();
 
         sendLastPacketCount += 1;
-        sendLastPacketBytes += packet->size();
+        sendLastPacketBytes += packet.size();
     }
     else
     {
@@ -336,22 +388,60 @@ void WorldSession::SendPacket(WorldPacket const* packet)
 
         lastTime = cur_time;
         sendLastPacketCount = 1;
-        sendLastPacketBytes = packet->wpos();               // wpos is real written size
+        sendLastPacketBytes = packet.wpos();                // wpos is real written size
     }
 #endif                                                      // !ACORE_DEBUG
 
-    if (!sScriptMgr->CanPacketSend(this, *packet))
+    if (!sScriptMgr->CanPacketSend(this, packet))
+        return false;
+
+    if (sWorld->getBoolConfig(CONFIG_NETWORK_COMPRESSED_MOVES) && WorldSessionMovementBundle::CanBundle(packet))
     {
-        return;
+        std::lock_guard<std::mutex> guard(_movementBundleLock);
+        _movementBundle.Add(packet);
+        _hasMovementBundle = true;
+
+        if (_movementBundle.GetSize() >= sWorld->getIntConfig(CONFIG_NETWORK_COMPRESSED_MOVES_MAX_SIZE))
+            SendMovementBundle();
+
+        return false;
     }
 
-    m_Socket->SendPacket(*packet);
+    // Bundled packets were sent first
+    if (_hasMovementBundle)
+        FlushMovementBundle(true);
+
+    return true;
+}
+
+void WorldSession::FlushMovementBundle(bool force)
+{
+    if (!_hasMovementBundle)
+        return;
+
+    std::lock_guard<std::mutex> guard(_movementBundleLock);
+    if (_movementBundle.IsEmpty())
+        return;
+
+    if (!force && GetMSTimeDiffToNow(_movementBundle.GetStartTime()) < sWorld->getIntConfig(CONFIG_NETWORK_COMPRESSED_MOVES_MAX_DELAY))
+        return;
+
+    SendMovementBundle();
+}
+
+void WorldSession::SendMovementBundle()
+{
+    WorldPacket packet = _movementBundle.Build(sWorld->getIntConfig(CONFIG_COMPRESSION));
+    _hasMovementBundle = false;
+
+    if (m_Socket)
+        m_Socket->SendPacket(packet);
 }
 
 /// Add an incoming packet to the queue
-void WorldSession::QueuePacket(WorldPacket* new_packet)
+void WorldSession::QueuePacket(ReceivedWorldPacket* new_packet)
 {
-    _recvQueue.add(new_packet);
+    _recvQueue.Add(new_packet);
 }
 
 /// Logging helper for unexpected opcodes
@@ -385,14 +475,6 @@ bool WorldSession::Update(uint32 diff, PacketFilter& updater)
     if (updater.ProcessUnsafe())
         UpdateTimeOutTime(diff);
 
-    ///- Retrieve packets from the receive queue and call the appropriate handlers
-    /// not process packets if socket already closed
-    WorldPacket* packet = nullptr;
-
-    //! Delete packet after processing by default
-    bool deletePacket = true;
-    std::vector<WorldPacket*> requeuePackets;
-    uint32 processedPackets = 0;
     time_t currentTime = GameTime::GetGameTime().count();
 
     if (GetPlayer() && GetPlayer()->IsInWorld() && IsAffectedByCAIS())
@@ -401,9 +483,84 @@ bool WorldSession::Update(uint32 diff, PacketFilter& updater)
         _lastUpdateTime = Seconds(currentTime);
     }
 
+    uint32 const processedPackets = ProcessReceivedPackets(updater, currentTime);
+
+    METRIC_VALUE("processed_packets", processedPackets);
+    METRIC_VALUE("addon_messages", _addonMessageReceiveCount.load());
+    _addonMessageReceiveCount = 0;
+
+    if (!updater.ProcessUnsafe()) // <=> updater is of type MapSessionFilter
+    {
+        // Send time sync packet every 10s.
+        if (_timeSyncTimer > 0)
+        {
+            if (diff >= _timeSyncTimer)
+            {
+                SendTimeSync();
+            }
+            else
+            {
+                _timeSyncTimer -= diff;
+            }
+        }
+    }
+
+    ProcessQueryCallbacks();
+
+    //check if we are safe to proceed with logout
+    //logout procedure should happen only in World::UpdateSessions() method!!!
+    if (updater.ProcessUnsafe())
+    {
+        if (m_Socket && m_Socket->IsOpen() && _warden)
+        {
+            _warden->Update(diff);
+        }
+
+        if (ShouldLogOut(currentTime) && !m_playerLoading)
+        {
+            LogoutPlayer(true);
+        }
+
+        if (m_Socket && !m_Socket->IsOpen())
+        {
+            if (GetPlayer() && _warden)
+                _warden->Update(diff);
+
+            m_Socket = nullptr;
+        }
+
+        if (!m_Socket)
+        {
+            return false;                                       //Will remove this session from the world session map
+        }
+    }
+
+    return true;
+}
+
+/// Handles the packets at the front of the receive queue that only touch this session.
+/// Called by WorldSessionMgr for several sessions in parallel, before their serial update.
+void WorldSession::ProcessSessionLocalPackets()
+{
+    SessionLocalFilter filter(this);
+    ProcessReceivedPackets(filter, GameTime::GetGameTime().count());
+}
+
+/// Handles the received packets accepted by the filter, in arrival order
+uint32 WorldSession::ProcessReceivedPackets(PacketFilter& updater, time_t currentTime)
+{
+    ///- Retrieve packets from the receive queue and call the appropriate handlers
+    /// not process packets if socket already closed
+    ReceivedWorldPacket* packet = nullptr;
+
+    //! Delete packet after processing by default
+    bool deletePacket = true;
+    std::vector<ReceivedWorldPacket*> requeuePackets;
+    uint32 processedPackets = 0;
+
     constexpr uint32 MAX_PROCESSED_PACKETS_IN_SAME_WORLDSESSION_UPDATE = 150;
 
-    while (m_Socket && _recvQueue.next(packet, updater))
+    while (m_Socket && (packet = _recvQueue.Next(updater)))
     {
         OpcodeClient opcode = static_cast<OpcodeClient>(packet->GetOpcode());
         ClientOpcodeHandler const* opHandle = opcodeTable[opcode];
@@ -559,59 +716,9 @@ bool WorldSession::Update(uint32 diff, PacketFilter& updater)
             break;
     }
 
-    _recvQueue.readd(requeuePackets.begin(), requeuePackets.end());
-
-    METRIC_VALUE("processed_packets", processedPackets);
-    METRIC_VALUE("addon_messages", _addonMessageReceiveCount.load());
-    _addonMessageReceiveCount = 0;
-
-    if (!updater.ProcessUnsafe()) // <=> updater is of type MapSessionFilter
-    {
-        // Send time sync packet every 10s.
-        if (_timeSyncTimer > 0)
-        {
-            if (diff >= _timeSyncTimer)
-            {
-                SendTimeSync();
-            }
-            else
-            {
-                _timeSyncTimer -= diff;
-            }
-        }
-    }
-
-    ProcessQueryCallbacks();
-
-    //check if we are safe to proceed with logout
-    //logout procedure should happen only in World::UpdateSessions() method!!!
-    if (updater.ProcessUnsafe())
-    {
-        if (m_Socket && m_Socket->IsOpen() && _warden)
-        {
-            _warden->Update(diff);
-        }
-
-        if (ShouldLogOut(currentTime) && !m_playerLoading)
-        {
-            LogoutPlayer(true);
-        }
+    _recvQueue.Requeue(requeuePackets);
 
-        if (m_Socket && !m_Socket->IsOpen())
-        {
-            if (GetPlayer() && _warden)
-                _warden->Update(diff);
-
-            m_Socket = nullptr;
-        }
-
-        if (!m_Socket)
-        {
-            return false;                                       //Will remove this session from the world session map
-        }
-    }
-
-    return true;
+    return processedPackets;
 }
 
 bool WorldSession::HandleSocketClosed()
@@ -830,6 +937,7 @@ void WorldSession::LogoutPlayer(bool save)
         // the player may not be in the world when logging out
         // e.g if he got disconnected during a transfer to another map
         // calls to GetMap in this case may cause crashes
+        sWhoListCacheMgr->MarkDirty(_player->GetGUID());
         _player->CleanupsBeforeDelete();
         if (Map* _map = _player->FindMap())
         {
@@ -1420,6 +1528,21 @@ Warden* WorldSession::GetWarden()
     return &(*_warden);
 }
 
+bool WorldSession::DosProtection::IsKickOrBanDue(WorldPacket const& p, time_t const time) const
+{
+    AntiDosOpcodePolicy const* policy = sWorldGlobals->GetAntiDosPolicyForOpcode(p.GetOpcode());
+    if (!policy || !policy->MaxAllowedCount)
+        return false;
+
+    Policy const action = Policy(policy->Policy);
+    if (action != Policy::Kick && action != Policy::Ban)
+        return false;
+
+    PacketThrottlingMap::const_iterator itr = _PacketThrottlingMap.find(p.GetOpcode());
+    uint32 const count = itr != _PacketThrottlingMap.end() && itr->second.lastReceiveTime == time ? itr->second.amountCounter : 0;
+    return count + 1 > policy->MaxAllowedCount;
+}
+
 WorldSession::DosProtection::Policy WorldSession::DosProtection::EvaluateOpcode(WorldPacket const& p, time_t const time) const
 {
     AntiDosOpcodePolicy const* policy = sWorldGlobals->GetAntiDosPolicyForOpcode(p.GetOpcode());
@@ -33,8 +33,11 @@
 #include "Packet.h"
 #include "SharedDefines.h"
 #include "World.h"
+#include "WorldSessionMovementBundle.h"
+#include "WorldSessionReceiveQueue.h"
 #include <map>
 #include <memory>
+#include <mutex>
 #include <utility>
 
 class Creature;
@@ -330,6 +333,17 @@ public:
     [[nodiscard]] bool ProcessUnsafe() const override { return false; }
 };
 
+//process only packets whose handlers write nothing but their own session, in parallel before WorldSessionMgr::UpdateSessions()
+class SessionLocalFilter : public PacketFilter
+{
+public:
+    explicit SessionLocalFilter(WorldSession* pSession) : PacketFilter(pSession) {}
+    ~SessionLocalFilter() override = default;
+
+    bool Process(WorldPacket* packet) override;
+    [[nodiscard]] bool ProcessUnsafe() const override { return false; }
+};
+
 //class used to filer only thread-unsafe packets from queue
 //in order to update only be used in World::UpdateSessions()
 class WorldSessionFilter : public PacketFilter
@@ -440,6 +454,10 @@ public:
     bool ProcessMovementInfo(MovementInfo& movementInfo, Unit* mover, Player* plrMover, WorldPacket& recvData);
 
     void SendPacket(WorldPacket const* packet);
+    // Queues a packet built once for many sessions without copying it
+    void SendSharedPacket(std::shared_ptr<WorldPacket const> const& packet);
+    // Sends the bundled movement packets when forced or when the oldest one waited Network.CompressedMoves.MaxDelay
+    void FlushMovementBundle(bool force);
     void SendPetNameInvalid(uint32 error, std::string const& name, DeclinedName* declinedName);
     void SendPartyResult(PartyOperation operation, std::string const& member, PartyResult res, uint32 val = 0);
 
@@ -485,7 +503,7 @@ public:
     void SetCurrentVendor(uint32 vendorEntry) { m_currentVendorEntry = vendorEntry; }
 
     ObjectGuid::LowType GetGuidLow() const;
-    void SetSecurity(AccountTypes security) { _security = security; }
+    void SetSecurity(AccountTypes security);
     std::string const& GetRemoteAddress() { return m_Address; }
     void SetPlayer(Player* player);
     uint8 Expansion() const { return m_expansion; }
@@ -535,8 +553,9 @@ public:
     // May kick player on false depending on world config (handler should abort)
     bool DisallowHyperlinksAndMaybeKick(std::string_view str);
 
-    void QueuePacket(WorldPacket* new_packet);
+    void QueuePacket(ReceivedWorldPacket* new_packet);
     bool Update(uint32 diff, PacketFilter& updater);
+    void ProcessSessionLocalPackets();
 
     /// Handle the authentication waiting queue (to be completed)
     void SendAuthWaitQueue(uint32 position);
@@ -549,6 +568,8 @@ public:
     void SendShowBank(ObjectGuid guid);
     bool CanOpenMailBox(ObjectGuid guid);
     void SendShowMailBox(ObjectGuid guid);
+    // Queries the mailed items of the player if they are not loaded yet, the callback runs once they are
+    void LoadMailedItems(std::function<void()>&& callback);
     void SendTabardVendorActivate(ObjectGuid guid);
     void SendSpiritResurrect();
     void SendBindPoint(Creature* npc);
@@ -896,11 +917,14 @@ public:                                                 // opcodes handlers
     void HandleBuyBankSlotOpcode(WorldPackets::Bank::BuyBankSlot& buyBankSlot);
 
     void HandleGetMailList(WorldPacket& recvData);
+    void HandleGetMailListCallback(ObjectGuid mailbox);
     void HandleSendMail(WorldPacket& recvData);
     void HandleMailTakeMoney(WorldPacket& recvData);
     void HandleMailTakeItem(WorldPacket& recvData);
+    void HandleMailTakeItemCallback(ObjectGuid mailbox, uint32 mailId, uint32 itemLowGuid);
     void HandleMailMarkAsRead(WorldPacket& recvData);
     void HandleMailReturnToSender(WorldPacket& recvData);
+    void HandleMailReturnToSenderCallback(ObjectGuid mailbox, uint32 mailId);
     void HandleMailDelete(WorldPacket& recvData);
     void HandleItemTextQuery(WorldPacket& recvData);
     void HandleMailCreateTextItem(WorldPacket& recvData);
@@ -1210,6 +1234,7 @@ private:
     AsyncCallbackProcessor<SQLQueryHolderCallback> _queryHolderProcessor;
 
     friend class World;
+    friend class SessionLocalFilter;
 protected:
     class DosProtection
     {
@@ -1227,6 +1252,8 @@ protected:
 
         DosProtection(WorldSession* s);
         Policy EvaluateOpcode(WorldPacket const& p, time_t const time) const;
+        // True when EvaluateOpcode would kick or ban for this packet, without counting it
+        [[nodiscard]] bool IsKickOrBanDue(WorldPacket const& p, time_t const time) const;
     protected:
         WorldSession* Session;
     private:
@@ -1246,10 +1273,18 @@ private:
 
     bool recoveryItem(Item* pItem);
 
+    uint32 ProcessReceivedPackets(PacketFilter& updater, time_t currentTime);
+
     // logging helper
     void LogUnexpectedOpcode(WorldPacket* packet, char const* status, char const* reason);
     void LogUnprocessedTail(WorldPacket* packet);
 
+    // Steps shared by SendPacket and SendSharedPacket: statistics, scripts and the movement bundle.
+    // Returns true when the packet must go to the socket now, false when it was dropped or bundled
+    bool PrepareSendPacket(WorldPacket const& packet);
+    // _movementBundleLock must be held
+    void SendMovementBundle();
+
     // EnumData helpers
     bool IsLegitCharacterForAccount(ObjectGuid guid)
     {
@@ -1297,7 +1332,11 @@ private:
     AddonsList m_addonsList;
     uint32 recruiterId;
     bool isRecruiter;
-    LockedQueue<WorldPacket*> _recvQueue;
+    WorldSessionReceiveQueue _recvQueue;
+    // Spline movement packets waiting to be sent as one SMSG_COMPRESSED_MOVES, see SendPacket
+    WorldSessionMovementBundle _movementBundle;
+    std::mutex _movementBundleLock;
+    std::atomic<bool> _hasMovementBundle{false};
     uint32 m_currentVendorEntry;
     ObjectGuid m_currentBankerGUID;
     uint32 _offlineTime;
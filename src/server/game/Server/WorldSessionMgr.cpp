@@ -19,6 +19,7 @@
 #include "ChatPackets.h"
 #include "RBAC.h"
 #include "GameTime.h"
+#include "MapMgr.h"
 #include "Metric.h"
 #include "Player.h"
 #include "World.h"
@@ -121,6 +122,15 @@ void WorldSessionMgr::UpdateSessions(uint32 const diff)
         }
     }
 
+    if (sWorld->getBoolConfig(CONFIG_PARALLEL_SESSION_UPDATE) && _sessions.size() >= sWorld->getIntConfig(CONFIG_PARALLEL_SESSION_UPDATE_MIN_SESSIONS))
+    {
+        METRIC_DETAILED_NO_THRESHOLD_TIMER("world_update_time",
+            METRIC_TAG("type", "Process session local packets"),
+            METRIC_TAG("parent_type", "Update sessions"));
+
+        ProcessSessionLocalPackets();
+    }
+
     ///- Then send an update signal to remaining ones
     for (SessionMap::iterator itr = _sessions.begin(), next; itr != _sessions.end(); itr = next)
     {
@@ -182,6 +192,9 @@ void WorldSessionMgr::UpdateSessions(uint32 const diff)
         }
     }
 
+    ///- Send the queue positions that changed during this update at once
+    _queuedPlayer.UpdatePositions([](WorldSession* session, uint32 position) { session->SendAuthWaitQueue(position); });
+
     // pussywizard:
     if (_offlineSessions.empty())
         return;
@@ -199,6 +212,37 @@ void WorldSessionMgr::UpdateSessions(uint32 const diff)
     }
 }
 
+/// Handles the packets that only touch their own session in shards on the map update threads, which are idle
+/// while the sessions are updated. Everything else, logouts and removals included, stays in the serial loop.
+void WorldSessionMgr::ProcessSessionLocalPackets()
+{
+    MapUpdater* updater = sMapMgr->GetMapUpdater();
+    if (!updater->activated())
+        return;
+
+    // Sessions of an account always land in the same shard
+    _sessionShards.resize(updater->thread_count());
+    for (std::vector<WorldSession*>& shard : _sessionShards)
+        shard.clear();
+
+    for (auto const& [accountId, session] : _sessions)
+        _sessionShards[accountId % _sessionShards.size()].push_back(session);
+
+    for (std::vector<WorldSession*> const& shard : _sessionShards)
+    {
+        if (shard.empty())
+            continue;
+
+        updater->schedule_job([&shard]()
+        {
+            for (WorldSession* session : shard)
+                session->ProcessSessionLocalPackets();
+        });
+    }
+
+    updater->wait();
+}
+
 /// Remove a given session
 bool WorldSessionMgr::KickSession(uint32 id)
 {
@@ -219,7 +263,7 @@ bool WorldSessionMgr::KickSession(uint32 id)
 /// Kick (and save) all players
 void WorldSessionMgr::KickAll()
 {
-    _queuedPlayer.clear();                                 // prevent send queue update packet and login queued sessions
+    _queuedPlayer.Clear();                                 // prevent send queue update packet and login queued sessions
 
     // session not removed at kick and will removed in next update tick
     for (SessionMap::const_iterator itr = _sessions.begin(); itr != _sessions.end(); ++itr)
@@ -247,69 +291,44 @@ void WorldSessionMgr::AddSession(WorldSession* session)
 void WorldSessionMgr::AddQueuedPlayer(WorldSession* session)
 {
     session->SetInQueue(true);
-    _queuedPlayer.push_back(session);
+    uint32 const position = _queuedPlayer.Push(session);
 
     // The 1st SMSG_AUTH_RESPONSE needs to contain other info too.
-    session->SendAuthResponse(AUTH_WAIT_QUEUE, false, GetQueuePos(session));
+    session->SendAuthResponse(AUTH_WAIT_QUEUE, false, position);
 }
 
 bool WorldSessionMgr::RemoveQueuedPlayer(WorldSession* session)
 {
     uint32 sessions = GetActiveSessionCount();
 
-    uint32 position = 1;
-    Queue::iterator iter = _queuedPlayer.begin();
-
-    // search to remove and count skipped positions
-    bool found = false;
-
-    for (; iter != _queuedPlayer.end(); ++iter, ++position)
+    bool const found = _queuedPlayer.Remove(session);
+    if (found)
     {
-        if (*iter == session)
-        {
-            session->SetInQueue(false);
-            session->ResetTimeOutTime(false);
-            iter = _queuedPlayer.erase(iter);
-            found = true;
-            break;
-        }
+        session->SetInQueue(false);
+        session->ResetTimeOutTime(false);
     }
-
     // if session not queued then it was an active session
-    if (!found)
+    else
     {
         ASSERT(sessions > 0);
         --sessions;
     }
 
     // accept first in queue
-    if ((!GetPlayerAmountLimit() || sessions < GetPlayerAmountLimit()) && !_queuedPlayer.empty())
+    if ((!GetPlayerAmountLimit() || sessions < GetPlayerAmountLimit()) && !_queuedPlayer.Empty())
     {
-        WorldSession* pop_sess = _queuedPlayer.front();
+        WorldSession* pop_sess = _queuedPlayer.Front();
         pop_sess->InitializeSession();
-        _queuedPlayer.pop_front();
-
-        // update iter to point first queued socket or end() if queue is empty now
-        iter = _queuedPlayer.begin();
-        position = 1;
+        _queuedPlayer.PopFront();
     }
 
-    // update queue position from iter to end()
-    for (; iter != _queuedPlayer.end(); ++iter, ++position)
-        (*iter)->SendAuthWaitQueue(position);
-
+    // the new positions of the sessions behind are sent once per UpdateSessions()
     return found;
 }
 
 int32 WorldSessionMgr::GetQueuePos(WorldSession* session)
 {
-    uint32 position = 1;
-
-    for (Queue::const_iterator iter = _queuedPlayer.begin(); iter != _queuedPlayer.end(); ++iter, ++position)
-        if ((*iter) == session)
-            return position;
-
-    return 0;
+    return _queuedPlayer.GetPosition(session);
 }
 
 void WorldSessionMgr::AddSession_(WorldSession* session)
@@ -418,8 +437,8 @@ bool WorldSessionMgr::HasRecentlyDisconnected(WorldSession* session)
 
 void WorldSessionMgr::UpdateMaxSessionCounters()
 {
-    _maxActiveSessionCount = std::max(_maxActiveSessionCount, uint32(_sessions.size() - _queuedPlayer.size()));
-    _maxQueuedSessionCount = std::max(_maxQueuedSessionCount, uint32(_queuedPlayer.size()));
+    _maxActiveSessionCount = std::max(_maxActiveSessionCount, uint32(_sessions.size() - _queuedPlayer.Size()));
+    _maxQueuedSessionCount = std::max(_maxQueuedSessionCount, _queuedPlayer.Size());
 }
 
 /// Send a packet to all players (except self if mentioned)
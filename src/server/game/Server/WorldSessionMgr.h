@@ -22,6 +22,7 @@
 #include "Duration.h"
 #include "IWorld.h"
 #include "LockedQueue.h"
+#include "LoginQueue.h"
 #include "ObjectGuid.h"
 #include <list>
 #include <map>
@@ -67,8 +68,8 @@ public:
     /// Get the number of current active sessions
     void UpdateMaxSessionCounters();
     uint32 GetActiveAndQueuedSessionCount() const { return _sessions.size(); }
-    uint32 GetActiveSessionCount() const { return _sessions.size() - _queuedPlayer.size(); }
-    uint32 GetQueuedSessionCount() const { return _queuedPlayer.size(); }
+    uint32 GetActiveSessionCount() const { return _sessions.size() - _queuedPlayer.Size(); }
+    uint32 GetQueuedSessionCount() const { return _queuedPlayer.Size(); }
     /// Get the maximum number of parallel sessions on the server since last reboot
     uint32 GetMaxQueuedSessionCount() const { return _maxQueuedSessionCount; }
     uint32 GetMaxActiveSessionCount() const { return _maxActiveSessionCount; }
@@ -97,6 +98,9 @@ private:
     LockedQueue<WorldSession*> _addSessQueue;
     void AddSession_(WorldSession* session);
 
+    void ProcessSessionLocalPackets();
+    std::vector<std::vector<WorldSession*>> _sessionShards;
+
     SessionMap _sessions;
     SessionMap _offlineSessions;
     std::map<uint32 /*accountId*/, AccountPlayHistory> _accountsPlayHistory;
@@ -104,8 +108,7 @@ private:
     typedef std::unordered_map<uint32, time_t> DisconnectMap;
     DisconnectMap _disconnects;
 
-    typedef std::list<WorldSession*> Queue;
-    Queue _queuedPlayer;
+    LoginQueue<WorldSession> _queuedPlayer;
 
     uint32 _playerLimit;
     uint32 _maxActiveSessionCount;
@@ -0,0 +1,82 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "WorldSessionMovementBundle.h"
+#include "Errors.h"
+#include "Opcodes.h"
+#include "Timer.h"
+#include "zlib.h"
+#include <limits>
+
+namespace
+{
+    // uint8 size of a bundled packet, it counts the opcode as well
+    constexpr std::size_t MAX_BUNDLED_PAYLOAD = std::numeric_limits<uint8>::max() - sizeof(uint16);
+}
+
+bool WorldSessionMovementBundle::CanBundle(WorldPacket const& packet)
+{
+    switch (packet.GetOpcode())
+    {
+        case SMSG_MONSTER_MOVE:
+        case SMSG_MONSTER_MOVE_TRANSPORT:
+            return packet.size() <= MAX_BUNDLED_PAYLOAD;
+        default:
+            return false;
+    }
+}
+
+void WorldSessionMovementBundle::Add(WorldPacket const& packet)
+{
+    if (!_count)
+        _startTime = getMSTime();
+
+    _buffer << uint8(packet.size() + sizeof(uint16));
+    _buffer << uint16(packet.GetOpcode());
+    if (!packet.empty())
+        _buffer.append(packet.contents(), packet.size());
+
+    ++_count;
+}
+
+WorldPacket WorldSessionMovementBundle::Build(uint32 compressionLevel)
+{
+    WorldPacket packet;
+
+    // Nothing to gain from compressing a single packet
+    if (_count == 1)
+    {
+        packet.Initialize(_buffer.read<uint16>(sizeof(uint8)), _buffer.size());
+        packet.append(_buffer.contents() + sizeof(uint8) + sizeof(uint16), _buffer.size() - sizeof(uint8) - sizeof(uint16));
+    }
+    else
+    {
+        uLongf compressedSize = compressBound(_buffer.size());
+        packet.Initialize(SMSG_COMPRESSED_MOVES, sizeof(uint32) + compressedSize);
+        packet << uint32(_buffer.size());
+        packet.resize(sizeof(uint32) + compressedSize);
+
+        int result = compress2(const_cast<uint8*>(packet.contents()) + sizeof(uint32), &compressedSize, _buffer.contents(), _buffer.size(), compressionLevel);
+        ASSERT(result == Z_OK, "Can't compress movement bundle (zlib: compress2) Error code: {} ({})", result, zError(result));
+
+        packet.resize(sizeof(uint32) + compressedSize);
+    }
+
+    _buffer.clear();
+    _count = 0;
+    return packet;
+}
@@ -0,0 +1,55 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _WORLDSESSIONMOVEMENTBUNDLE_H
+#define _WORLDSESSIONMOVEMENTBUNDLE_H
+
+#include "WorldPacket.h"
+
+/*
+ * Spline movement packets of a session collected into one SMSG_COMPRESSED_MOVES.
+ *
+ * The bundle holds the packets as the client expects them once inflated:
+ * uint8 size (opcode and payload), uint16 opcode, payload.
+ * Packets are only ever bundled while nothing else was sent to the session in between,
+ * so the client still receives every packet in the order it was sent.
+ */
+class WorldSessionMovementBundle
+{
+public:
+    // Opcode that can be bundled and payload short enough for the uint8 size
+    [[nodiscard]] static bool CanBundle(WorldPacket const& packet);
+
+    void Add(WorldPacket const& packet);
+
+    [[nodiscard]] bool IsEmpty() const { return !_count; }
+    [[nodiscard]] uint32 GetCount() const { return _count; }
+    // Uncompressed size of the bundle
+    [[nodiscard]] std::size_t GetSize() const { return _buffer.size(); }
+    // Time the oldest packet of the bundle was added
+    [[nodiscard]] uint32 GetStartTime() const { return _startTime; }
+
+    // Compressed bundle, or the packet itself when only one was added. Empties the bundle.
+    WorldPacket Build(uint32 compressionLevel);
+
+private:
+    ByteBuffer _buffer;
+    uint32 _count = 0;
+    uint32 _startTime = 0;
+};
+
+#endif
@@ -0,0 +1,109 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "WorldSessionReceiveQueue.h"
+#include "Opcodes.h"
+#include "WorldSession.h"
+#include <algorithm>
+#include <iterator>
+
+ReceivedWorldPacket* WorldSessionReceiveQueue::Lane::Front()
+{
+    ReceivedWorldPacket* packet;
+    while (Incoming.Dequeue(packet))
+    {
+        // producers may enqueue out of sequence order, keep the batch sorted
+        auto itr = Batch.end();
+        while (itr != Batch.begin() && (*std::prev(itr))->Sequence > packet->Sequence)
+            --itr;
+
+        Batch.insert(itr, packet);
+    }
+
+    return Batch.empty() ? nullptr : Batch.front();
+}
+
+WorldSessionReceiveQueue::~WorldSessionReceiveQueue()
+{
+    Clear();
+}
+
+bool WorldSessionReceiveQueue::IsThreadUnsafe(WorldPacket const* packet)
+{
+    return opcodeTable[static_cast<OpcodeClient>(packet->GetOpcode())]->ProcessingPlace == PROCESS_THREADUNSAFE;
+}
+
+void WorldSessionReceiveQueue::Add(ReceivedWorldPacket* packet)
+{
+    packet->Sequence = _nextSequence.fetch_add(1, std::memory_order_relaxed);
+
+    if (IsThreadUnsafe(packet))
+        _threadUnsafe.Incoming.Enqueue(packet);
+    else
+        _threadSafe.Incoming.Enqueue(packet);
+}
+
+ReceivedWorldPacket* WorldSessionReceiveQueue::Next(PacketFilter& filter)
+{
+    ReceivedWorldPacket* safePacket = _threadSafe.Front();
+    ReceivedWorldPacket* unsafePacket = _threadUnsafe.Front();
+
+    Lane* lane;
+    if (safePacket && (!unsafePacket || safePacket->Sequence < unsafePacket->Sequence))
+        lane = &_threadSafe;
+    else if (unsafePacket)
+        lane = &_threadUnsafe;
+    else
+        return nullptr;
+
+    // an older packet is still on its way into the other lane
+    ReceivedWorldPacket* packet = lane->Batch.front();
+    if (packet->Sequence > _nextExpectedSequence)
+        return nullptr;
+
+    if (!filter.Process(packet))
+        return nullptr;
+
+    lane->Batch.pop_front();
+    // requeued packets are older than the expected one
+    _nextExpectedSequence = std::max(_nextExpectedSequence, packet->Sequence + 1);
+    return packet;
+}
+
+void WorldSessionReceiveQueue::Requeue(std::vector<ReceivedWorldPacket*> const& packets)
+{
+    for (auto itr = packets.rbegin(); itr != packets.rend(); ++itr)
+    {
+        if (IsThreadUnsafe(*itr))
+            _threadUnsafe.Batch.push_front(*itr);
+        else
+            _threadSafe.Batch.push_front(*itr);
+    }
+}
+
+void WorldSessionReceiveQueue::Clear()
+{
+    for (Lane* lane : { &_threadSafe, &_threadUnsafe })
+    {
+        while (ReceivedWorldPacket* packet = lane->Front())
+        {
+            lane->Batch.pop_front();
+            _nextExpectedSequence = std::max(_nextExpectedSequence, packet->Sequence + 1);
+            delete packet;
+        }
+    }
+}
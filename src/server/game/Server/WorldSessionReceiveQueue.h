@@ -0,0 +1,100 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _WORLDSESSIONRECEIVEQUEUE_H
+#define _WORLDSESSIONRECEIVEQUEUE_H
+
+#include "MPSCQueue.h"
+#include "WorldPacket.h"
+#include <atomic>
+#include <deque>
+#include <vector>
+
+class PacketFilter;
+
+// Client packet waiting in the receive queue of its session
+class ReceivedWorldPacket : public WorldPacket
+{
+public:
+    explicit ReceivedWorldPacket(WorldPacket&& packet) : WorldPacket(std::move(packet))
+    {
+        QueueLink.store(nullptr, std::memory_order_relaxed);
+    }
+
+    ReceivedWorldPacket(WorldPacket&& packet, TimePoint receivedTime) : WorldPacket(std::move(packet), receivedTime)
+    {
+        QueueLink.store(nullptr, std::memory_order_relaxed);
+    }
+
+    // Order of arrival, shared by both lanes of the queue
+    uint64 Sequence = 0;
+    std::atomic<ReceivedWorldPacket*> QueueLink;
+};
+
+/*
+ * Lock-free receive queue of a WorldSession.
+ *
+ * The network thread sorts packets into two lanes when they arrive: the handlers that may run in Map::Update
+ * (PROCESS_INPLACE, PROCESS_THREADSAFE) and the ones that only run in WorldSessionMgr::UpdateSessions
+ * (PROCESS_THREADUNSAFE). The consumer moves everything that arrived to a private batch per lane, then hands
+ * out packets in arrival order across both lanes: as before, processing stops at the first packet the filter
+ * refuses, so no packet is ever handled before an older one.
+ *
+ * Any number of producers, the packets of each one are handed out in the order it added them. A packet whose
+ * sequence was taken but which is not in its lane yet holds back the newer ones until it arrives.
+ *
+ * Exactly one consumer at a time, Next, Requeue and Clear are not thread safe. The world thread, the map threads
+ * (Map::Update) and the session local pass (WorldSessionMgr::ProcessSessionLocalPackets) take turns and a
+ * session is only ever drained by one of them at a time.
+ */
+class WorldSessionReceiveQueue
+{
+public:
+    WorldSessionReceiveQueue() = default;
+    ~WorldSessionReceiveQueue();
+
+    WorldSessionReceiveQueue(WorldSessionReceiveQueue const&) = delete;
+    WorldSessionReceiveQueue& operator=(WorldSessionReceiveQueue const&) = delete;
+
+    // Network thread, any number of producers
+    void Add(ReceivedWorldPacket* packet);
+
+    // Oldest packet if the filter accepts it, nullptr otherwise
+    ReceivedWorldPacket* Next(PacketFilter& filter);
+    // Puts packets taken by Next back in front of their lane, they must be in the order Next returned them
+    void Requeue(std::vector<ReceivedWorldPacket*> const& packets);
+    void Clear();
+
+private:
+    struct Lane
+    {
+        ReceivedWorldPacket* Front();
+
+        MPSCQueue<ReceivedWorldPacket, &ReceivedWorldPacket::QueueLink> Incoming;
+        std::deque<ReceivedWorldPacket*> Batch;
+    };
+
+    [[nodiscard]] static bool IsThreadUnsafe(WorldPacket const* packet);
+
+    Lane _threadSafe;
+    Lane _threadUnsafe;
+    std::atomic<uint64> _nextSequence{0};
+    // Sequence of the oldest packet never handed out, consumer only
+    uint64 _nextExpectedSequence = 0;
+};
+
+#endif
@@ -17,6 +17,7 @@
 
 #include "WorldSocket.h"
 #include "AccountMgr.h"
+#include "ByteBufferPool.h"
 #include "Config.h"
 #include "CryptoHash.h"
 #include "CryptoRandom.h"
@@ -173,11 +174,12 @@ bool WorldSocket::Update()
         do
         {
             queued->CompressIfNeeded();
-            ServerPktHeader header(queued->size() + 2, queued->GetOpcode());
+            WorldPacket const& payload = queued->GetPayload();
+            ServerPktHeader header(payload.size() + 2, queued->GetOpcode());
             if (queued->NeedsEncryption())
                 _authCrypt.EncryptSend(header.header, header.getHeaderLength());
 
-            currentPacketSize = queued->size() + header.getHeaderLength();
+            currentPacketSize = payload.size() + header.getHeaderLength();
 
             if (buffer.GetRemainingSpace() < currentPacketSize)
             {
@@ -188,8 +190,8 @@ bool WorldSocket::Update()
             if (buffer.GetRemainingSpace() >= currentPacketSize)
             {
                 buffer.Write(header.header, header.getHeaderLength());
-                if (!queued->empty())
-                    buffer.Write(queued->contents(), queued->size());
+                if (!payload.empty())
+                    buffer.Write(payload.contents(), payload.size());
             }
             else    // Single packet larger than current buffer size
             {
@@ -201,8 +203,8 @@ bool WorldSocket::Update()
                     _sendBufferSize = currentPacketSize;
 
                 buffer.Write(header.header, header.getHeaderLength());
-                if (!queued->empty())
-                    buffer.Write(queued->contents(), queued->size());
+                if (!payload.empty())
+                    buffer.Write(payload.contents(), payload.size());
             }
 
             delete queued;
@@ -325,6 +327,11 @@ bool WorldSocket::ReadHeaderHandler()
     }
 
     header->size -= sizeof(header->cmd);
+
+    // The storage of the previous packet left with it, take a recycled one
+    if (header->size && !_packetBuffer.GetBufferSize())
+        _packetBuffer = MessageBuffer(ByteBufferPool::Acquire(header->size));
+
     _packetBuffer.Resize(header->size);
 
     return true;
@@ -405,7 +412,7 @@ WorldSocket::ReadDataHandlerResult WorldSocket::ReadDataHandler()
     OpcodeClient opcode = static_cast<OpcodeClient>(header->cmd);
 
     WorldPacket packet(opcode, std::move(_packetBuffer));
-    WorldPacket* packetToQueue;
+    ReceivedWorldPacket* packetToQueue;
 
     if (sPacketLog->CanLogPacket() && IsLoggingPackets())
         sPacketLog->LogPacket(packet, CLIENT_TO_SERVER, GetRemoteIpAddress(), GetRemotePort());
@@ -459,10 +466,10 @@ WorldSocket::ReadDataHandlerResult WorldSocket::ReadDataHandler()
             LOG_ERROR("network", "WorldSocket::ReadDataHandler: client {} sent CMSG_KEEP_ALIVE without being authenticated", GetRemoteIpAddress().to_string());
             return ReadDataHandlerResult::Error;
         case CMSG_TIME_SYNC_RESP:
-            packetToQueue = new WorldPacket(std::move(packet), GameTime::Now());
+            packetToQueue = new ReceivedWorldPacket(std::move(packet), GameTime::Now());
             break;
         default:
-            packetToQueue = new WorldPacket(std::move(packet));
+            packetToQueue = new ReceivedWorldPacket(std::move(packet));
             break;
     }
 
@@ -527,6 +534,17 @@ void WorldSocket::SendPacket(WorldPacket const& packet)
     _bufferQueue.Enqueue(new EncryptableAndCompressiblePacket(packet, _authCrypt.IsInitialized()));
 }
 
+void WorldSocket::SendPacket(std::shared_ptr<WorldPacket const> const& packet)
+{
+    if (!IsOpen())
+        return;
+
+    if (sPacketLog->CanLogPacket() && IsLoggingPackets())
+        sPacketLog->LogPacket(*packet, SERVER_TO_CLIENT, GetRemoteIpAddress(), GetRemotePort());
+
+    _bufferQueue.Enqueue(new EncryptableAndCompressiblePacket(packet, _authCrypt.IsInitialized()));
+}
+
 void WorldSocket::HandleAuthSession(WorldPacket & recvPacket)
 {
     std::shared_ptr<ClientAuthSession> authSession = std::make_shared<ClientAuthSession>();
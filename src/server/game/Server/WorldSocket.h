@@ -37,15 +37,25 @@ public:
         SocketQueueLink.store(nullptr, std::memory_order_relaxed);
     }
 
+    // Payload shared with the other sockets it is sent to, only the header is written per socket
+    EncryptableAndCompressiblePacket(std::shared_ptr<WorldPacket const> packet, bool encrypt) : WorldPacket(), _shared(std::move(packet)), _encrypt(encrypt)
+    {
+        SetOpcode(_shared->GetOpcode());
+        SocketQueueLink.store(nullptr, std::memory_order_relaxed);
+    }
+
+    WorldPacket const& GetPayload() const { return _shared ? *_shared : *this; }
+
     bool NeedsEncryption() const { return _encrypt; }
 
-    bool NeedsCompression() const { return GetOpcode() == SMSG_UPDATE_OBJECT && size() > 100; }
+    bool NeedsCompression() const { return !_shared && GetOpcode() == SMSG_UPDATE_OBJECT && size() > 100; }
 
     void CompressIfNeeded();
 
     std::atomic<EncryptableAndCompressiblePacket*> SocketQueueLink;
 
 private:
+    std::shared_ptr<WorldPacket const> _shared;
     bool _encrypt;
 };
 
@@ -82,6 +92,7 @@ public:
     bool Update() final;
 
     void SendPacket(WorldPacket const& packet);
+    void SendPacket(std::shared_ptr<WorldPacket const> const& packet);
 
     void SetSendBufferSize(std::size_t sendBufferSize) { _sendBufferSize = sendBufferSize; }
 
@@ -0,0 +1,146 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "LoadTaskGraph.h"
+#include "Errors.h"
+#include "Log.h"
+#include "Timer.h"
+#include <algorithm>
+#include <condition_variable>
+#include <mutex>
+#include <set>
+#include <thread>
+
+LoadTaskGraph::TaskId LoadTaskGraph::AddTask(std::string name, std::function<void()> task, std::vector<TaskId> const& dependencies)
+{
+    TaskId const id = _tasks.size();
+
+    Task& newTask = _tasks.emplace_back();
+    newTask.Name = std::move(name);
+    newTask.Function = std::move(task);
+
+    for (TaskId dependency : dependencies)
+    {
+        ASSERT(dependency < id, "Load task '{}' depends on a task that is not registered yet", newTask.Name);
+        _tasks[dependency].Dependents.push_back(id);
+        ++newTask.DependencyCount;
+    }
+
+    return id;
+}
+
+void LoadTaskGraph::Execute(Task& task)
+{
+    uint32 const oldMSTime = getMSTime();
+    task.Function();
+    task.Duration = GetMSTimeDiffToNow(oldMSTime);
+}
+
+void LoadTaskGraph::Run(uint32 threads)
+{
+    if (_tasks.empty())
+        return;
+
+    threads = std::clamp<uint32>(threads, 1, _tasks.size());
+
+    uint32 const oldMSTime = getMSTime();
+
+    // Registration order is always a valid topological order
+    if (threads == 1)
+    {
+        for (Task& task : _tasks)
+            Execute(task);
+
+        LogSummary(GetMSTimeDiffToNow(oldMSTime), threads);
+        return;
+    }
+
+    std::vector<uint32> pendingDependencies;
+    pendingDependencies.reserve(_tasks.size());
+
+    // Lowest id first, so the scheduling follows the registration order as closely as the dependencies allow
+    std::set<TaskId> ready;
+    for (TaskId id = 0; id < _tasks.size(); ++id)
+    {
+        pendingDependencies.push_back(_tasks[id].DependencyCount);
+        if (!_tasks[id].DependencyCount)
+            ready.insert(id);
+    }
+
+    std::mutex lock;
+    std::condition_variable condition;
+    std::size_t remaining = _tasks.size();
+
+    auto worker = [&]()
+    {
+        std::unique_lock<std::mutex> guard(lock);
+        while (true)
+        {
+            condition.wait(guard, [&] { return !ready.empty() || !remaining; });
+            if (!remaining)
+                return;
+
+            TaskId const id = *ready.begin();
+            ready.erase(ready.begin());
+
+            guard.unlock();
+            Execute(_tasks[id]);
+            guard.lock();
+
+            for (TaskId dependent : _tasks[id].Dependents)
+                if (!--pendingDependencies[dependent])
+                    ready.insert(dependent);
+
+            --remaining;
+            condition.notify_all();
+        }
+    };
+
+    std::vector<std::thread> workers;
+    workers.reserve(threads - 1);
+    for (uint32 i = 1; i < threads; ++i)
+        workers.emplace_back(worker);
+
+    // The calling thread takes part in the work as well
+    worker();
+
+    for (std::thread& thread : workers)
+        thread.join();
+
+    LogSummary(GetMSTimeDiffToNow(oldMSTime), threads);
+}
+
+void LoadTaskGraph::LogSummary(uint32 wallTime, uint32 threads) const
+{
+    std::vector<Task const*> sorted;
+    sorted.reserve(_tasks.size());
+
+    uint32 serialTime = 0;
+    for (Task const& task : _tasks)
+    {
+        sorted.push_back(&task);
+        serialTime += task.Duration;
+    }
+
+    std::sort(sorted.begin(), sorted.end(), [](Task const* left, Task const* right) { return left->Duration > right->Duration; });
+
+    LOG_INFO("server.loading", " ");
+    LOG_INFO("server.loading", ">> {}: {} tasks finished in {} ms on {} thread(s) (sum of task times {} ms)", _name, _tasks.size(), wallTime, threads, serialTime);
+    for (Task const* task : sorted)
+        LOG_INFO("server.loading", ">>   {:<40} {:>6} ms", task->Name, task->Duration);
+    LOG_INFO("server.loading", " ");
+}
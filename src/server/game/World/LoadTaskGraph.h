@@ -0,0 +1,69 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _LOAD_TASK_GRAPH_H
+#define _LOAD_TASK_GRAPH_H
+
+#include "Define.h"
+#include <functional>
+#include <string>
+#include <vector>
+
+/**
+ * Startup loaders registered with their explicit dependencies.
+ *
+ * Tasks whose dependencies are satisfied are executed concurrently on a
+ * temporary pool of worker threads. Synchronous database queries issued by a
+ * task borrow one of the pool's synch connections, so the number of threads
+ * should not exceed <Database>.SynchThreads.
+ *
+ * With a single thread the tasks run in registration order, which keeps the
+ * historic serial startup sequence.
+ */
+class AC_GAME_API LoadTaskGraph
+{
+public:
+    typedef std::size_t TaskId;
+
+    explicit LoadTaskGraph(std::string name) : _name(std::move(name)) { }
+
+    /// Registers a task; dependencies must already be registered.
+    TaskId AddTask(std::string name, std::function<void()> task, std::vector<TaskId> const& dependencies = {});
+
+    /// Executes every task and blocks until all of them are done.
+    void Run(uint32 threads);
+
+    [[nodiscard]] std::size_t GetTaskCount() const { return _tasks.size(); }
+
+private:
+    struct Task
+    {
+        std::string Name;
+        std::function<void()> Function;
+        std::vector<TaskId> Dependents;
+        uint32 DependencyCount = 0;
+        uint32 Duration = 0;
+    };
+
+    void Execute(Task& task);
+    void LogSummary(uint32 wallTime, uint32 threads) const;
+
+    std::string _name;
+    std::vector<Task> _tasks;
+};
+
+#endif
@@ -45,6 +45,7 @@
 #include "DatabaseEnv.h"
 #include "DisableMgr.h"
 #include "DynamicVisibility.h"
+#include "EpochReclaimer.h"
 #include "GameEventMgr.h"
 #include "GameGraveyard.h"
 #include "GameTime.h"
@@ -56,6 +57,7 @@
 #include "InstanceSaveMgr.h"
 #include "ItemEnchantmentMgr.h"
 #include "LFGMgr.h"
+#include "LoadTaskGraph.h"
 #include "Language.h"
 #include "Log.h"
 #include "LootItemStorage.h"
@@ -101,6 +103,7 @@
 #include "WorldStateDefines.h"
 #include <boost/asio/ip/address.hpp>
 #include <cmath>
+#include <numeric>
 
 std::atomic_long World::_stopEvent = false;
 uint8 World::_exitCode = SHUTDOWN_EXIT_CODE;
@@ -716,127 +719,245 @@ void World::SetInitialWorldSettings()
     LOG_INFO("server.loading", "Load Mail Server definitions...");
     sServerMailMgr->LoadMailServerTemplates();
 
-    // Loot tables
-    LoadLootTables();
+    ///- Loaders below only depend on the data loaded so far and on each other, run them as a dependency graph
+    LoadTaskGraph loaders("World data loaders");
 
-    LOG_INFO("server.loading", "Loading Skill Discovery Table...");
-    LoadSkillDiscoveryTable();
+    LoadTaskGraph::TaskId const lootTables = loaders.AddTask("Loot Tables", []() { LoadLootTables(); });
 
-    LOG_INFO("server.loading", "Loading Skill Extra Item Table...");
-    LoadSkillExtraItemTable();
+    loaders.AddTask("Skill Discovery Table", []()
+    {
+        LOG_INFO("server.loading", "Loading Skill Discovery Table...");
+        LoadSkillDiscoveryTable();
+    });
+
+    loaders.AddTask("Skill Extra Item Table", []()
+    {
+        LOG_INFO("server.loading", "Loading Skill Extra Item Table...");
+        LoadSkillExtraItemTable();
+    });
+
+    loaders.AddTask("Skill Perfection Data Table", []()
+    {
+        LOG_INFO("server.loading", "Loading Skill Perfection Data Table...");
+        LoadSkillPerfectItemTable();
+    });
+
+    loaders.AddTask("Skill Fishing Base Level", []()
+    {
+        LOG_INFO("server.loading", "Loading Skill Fishing Base Level Requirements...");
+        sObjectMgr->LoadFishingBaseSkillLevel();
+    });
+
+    LoadTaskGraph::TaskId const achievementReferences = loaders.AddTask("Achievements", []()
+    {
+        LOG_INFO("server.loading", "Loading Achievements...");
+        sAchievementMgr->LoadAchievementReferenceList();
+    });
+
+    LoadTaskGraph::TaskId const achievementCriteria = loaders.AddTask("Achievement Criteria Lists", []()
+    {
+        LOG_INFO("server.loading", "Loading Achievement Criteria Lists...");
+        sAchievementMgr->LoadAchievementCriteriaList();
+    }, { achievementReferences });
 
-    LOG_INFO("server.loading", "Loading Skill Perfection Data Table...");
-    LoadSkillPerfectItemTable();
+    LoadTaskGraph::TaskId const achievementCriteriaData = loaders.AddTask("Achievement Criteria Data", []()
+    {
+        LOG_INFO("server.loading", "Loading Achievement Criteria Data...");
+        sAchievementMgr->LoadAchievementCriteriaData();
+    }, { achievementCriteria });
 
-    LOG_INFO("server.loading", "Loading Skill Fishing Base Level Requirements...");
-    sObjectMgr->LoadFishingBaseSkillLevel();
+    LoadTaskGraph::TaskId const achievementRewards = loaders.AddTask("Achievement Rewards", []()
+    {
+        LOG_INFO("server.loading", "Loading Achievement Rewards...");
+        sAchievementMgr->LoadRewards();
+    }, { achievementCriteriaData });
+
+    LoadTaskGraph::TaskId const achievementRewardLocales = loaders.AddTask("Achievement Reward Locales", []()
+    {
+        LOG_INFO("server.loading", "Loading Achievement Reward Locales...");
+        sAchievementMgr->LoadRewardLocales();
+    }, { achievementRewards });
 
-    LOG_INFO("server.loading", "Loading Achievements...");
-    sAchievementMgr->LoadAchievementReferenceList();
-    LOG_INFO("server.loading", "Loading Achievement Criteria Lists...");
-    sAchievementMgr->LoadAchievementCriteriaList();
-    LOG_INFO("server.loading", "Loading Achievement Criteria Data...");
-    sAchievementMgr->LoadAchievementCriteriaData();
-    LOG_INFO("server.loading", "Loading Achievement Rewards...");
-    sAchievementMgr->LoadRewards();
-    LOG_INFO("server.loading", "Loading Achievement Reward Locales...");
-    sAchievementMgr->LoadRewardLocales();
-    LOG_INFO("server.loading", "Loading Completed Achievements...");
-    sAchievementMgr->LoadCompletedAchievements();
+    loaders.AddTask("Completed Achievements", []()
+    {
+        LOG_INFO("server.loading", "Loading Completed Achievements...");
+        sAchievementMgr->LoadCompletedAchievements();
+    }, { achievementRewardLocales });
 
     ///- Load dynamic data tables from the database
-    LOG_INFO("server.loading", "Loading Item Auctions...");
-    sAuctionMgr->LoadAuctionItems();
-    LOG_INFO("server.loading", "Loading Auctions...");
-    sAuctionMgr->LoadAuctions();
+    // These create items and update the character cache, keep them serialized among themselves
+    LoadTaskGraph::TaskId const auctionItems = loaders.AddTask("Item Auctions", []()
+    {
+        LOG_INFO("server.loading", "Loading Item Auctions...");
+        sAuctionMgr->LoadAuctionItems();
+    });
 
-    sGuildMgr->LoadGuilds();
+    LoadTaskGraph::TaskId const auctions = loaders.AddTask("Auctions", []()
+    {
+        LOG_INFO("server.loading", "Loading Auctions...");
+        sAuctionMgr->LoadAuctions();
+    }, { auctionItems });
 
-    LOG_INFO("server.loading", "Loading ArenaTeams...");
-    sArenaTeamMgr->LoadArenaTeams();
+    LoadTaskGraph::TaskId const guilds = loaders.AddTask("Guilds", []() { sGuildMgr->LoadGuilds(); }, { auctions });
 
-    LOG_INFO("server.loading", "Loading Groups...");
-    sGroupMgr->LoadGroups();
+    LoadTaskGraph::TaskId const arenaTeams = loaders.AddTask("ArenaTeams", []()
+    {
+        LOG_INFO("server.loading", "Loading ArenaTeams...");
+        sArenaTeamMgr->LoadArenaTeams();
+    }, { guilds });
 
-    LOG_INFO("server.loading", "Loading Reserved Names...");
-    sObjectMgr->LoadReservedPlayerNamesDB();
-    sObjectMgr->LoadReservedPlayerNamesDBC(); // Needs to be after LoadReservedPlayerNamesDB()
+    LoadTaskGraph::TaskId const groups = loaders.AddTask("Groups", []()
+    {
+        LOG_INFO("server.loading", "Loading Groups...");
+        sGroupMgr->LoadGroups();
+    }, { arenaTeams });
 
-    LOG_INFO("server.loading", "Loading Profanity Names...");
-    sObjectMgr->LoadProfanityNamesFromDB();
-    sObjectMgr->LoadProfanityNamesFromDBC(); // Needs to be after LoadProfanityNamesFromDB()
+    loaders.AddTask("Reserved Names", []()
+    {
+        LOG_INFO("server.loading", "Loading Reserved Names...");
+        sObjectMgr->LoadReservedPlayerNamesDB();
+        sObjectMgr->LoadReservedPlayerNamesDBC(); // Needs to be after LoadReservedPlayerNamesDB()
+    });
 
-    LOG_INFO("server.loading", "Loading Chat Filter...");
-    sObjectMgr->LoadChatFilter();
+    loaders.AddTask("Profanity Names", []()
+    {
+        LOG_INFO("server.loading", "Loading Profanity Names...");
+        sObjectMgr->LoadProfanityNamesFromDB();
+        sObjectMgr->LoadProfanityNamesFromDBC(); // Needs to be after LoadProfanityNamesFromDB()
+    });
 
-    LOG_INFO("server.loading", "Loading GameObjects for Quests...");
-    sObjectMgr->LoadGameObjectForQuests();
+    loaders.AddTask("Chat Filter", []()
+    {
+        LOG_INFO("server.loading", "Loading Chat Filter...");
+        sObjectMgr->LoadChatFilter();
+    });
 
-    LOG_INFO("server.loading", "Loading BattleMasters...");
-    sBattlegroundMgr->LoadBattleMastersEntry();
+    loaders.AddTask("GameObjects for Quests", []()
+    {
+        LOG_INFO("server.loading", "Loading GameObjects for Quests...");
+        sObjectMgr->LoadGameObjectForQuests();
+    }, { lootTables });
 
-    LOG_INFO("server.loading", "Loading GameTeleports...");
-    sObjectMgr->LoadGameTele();
+    loaders.AddTask("BattleMasters", []()
+    {
+        LOG_INFO("server.loading", "Loading BattleMasters...");
+        sBattlegroundMgr->LoadBattleMastersEntry();
+    });
 
-    LOG_INFO("server.loading", "Loading Trainers..."); // must be after LoadCreatureTemplates
-    sObjectMgr->LoadTrainers();
+    loaders.AddTask("GameTeleports", []()
+    {
+        LOG_INFO("server.loading", "Loading GameTeleports...");
+        sObjectMgr->LoadGameTele();
+    });
 
-    LOG_INFO("server.loading", "Loading Creature default trainers...");
-    sObjectMgr->LoadCreatureDefaultTrainers();
+    LoadTaskGraph::TaskId const trainers = loaders.AddTask("Trainers", []()
+    {
+        LOG_INFO("server.loading", "Loading Trainers...");
+        sObjectMgr->LoadTrainers();
+    });
 
-    LOG_INFO("server.loading", "Loading Gossip Menu...");
-    sObjectMgr->LoadGossipMenu();
+    loaders.AddTask("Creature Default Trainers", []()
+    {
+        LOG_INFO("server.loading", "Loading Creature default trainers...");
+        sObjectMgr->LoadCreatureDefaultTrainers();
+    }, { trainers });
 
-    LOG_INFO("server.loading", "Loading Gossip Menu Options...");
-    sObjectMgr->LoadGossipMenuItems();
+    LoadTaskGraph::TaskId const gossipMenu = loaders.AddTask("Gossip Menu", []()
+    {
+        LOG_INFO("server.loading", "Loading Gossip Menu...");
+        sObjectMgr->LoadGossipMenu();
+    });
 
-    LOG_INFO("server.loading", "Loading Vendors...");
-    sObjectMgr->LoadVendors();                                   // must be after load CreatureTemplate and ItemTemplate
+    loaders.AddTask("Gossip Menu Options", []()
+    {
+        LOG_INFO("server.loading", "Loading Gossip Menu Options...");
+        sObjectMgr->LoadGossipMenuItems();
+    }, { gossipMenu });
+
+    loaders.AddTask("Vendors", []()
+    {
+        LOG_INFO("server.loading", "Loading Vendors...");
+        sObjectMgr->LoadVendors();
+    });
 
-    LOG_INFO("server.loading", "Loading Waypoints...");
-    sWaypointMgr->Load();
+    LoadTaskGraph::TaskId const waypoints = loaders.AddTask("Waypoints", []()
+    {
+        LOG_INFO("server.loading", "Loading Waypoints...");
+        sWaypointMgr->Load();
+    });
 
-    LOG_INFO("server.loading", "Loading Waypoint Addons...");
-    sWaypointMgr->LoadWaypointAddons();
+    LoadTaskGraph::TaskId const waypointAddons = loaders.AddTask("Waypoint Addons", []()
+    {
+        LOG_INFO("server.loading", "Loading Waypoint Addons...");
+        sWaypointMgr->LoadWaypointAddons();
+    }, { waypoints });
 
-    LOG_INFO("server.loading", "Loading SmartAI Waypoints...");
-    sSmartWaypointMgr->LoadFromDB();
+    loaders.AddTask("SmartAI Waypoints", []()
+    {
+        LOG_INFO("server.loading", "Loading SmartAI Waypoints...");
+        sSmartWaypointMgr->LoadFromDB();
+    });
 
-    LOG_INFO("server.loading", "Loading Creature Formations...");
-    sFormationMgr->LoadCreatureFormations();
+    loaders.AddTask("Creature Formations", []()
+    {
+        LOG_INFO("server.loading", "Loading Creature Formations...");
+        sFormationMgr->LoadCreatureFormations();
+    }, { waypointAddons });
 
-    LOG_INFO("server.loading", "Loading WorldStates...");              // must be loaded before battleground, outdoor PvP and conditions
-    sWorldState->LoadWorldStates();
+    loaders.AddTask("WorldStates", []()
+    {
+        LOG_INFO("server.loading", "Loading WorldStates...");              // must be loaded before battleground, outdoor PvP and conditions
+        sWorldState->LoadWorldStates();
+    });
 
-    LOG_INFO("server.loading", "Loading Conditions...");
-    sConditionMgr->LoadConditions();
+    // Conditions are attached to loot, gossip menus, vendors, ... so everything registered so far has to be done
+    std::vector<LoadTaskGraph::TaskId> conditionDependencies(loaders.GetTaskCount());
+    std::iota(conditionDependencies.begin(), conditionDependencies.end(), 0);
 
-    LOG_INFO("server.loading", "Loading Faction Change Achievement Pairs...");
-    sObjectMgr->LoadFactionChangeAchievements();
+    loaders.AddTask("Conditions", []()
+    {
+        LOG_INFO("server.loading", "Loading Conditions...");
+        sConditionMgr->LoadConditions();
+    }, conditionDependencies);
 
-    LOG_INFO("server.loading", "Loading Faction Change Spell Pairs...");
-    sObjectMgr->LoadFactionChangeSpells();
+    loaders.AddTask("Faction Change Pairs", []()
+    {
+        LOG_INFO("server.loading", "Loading Faction Change Achievement Pairs...");
+        sObjectMgr->LoadFactionChangeAchievements();
 
-    LOG_INFO("server.loading", "Loading Faction Change Item Pairs...");
-    sObjectMgr->LoadFactionChangeItems();
+        LOG_INFO("server.loading", "Loading Faction Change Spell Pairs...");
+        sObjectMgr->LoadFactionChangeSpells();
 
-    LOG_INFO("server.loading", "Loading Faction Change Reputation Pairs...");
-    sObjectMgr->LoadFactionChangeReputations();
+        LOG_INFO("server.loading", "Loading Faction Change Item Pairs...");
+        sObjectMgr->LoadFactionChangeItems();
 
-    LOG_INFO("server.loading", "Loading Faction Change Title Pairs...");
-    sObjectMgr->LoadFactionChangeTitles();
+        LOG_INFO("server.loading", "Loading Faction Change Reputation Pairs...");
+        sObjectMgr->LoadFactionChangeReputations();
 
-    LOG_INFO("server.loading", "Loading Faction Change Quest Pairs...");
-    sObjectMgr->LoadFactionChangeQuests();
+        LOG_INFO("server.loading", "Loading Faction Change Title Pairs...");
+        sObjectMgr->LoadFactionChangeTitles();
 
-    LOG_INFO("server.loading", "Loading GM Tickets...");
-    sTicketMgr->LoadTickets();
+        LOG_INFO("server.loading", "Loading Faction Change Quest Pairs...");
+        sObjectMgr->LoadFactionChangeQuests();
+    });
 
-    LOG_INFO("server.loading", "Loading GM Surveys...");
-    sTicketMgr->LoadSurveys();
+    // Tickets resolve names through the character cache, which is still updated by the group/guild loaders
+    loaders.AddTask("GM Tickets", []()
+    {
+        LOG_INFO("server.loading", "Loading GM Tickets...");
+        sTicketMgr->LoadTickets();
 
-    LOG_INFO("server.loading", "Loading Client Addons...");
-    AddonMgr::LoadFromDB();
+        LOG_INFO("server.loading", "Loading GM Surveys...");
+        sTicketMgr->LoadSurveys();
+    }, { groups });
+
+    loaders.AddTask("Client Addons", []()
+    {
+        LOG_INFO("server.loading", "Loading Client Addons...");
+        AddonMgr::LoadFromDB();
+    });
+
+    loaders.Run(getIntConfig(CONFIG_STARTUP_LOADER_THREADS));
 
     // pussywizard:
     LOG_INFO("server.loading", "Deleting Invalid Mail Items...");
@@ -917,10 +1038,10 @@ void World::SetInitialWorldSettings()
     // our speed up
     _timers[WUPDATE_5_SECS].SetInterval(5 * IN_MILLISECONDS);
 
-    _timers[WUPDATE_WHO_LIST].SetInterval(5 * IN_MILLISECONDS); // update who list cache every 5 seconds
-
     _mail_expire_check_timer = GameTime::GetGameTime() + 6h;
 
+    InitMaintenanceJobs();
+
     ///- Initialize MapMgr
     LOG_INFO("server.loading", "Starting Map System");
     LOG_INFO("server.loading", " ");
@@ -957,6 +1078,7 @@ void World::SetInitialWorldSettings()
     LOG_INFO("server.loading", "Starting Battleground System");
     sBattlegroundMgr->LoadBattlegroundTemplates();
     sBattlegroundMgr->InitAutomaticArenaPointDistribution();
+    sBattlegroundMgr->InitPvPStatsBattlegroundIds();
 
     ///- Initialize outdoor pvp
     LOG_INFO("server.loading", "Starting Outdoor PvP System");
@@ -1106,6 +1228,88 @@ void World::DetectDBCLang()
     LOG_INFO("server.loading", " ");
 }
 
+void World::InitMaintenanceJobs()
+{
+    ///- Update Who List Cache with the players changed since the last update
+    _maintenanceScheduler.AddJob("Update who list", WorldMaintenancePriority::Normal, nullptr, [](uint32 /*diff*/, TimePoint /*deadline*/)
+    {
+        sWhoListCacheMgr->Update();
+        return WorldMaintenanceResult::Done;
+    });
+
+    _maintenanceScheduler.AddJob("Check quest reset times", WorldMaintenancePriority::Normal, [this]()
+    {
+        Seconds const currentGameTime = GameTime::GetGameTime();
+        return currentGameTime > _nextDailyQuestReset || currentGameTime > _nextWeeklyQuestReset || currentGameTime > _nextMonthlyQuestReset;
+    },
+    [this](uint32 /*diff*/, TimePoint /*deadline*/)
+    {
+        Seconds const currentGameTime = GameTime::GetGameTime();
+
+        /// Handle daily quests reset time
+        if (currentGameTime > _nextDailyQuestReset)
+            ResetDailyQuests();
+
+        /// Handle weekly quests reset time
+        if (currentGameTime > _nextWeeklyQuestReset)
+            ResetWeeklyQuests();
+
+        /// Handle monthly quests reset time
+        if (currentGameTime > _nextMonthlyQuestReset)
+            ResetMonthlyQuests();
+
+        return WorldMaintenanceResult::Done;
+    });
+
+    _maintenanceScheduler.AddJob("Reset random BG", WorldMaintenancePriority::Normal, [this]() { return GameTime::GetGameTime() > _nextRandomBGReset; },
+    [this](uint32 /*diff*/, TimePoint /*deadline*/)
+    {
+        ResetRandomBG();
+        return WorldMaintenanceResult::Done;
+    });
+
+    _maintenanceScheduler.AddJob("Delete old calendar events", WorldMaintenancePriority::Low, [this]() { return GameTime::GetGameTime() > _nextCalendarOldEventsDeletionTime; },
+    [this](uint32 /*diff*/, TimePoint /*deadline*/)
+    {
+        CalendarDeleteOldEvents();
+        return WorldMaintenanceResult::Done;
+    });
+
+    _maintenanceScheduler.AddJob("Reset guild cap", WorldMaintenancePriority::Low, [this]() { return GameTime::GetGameTime() > _nextGuildReset; },
+    [this](uint32 /*diff*/, TimePoint /*deadline*/)
+    {
+        ResetGuildCap();
+        return WorldMaintenanceResult::Done;
+    });
+
+    // pussywizard: handle expired auctions, auctions expired when realm was offline are also handled here (not during loading when many required things aren't loaded yet)
+    _maintenanceScheduler.AddJob("Update expired auctions", WorldMaintenancePriority::Normal, nullptr, [](uint32 /*diff*/, TimePoint deadline)
+    {
+        return sAuctionMgr->UpdateExpiredAuctions(deadline) ? WorldMaintenanceResult::Done : WorldMaintenanceResult::Yield;
+    });
+
+    _maintenanceScheduler.AddJob("Return old mails", WorldMaintenancePriority::Low, [this]() { return GameTime::GetGameTime() > _mail_expire_check_timer; },
+    [this](uint32 /*diff*/, TimePoint /*deadline*/)
+    {
+        sMailMgr->ReturnOrDeleteOldMails(true);
+        _mail_expire_check_timer = GameTime::GetGameTime() + 6h;
+        return WorldMaintenanceResult::Done;
+    });
+
+    /// <li> Clean logs table, if not enabled ignore the timer
+    _maintenanceScheduler.AddJob("Clean logs table", WorldMaintenancePriority::Low, [this]() { return getIntConfig(CONFIG_LOGDB_CLEARTIME) > 0 && _timers[WUPDATE_CLEANDB].Passed(); },
+    [this](uint32 /*diff*/, TimePoint /*deadline*/)
+    {
+        _timers[WUPDATE_CLEANDB].Reset();
+
+        LoginDatabasePreparedStatement* stmt = LoginDatabase.GetPreparedStatement(LOGIN_DEL_OLD_LOGS);
+        stmt->SetData(0, getIntConfig(CONFIG_LOGDB_CLEARTIME));
+        stmt->SetData(1, uint32(GameTime::GetGameTime().count()));
+        LoginDatabase.Execute(stmt);
+        return WorldMaintenanceResult::Done;
+    });
+}
+
 /// Update the World !
 void World::Update(uint32 diff)
 {
@@ -1113,7 +1317,6 @@ void World::Update(uint32 diff)
 
     ///- Update the game time and check for shutdown time
     _UpdateGameTime();
-    Seconds currentGameTime = GameTime::GetGameTime();
 
     sWorldUpdateTime.UpdateWithDiff(diff);
 
@@ -1122,6 +1325,9 @@ void World::Update(uint32 diff)
 
     DynamicVisibilityMgr::Update(sWorldSessionMgr->GetActiveSessionCount());
 
+    // Free the data unpublished by lock-free containers during the previous tick
+    Acore::EpochReclaimer::Advance();
+
     ///- Update the different timers
     for (int i = 0; i < WUPDATE_COUNT; ++i)
     {
@@ -1141,87 +1347,21 @@ void World::Update(uint32 diff)
         CharacterDatabase.Execute(stmt);
     }
 
-    ///- Update Who List Cache
-    if (_timers[WUPDATE_WHO_LIST].Passed())
     {
-        METRIC_TIMER("world_update_time", METRIC_TAG("type", "Update who list"));
-        _timers[WUPDATE_WHO_LIST].Reset();
-        sWhoListCacheMgr->Update();
+        METRIC_TIMER("world_update_time", METRIC_TAG("type", "Update maintenance jobs"));
+        _maintenanceScheduler.Update(diff, Milliseconds(getIntConfig(CONFIG_WORLD_MAINTENANCE_BUDGET)));
     }
 
     {
-        METRIC_TIMER("world_update_time", METRIC_TAG("type", "Check quest reset times"));
-
-        /// Handle daily quests reset time
-        if (currentGameTime > _nextDailyQuestReset)
-        {
-            ResetDailyQuests();
-        }
-
-        /// Handle weekly quests reset time
-        if (currentGameTime > _nextWeeklyQuestReset)
-        {
-            ResetWeeklyQuests();
-        }
-
-        /// Handle monthly quests reset time
-        if (currentGameTime > _nextMonthlyQuestReset)
-        {
-            ResetMonthlyQuests();
-        }
-    }
-
-    if (currentGameTime > _nextRandomBGReset)
-    {
-        METRIC_TIMER("world_update_time", METRIC_TAG("type", "Reset random BG"));
-        ResetRandomBG();
-    }
-
-    if (currentGameTime > _nextCalendarOldEventsDeletionTime)
-    {
-        METRIC_TIMER("world_update_time", METRIC_TAG("type", "Delete old calendar events"));
-        CalendarDeleteOldEvents();
-    }
-
-    if (currentGameTime > _nextGuildReset)
-    {
-        METRIC_TIMER("world_update_time", METRIC_TAG("type", "Reset guild cap"));
-        ResetGuildCap();
-    }
-
-    {
-        // pussywizard: handle expired auctions, auctions expired when realm was offline are also handled here (not during loading when many required things aren't loaded yet)
-        METRIC_TIMER("world_update_time", METRIC_TAG("type", "Update expired auctions"));
+        METRIC_TIMER("world_update_time", METRIC_TAG("type", "Update auction house"));
         sAuctionMgr->Update(diff);
     }
 
-    if (currentGameTime > _mail_expire_check_timer)
-    {
-        sMailMgr->ReturnOrDeleteOldMails(true);
-        _mail_expire_check_timer = currentGameTime + 6h;
-    }
-
     {
         METRIC_TIMER("world_update_time", METRIC_TAG("type", "Update sessions"));
         sWorldSessionMgr->UpdateSessions(diff);
     }
 
-    /// <li> Clean logs table
-    if (getIntConfig(CONFIG_LOGDB_CLEARTIME) > 0) // if not enabled, ignore the timer
-    {
-        if (_timers[WUPDATE_CLEANDB].Passed())
-        {
-            METRIC_TIMER("world_update_time", METRIC_TAG("type", "Clean logs table"));
-
-            _timers[WUPDATE_CLEANDB].Reset();
-
-            LoginDatabasePreparedStatement* stmt = LoginDatabase.GetPreparedStatement(LOGIN_DEL_OLD_LOGS);
-            stmt->SetData(0, getIntConfig(CONFIG_LOGDB_CLEARTIME));
-            stmt->SetData(1, uint32(currentGameTime.count()));
-            LoginDatabase.Execute(stmt);
-        }
-    }
-
     {
         METRIC_TIMER("world_update_time", METRIC_TAG("type", "Update LFG 0"));
         sLFGMgr->Update(diff, 0); // pussywizard: remove obsolete stuff before finding compatibility during map update
@@ -28,6 +28,7 @@
 #include "ObjectGuid.h"
 #include "SharedDefines.h"
 #include "Timer.h"
+#include "WorldMaintenanceScheduler.h"
 #include <atomic>
 #include <list>
 #include <map>
@@ -65,7 +66,6 @@ enum WorldTimers
     WUPDATE_MAILBOXQUEUE,
     WUPDATE_PINGDB,
     WUPDATE_5_SECS,
-    WUPDATE_WHO_LIST,
     WUPDATE_COUNT
 };
 
@@ -258,6 +258,7 @@ protected:
     void ResetRandomBG();
     void CalendarDeleteOldEvents();
     void ResetGuildCap();
+    void InitMaintenanceJobs();
 private:
     WorldConfig _worldConfig;
 
@@ -273,6 +274,7 @@ private:
 
     IntervalTimer _timers[WUPDATE_COUNT];
     Seconds _mail_expire_check_timer;
+    WorldMaintenanceScheduler _maintenanceScheduler;
 
     AccountTypes _allowedSecurityLevel;
     LocaleConstant _defaultDbcLocale;                     // from config for one from loaded DBC locales
@@ -151,6 +151,10 @@ void WorldConfig::BuildConfigCache()
 
     SetConfigValue<uint32>(CONFIG_COMPRESSION, "Compression", 1, ConfigValueCache::Reloadable::Yes, [](uint32 const& value) { return value > 0 && value < 10; }, "> 0 && < 10");
 
+    SetConfigValue<bool>(CONFIG_NETWORK_COMPRESSED_MOVES, "Network.CompressedMoves", false);
+    SetConfigValue<uint32>(CONFIG_NETWORK_COMPRESSED_MOVES_MAX_SIZE, "Network.CompressedMoves.MaxSize", 2048, ConfigValueCache::Reloadable::Yes, [](uint32 const& value) { return value > 0; }, "> 0");
+    SetConfigValue<uint32>(CONFIG_NETWORK_COMPRESSED_MOVES_MAX_DELAY, "Network.CompressedMoves.MaxDelay", 50);
+
     SetConfigValue<bool>(CONFIG_ADDON_CHANNEL, "AddonChannel", true);
     SetConfigValue<bool>(CONFIG_CLEAN_CHARACTER_DB, "CleanCharacterDB", false);
     SetConfigValue<uint32>(CONFIG_PERSISTENT_CHARACTER_CLEAN_FLAGS, "PersistentCharacterCleanFlags", 0);
@@ -173,6 +177,7 @@ void WorldConfig::BuildConfigCache()
     SetConfigValue<uint32>(CONFIG_MIN_LEVEL_STAT_SAVE, "PlayerSave.Stats.MinLevel", 0, ConfigValueCache::Reloadable::Yes, [](uint32 const& value) { return value < MAX_LEVEL; }, "< MAX_LEVEL");
 
     SetConfigValue<uint32>(CONFIG_INTERVAL_MAPUPDATE, "MapUpdateInterval", 10, ConfigValueCache::Reloadable::Yes, [](uint32 const& value) { return value >= MIN_MAP_UPDATE_DELAY; }, ">= MIN_MAP_UPDATE_DELAY");
+    SetConfigValue<uint32>(CONFIG_WORLD_MAINTENANCE_BUDGET, "WorldMaintenanceBudget", 10);
 
     SetConfigValue<uint32>(CONFIG_INTERVAL_CHANGEWEATHER, "ChangeWeatherInterval", 600000);
 
@@ -298,6 +303,14 @@ void WorldConfig::BuildConfigCache()
 
     SetConfigValue<bool>(CONFIG_OBJECT_QUEST_MARKERS, "Visibility.ObjectQuestMarkers", true);
 
+    SetConfigValue<bool>(CONFIG_VISIBILITY_INCREMENTAL_UPDATE, "Visibility.IncrementalUpdate", false);
+    SetConfigValue<uint32>(CONFIG_VISIBILITY_FULL_UPDATE_INTERVAL, "Visibility.IncrementalUpdate.FullUpdateInterval", 5000);
+
+    SetConfigValue<bool>(CONFIG_INTEREST_MANAGEMENT, "InterestManagement.Enable", false);
+    SetConfigValue<uint32>(CONFIG_INTEREST_FULL_RATE_DISTANCE, "InterestManagement.FullRateDistance", 30);
+    SetConfigValue<uint32>(CONFIG_INTEREST_DISTANCE_STEP, "InterestManagement.DistanceStep", 30, ConfigValueCache::Reloadable::Yes, [](uint32 const& value) { return value > 0; }, "> 0");
+    SetConfigValue<uint32>(CONFIG_INTEREST_MAX_DIVISOR, "InterestManagement.MaxDivisor", 4, ConfigValueCache::Reloadable::Yes, [](uint32 const& value) { return value > 0; }, "> 0");
+
     SetConfigValue<uint32>(CONFIG_MAIL_DELIVERY_DELAY, "MailDeliveryDelay", HOUR);
 
     SetConfigValue<uint32>(CONFIG_UPTIME_UPDATE, "UpdateUptimeInterval", 10, ConfigValueCache::Reloadable::Yes, [](uint32 const& value) { return value > 0; }, "> 0");
@@ -572,6 +585,13 @@ void WorldConfig::BuildConfigCache()
     SetConfigValue<bool>(CONFIG_SHOW_MUTE_IN_WORLD, "ShowMuteInWorld", false);
     SetConfigValue<bool>(CONFIG_SHOW_BAN_IN_WORLD, "ShowBanInWorld", false);
     SetConfigValue<uint32>(CONFIG_NUMTHREADS, "MapUpdate.Threads", 1);
+    SetConfigValue<bool>(CONFIG_MAP_PARALLEL_MOVEMENT_RELAY, "MapUpdate.ParallelMovementRelay", false);
+    SetConfigValue<uint32>(CONFIG_MAP_PARALLEL_MOVEMENT_RELAY_MIN_PLAYERS, "MapUpdate.ParallelMovementRelay.MinPlayers", 100);
+    SetConfigValue<bool>(CONFIG_PARALLEL_SESSION_UPDATE, "MapUpdate.ParallelSessionPackets", false);
+    SetConfigValue<uint32>(CONFIG_PARALLEL_SESSION_UPDATE_MIN_SESSIONS, "MapUpdate.ParallelSessionPackets.MinSessions", 500);
+    SetConfigValue<bool>(CONFIG_MAP_PVP_UPDATE, "MapUpdate.PvP", false);
+    SetConfigValue<uint32>(CONFIG_STARTUP_LOADER_THREADS, "Startup.LoaderThreads", 1, ConfigValueCache::Reloadable::No, [](uint32 const& value) { return value > 0; }, "> 0");
+    SetConfigValue<std::string>(CONFIG_CHARACTER_CACHE_SNAPSHOT, "Startup.CharacterCacheSnapshot", "", ConfigValueCache::Reloadable::No);
     SetConfigValue<uint32>(CONFIG_MAX_RESULTS_LOOKUP_COMMANDS, "Command.LookupMaxResults", 0);
 
     // Warden
@@ -609,6 +629,8 @@ void WorldConfig::BuildConfigCache()
     SetConfigValue<bool>(CONFIG_PDUMP_NO_PATHS, "PlayerDump.DisallowPaths", true);
     SetConfigValue<bool>(CONFIG_PDUMP_NO_OVERWRITE, "PlayerDump.DisallowOverwrite", true);
     SetConfigValue<bool>(CONFIG_ENABLE_MMAPS, "MoveMaps.Enable", true);
+    SetConfigValue<uint32>(CONFIG_MMAP_PATH_CACHE_SIZE, "MoveMaps.PathCache.Size", 0);
+    SetConfigValue<uint32>(CONFIG_MMAP_PATH_CACHE_DURATION, "MoveMaps.PathCache.Duration", 5000);
 
     // Wintergrasp
     SetConfigValue<uint32>(CONFIG_WINTERGRASP_ENABLE, "Wintergrasp.Enable", 1);
@@ -651,6 +673,14 @@ void WorldConfig::BuildConfigCache()
     // Preload all grids of all non-instanced maps
     SetConfigValue<bool>(CONFIG_PRELOAD_ALL_NON_INSTANCED_MAP_GRIDS, "PreloadAllNonInstancedMapGrids", false);
 
+    // Read grid terrain ahead of player movement
+    SetConfigValue<bool>(CONFIG_GRID_PREFETCH_ENABLE, "GridPrefetch.Enable", false, ConfigValueCache::Reloadable::No);
+    SetConfigValue<uint32>(CONFIG_GRID_PREFETCH_THREADS, "GridPrefetch.Threads", 1, ConfigValueCache::Reloadable::No, [](uint32 const& value) { return value > 0; }, "> 0");
+    SetConfigValue<uint32>(CONFIG_GRID_PREFETCH_LOOKAHEAD, "GridPrefetch.LookAhead", 10, ConfigValueCache::Reloadable::Yes, [](uint32 const& value) { return value > 0; }, "> 0");
+
+    // Map terrain files instead of reading them into memory
+    SetConfigValue<bool>(CONFIG_GRID_TERRAIN_MEMORY_MAPPED, "GridTerrain.MemoryMapped", false, ConfigValueCache::Reloadable::No);
+
     // ICC buff override
     SetConfigValue<uint32>(CONFIG_ICC_BUFF_HORDE, "ICC.Buff.Horde", 73822);
     SetConfigValue<uint32>(CONFIG_ICC_BUFF_ALLIANCE, "ICC.Buff.Alliance", 73828);
@@ -697,6 +727,7 @@ void WorldConfig::BuildConfigCache()
 
     // AH Worker threads
     SetConfigValue<uint32>(CONFIG_AUCTIONHOUSE_WORKERTHREADS, "AuctionHouse.WorkerThreads", 1, ConfigValueCache::Reloadable::No, [](uint32 const& value) { return value >= 1; }, ">= 1");
+    SetConfigValue<uint32>(CONFIG_AUCTIONHOUSE_EXPIRE_UPDATE_BUDGET, "AuctionHouse.ExpireUpdateBudget", 10, ConfigValueCache::Reloadable::Yes, [](uint32 const& value) { return value >= 1; }, ">= 1");
 
     // SpellQueue
     SetConfigValue<bool>(CONFIG_SPELL_QUEUE_ENABLED, "SpellQueue.Enabled", true);
@@ -116,6 +116,14 @@ enum ServerConfigs
     CONFIG_CLOSE_IDLE_CONNECTIONS,
     CONFIG_LFG_LOCATION_ALL,
     CONFIG_PRELOAD_ALL_NON_INSTANCED_MAP_GRIDS,
+    CONFIG_GRID_PREFETCH_ENABLE,
+    CONFIG_GRID_TERRAIN_MEMORY_MAPPED,
+    CONFIG_VISIBILITY_INCREMENTAL_UPDATE,
+    CONFIG_NETWORK_COMPRESSED_MOVES,
+    CONFIG_INTEREST_MANAGEMENT,
+    CONFIG_MAP_PARALLEL_MOVEMENT_RELAY,
+    CONFIG_PARALLEL_SESSION_UPDATE,
+    CONFIG_MAP_PVP_UPDATE,
     CONFIG_ITEMDELETE_METHOD,
     CONFIG_ITEMDELETE_VENDOR,
     CONFIG_DEBUG_BATTLEGROUND,
@@ -167,6 +175,7 @@ enum ServerConfigs
     CONFIG_RESPAWN_DYNAMICRATE_CREATURE,
     CONFIG_COMPRESSION,
     CONFIG_INTERVAL_MAPUPDATE,
+    CONFIG_WORLD_MAINTENANCE_BUDGET,
     CONFIG_INTERVAL_CHANGEWEATHER,
     CONFIG_INTERVAL_DISCONNECT_TOLERANCE,
     CONFIG_INTERVAL_SAVE,
@@ -307,6 +316,20 @@ enum ServerConfigs
     CONFIG_PVP_TOKEN_COUNT,
     CONFIG_ENABLE_SINFO_LOGIN,
     CONFIG_NUMTHREADS,
+    CONFIG_STARTUP_LOADER_THREADS,
+    CONFIG_CHARACTER_CACHE_SNAPSHOT,
+    CONFIG_GRID_PREFETCH_THREADS,
+    CONFIG_GRID_PREFETCH_LOOKAHEAD,
+    CONFIG_MMAP_PATH_CACHE_SIZE,
+    CONFIG_MMAP_PATH_CACHE_DURATION,
+    CONFIG_VISIBILITY_FULL_UPDATE_INTERVAL,
+    CONFIG_NETWORK_COMPRESSED_MOVES_MAX_SIZE,
+    CONFIG_NETWORK_COMPRESSED_MOVES_MAX_DELAY,
+    CONFIG_INTEREST_FULL_RATE_DISTANCE,
+    CONFIG_INTEREST_DISTANCE_STEP,
+    CONFIG_INTEREST_MAX_DIVISOR,
+    CONFIG_MAP_PARALLEL_MOVEMENT_RELAY_MIN_PLAYERS,
+    CONFIG_PARALLEL_SESSION_UPDATE_MIN_SESSIONS,
     CONFIG_LOGDB_CLEARINTERVAL,
     CONFIG_LOGDB_CLEARTIME,
     CONFIG_MAX_ALLOWED_MMR_DROP,
@@ -392,6 +415,7 @@ enum ServerConfigs
     CONFIG_WATER_BREATH_TIMER,
     CONFIG_DAILY_RBG_MIN_LEVEL_AP_REWARD,
     CONFIG_AUCTIONHOUSE_WORKERTHREADS,
+    CONFIG_AUCTIONHOUSE_EXPIRE_UPDATE_BUDGET,
     CONFIG_SPELL_QUEUE_WINDOW,
     CONFIG_SUNSREACH_COUNTER_MAX,
     CONFIG_SCOURGEINVASION_COUNTER_FIRST,
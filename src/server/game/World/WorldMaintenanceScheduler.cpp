@@ -0,0 +1,72 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "WorldMaintenanceScheduler.h"
+#include "Metric.h"
+#include <algorithm>
+#include <tuple>
+
+void WorldMaintenanceScheduler::AddJob(std::string name, WorldMaintenancePriority priority, DuePredicate isDue, JobFunction function)
+{
+    Job& job = _jobs.emplace_back();
+    job.Name = std::move(name);
+    job.Priority = priority;
+    job.IsDue = std::move(isDue);
+    job.Function = std::move(function);
+
+    _order.push_back(_jobs.size() - 1);
+}
+
+void WorldMaintenanceScheduler::Update(uint32 diff, Milliseconds budget)
+{
+    TimePoint const deadline = std::chrono::steady_clock::now() + budget;
+
+    for (Job& job : _jobs)
+        job.Elapsed += diff;
+
+    // Within a priority the yielded jobs first, then the ones waiting longest, then registration order
+    std::stable_sort(_order.begin(), _order.end(), [this](std::size_t left, std::size_t right)
+    {
+        Job const& l = _jobs[left];
+        Job const& r = _jobs[right];
+        return std::make_tuple(l.Priority, !l.Yielded, r.DeferredTicks) < std::make_tuple(r.Priority, !r.Yielded, l.DeferredTicks);
+    });
+
+    for (std::size_t index : _order)
+    {
+        Job& job = _jobs[index];
+        if (!job.Yielded && job.IsDue && !job.IsDue())
+            continue;
+
+        if (job.Priority != WorldMaintenancePriority::High && job.DeferredTicks < MAX_DEFERRED_TICKS && std::chrono::steady_clock::now() >= deadline)
+        {
+            ++job.DeferredTicks;
+            continue;
+        }
+
+        Run(job, deadline);
+    }
+}
+
+void WorldMaintenanceScheduler::Run(Job& job, TimePoint deadline)
+{
+    METRIC_TIMER("world_update_time", METRIC_TAG("type", job.Name));
+
+    job.Yielded = job.Function(job.Elapsed, deadline) == WorldMaintenanceResult::Yield;
+    job.Elapsed = 0;
+    job.DeferredTicks = 0;
+}
@@ -0,0 +1,89 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _WORLD_MAINTENANCE_SCHEDULER_H
+#define _WORLD_MAINTENANCE_SCHEDULER_H
+
+#include "Define.h"
+#include "Duration.h"
+#include <functional>
+#include <string>
+#include <vector>
+
+enum class WorldMaintenancePriority : uint8
+{
+    High,   // runs every tick, whatever is left of the budget
+    Normal,
+    Low
+};
+
+enum class WorldMaintenanceResult : uint8
+{
+    Done,   // nothing left until the job is due again
+    Yield   // stopped at the deadline with work left, resumes first in the next tick
+};
+
+/**
+ * Maintenance jobs of the world thread run once per tick within a time budget.
+ *
+ * Due jobs run by priority. Once the budget is spent the remaining Normal and
+ * Low jobs are deferred to the next tick, where they run ahead of the jobs of
+ * their priority that were not deferred. A job deferred MAX_DEFERRED_TICKS
+ * times in a row runs regardless of the budget.
+ *
+ * A job cannot be interrupted, long jobs have to check the deadline they are
+ * given and return Yield to continue in the next tick.
+ *
+ * The run time of every job is reported as world_update_time with the job
+ * name as type tag.
+ */
+class AC_GAME_API WorldMaintenanceScheduler
+{
+public:
+    /// diff is the time since the job last ran
+    typedef std::function<WorldMaintenanceResult(uint32 diff, TimePoint deadline)> JobFunction;
+    typedef std::function<bool()> DuePredicate;
+
+    static constexpr uint32 MAX_DEFERRED_TICKS = 10;
+
+    /// A job without due predicate is due every tick
+    void AddJob(std::string name, WorldMaintenancePriority priority, DuePredicate isDue, JobFunction function);
+
+    void Update(uint32 diff, Milliseconds budget);
+
+    [[nodiscard]] std::size_t GetJobCount() const { return _jobs.size(); }
+    [[nodiscard]] uint32 GetDeferredTicks(std::size_t job) const { return _jobs[job].DeferredTicks; }
+
+private:
+    struct Job
+    {
+        std::string Name;
+        WorldMaintenancePriority Priority;
+        DuePredicate IsDue;
+        JobFunction Function;
+        uint32 Elapsed = 0;
+        uint32 DeferredTicks = 0;
+        bool Yielded = false;
+    };
+
+    void Run(Job& job, TimePoint deadline);
+
+    std::vector<Job> _jobs;
+    std::vector<std::size_t> _order;
+};
+
+#endif
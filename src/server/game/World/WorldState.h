@@ -22,6 +22,7 @@
 #include "Player.h"
 #include "WorldStateDefines.h"
 #include <atomic>
+#include <shared_mutex>
 
 enum WorldStateCondition
 {
@@ -310,6 +311,7 @@ class WorldState
     private:
         typedef std::map<uint32, uint64> WorldStatesMap;
         WorldStatesMap _worldstates;
+        mutable std::shared_mutex _worldstatesLock; // battlefields and outdoor pvp set saved world states from map threads
         void SendWorldstateUpdate(std::mutex& mutex, GuidVector const& guids, uint32 value, uint32 worldStateId);
         void StopSunsReachPhase(bool forward);
         void StartSunsReachPhase(bool initial = false);
@@ -1880,7 +1880,7 @@ public:
         ObjectGuid guid = playerTarget->GetGUID();
         std::string name = playerTarget->GetName();
 
-        CharacterCacheEntry const* playerData = sCharacterCache->GetCharacterCacheByGuid(guid);
+        Optional<CharacterCacheEntry> playerData = sCharacterCache->GetCharacterCacheByGuid(guid);
         if (!playerData)
         {
             handler->SendErrorMessage(LANG_PLAYER_NOT_FOUND);
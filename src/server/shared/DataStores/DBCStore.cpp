@@ -17,6 +17,7 @@
 
 #include "DBCStore.h"
 #include "DBCDatabaseLoader.h"
+#include <boost/interprocess/mapped_region.hpp>
 
 DBCStorageBase::DBCStorageBase(char const* fmt) : _fieldCount(0), _fileFormat(fmt), _dataTable(nullptr), _indexTableSize(0)
 {
@@ -41,6 +42,13 @@ bool DBCStorageBase::Load(char const* path, char**& indexTable)
 
     _fieldCount = dbc.GetCols();
 
+    // keep the file image when the records can be used as they are, database rows are added on top of it
+    if (dbc.AutoProduceMappedData(_fileFormat, _indexTableSize, indexTable))
+    {
+        _fileImage = dbc.ReleaseFileImage();
+        return true;
+    }
+
     // load raw non-string data
     _dataTable = dbc.AutoProduceData(_fileFormat, _indexTableSize, indexTable);
 
@@ -58,6 +66,10 @@ bool DBCStorageBase::LoadStringsFrom(char const* path, char** indexTable)
     if (!indexTable)
         return false;
 
+    // nothing to localize
+    if (!DBCFileLoader::HasStrings(_fileFormat))
+        return true;
+
     DBCFileLoader dbc;
 
     // Check if load was successful, only then continue
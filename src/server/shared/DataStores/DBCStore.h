@@ -19,9 +19,11 @@
 #define DBCSTORE_H
 
 #include "Common.h"
+#include "DBCFileLoader.h"
 #include "DBCStorageIterator.h"
 #include "Errors.h"
 #include <cstring>
+#include <memory>
 #include <vector>
 
 /// Interface class for common access
@@ -46,6 +48,7 @@ protected:
     uint32 _fieldCount;
     char const* _fileFormat;
     char* _dataTable;
+    std::unique_ptr<DBCFileLoader::FileImage> _fileImage;   // records of numeric only stores point into it
     std::vector<char*> _stringPool;
     uint32 _indexTableSize;
 };
@@ -16,6 +16,7 @@
  */
 
 #include "ByteBuffer.h"
+#include "ByteBufferPool.h"
 #include "Errors.h"
 #include "Log.h"
 #include "MessageBuffer.h"
@@ -24,9 +25,39 @@
 #include <sstream>
 #include <utf8.h>
 
+ByteBuffer::ByteBuffer() :
+    _storage(ByteBufferPool::Acquire(DEFAULT_SIZE)) { }
+
+ByteBuffer::ByteBuffer(std::size_t reserve) :
+    _rpos(0), _wpos(0)
+{
+    if (reserve)
+        _storage = ByteBufferPool::Acquire(reserve);
+}
+
 ByteBuffer::ByteBuffer(MessageBuffer&& buffer) :
     _rpos(0), _wpos(0), _storage(buffer.Move()) { }
 
+ByteBuffer::~ByteBuffer()
+{
+    ByteBufferPool::Release(std::move(_storage));
+}
+
+ByteBuffer& ByteBuffer::operator=(ByteBuffer&& right) noexcept
+{
+    if (this != &right)
+    {
+        _rpos = right._rpos;
+        right._rpos = 0;
+        _wpos = right._wpos;
+        right._wpos = 0;
+        ByteBufferPool::Release(std::move(_storage));
+        _storage = std::move(right._storage);
+    }
+
+    return *this;
+}
+
 ByteBufferPositionException::ByteBufferPositionException(bool add, std::size_t pos, std::size_t size, std::size_t valueSize)
 {
     std::ostringstream ss;
@@ -118,13 +149,13 @@ void ByteBuffer::append(uint8 const* src, std::size_t cnt)
     if (_storage.capacity() < newSize) // custom memory allocation rules
     {
         if (newSize < 100)
-            _storage.reserve(300);
+            GrowStorage(300);
         else if (newSize < 750)
-            _storage.reserve(2500);
+            GrowStorage(2500);
         else if (newSize < 6000)
-            _storage.reserve(10000);
+            GrowStorage(10000);
         else
-            _storage.reserve(400000);
+            GrowStorage(400000);
     }
 
     if (_storage.size() < newSize)
@@ -134,6 +165,14 @@ void ByteBuffer::append(uint8 const* src, std::size_t cnt)
     _wpos = newSize;
 }
 
+void ByteBuffer::GrowStorage(std::size_t capacity)
+{
+    std::vector<uint8> storage = ByteBufferPool::Acquire(capacity);
+    storage.assign(_storage.begin(), _storage.end());
+    ByteBufferPool::Release(std::move(_storage));
+    _storage = std::move(storage);
+}
+
 void ByteBuffer::AppendPackedTime(time_t time)
 {
     tm lt = Acore::Time::TimeBreakdown(time);
@@ -71,16 +71,11 @@ class AC_SHARED_API ByteBuffer
 public:
     constexpr static std::size_t DEFAULT_SIZE = 0x1000;
 
-    // constructor
-    ByteBuffer()
-    {
-        _storage.reserve(DEFAULT_SIZE);
-    }
+    // constructor, the storage comes from ByteBufferPool and returns to it on destruction
+    ByteBuffer();
 
-    explicit ByteBuffer(std::size_t reserve) : _rpos(0), _wpos(0)
-    {
-        _storage.reserve(reserve);
-    }
+    // reserves at least the given size up front, 0 for a buffer that will be assigned later
+    explicit ByteBuffer(std::size_t reserve);
 
     ByteBuffer(ByteBuffer&& buf) noexcept :
         _rpos(buf._rpos), _wpos(buf._wpos), _storage(std::move(buf._storage))
@@ -91,7 +86,7 @@ public:
 
     ByteBuffer(ByteBuffer const& right) = default;
     explicit ByteBuffer(MessageBuffer&& buffer);
-    virtual ~ByteBuffer() = default;
+    virtual ~ByteBuffer();
 
     ByteBuffer& operator=(ByteBuffer const& right)
     {
@@ -105,19 +100,7 @@ public:
         return *this;
     }
 
-    ByteBuffer& operator=(ByteBuffer&& right) noexcept
-    {
-        if (this != &right)
-        {
-            _rpos = right._rpos;
-            right._rpos = 0;
-            _wpos = right._wpos;
-            right._wpos = 0;
-            _storage = std::move(right._storage);
-        }
-
-        return *this;
-    }
+    ByteBuffer& operator=(ByteBuffer&& right) noexcept;
 
     void clear()
     {
@@ -530,6 +513,10 @@ public:
 protected:
     std::size_t _rpos{0}, _wpos{0};
     std::vector<uint8> _storage;
+
+private:
+    // Moves the contents to recycled storage of at least the given capacity
+    void GrowStorage(std::size_t capacity);
 };
 
 /// @todo Make a ByteBuffer.cpp and move all this inlining to it.
@@ -0,0 +1,172 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "ByteBufferPool.h"
+#include <mutex>
+
+namespace
+{
+    constexpr std::size_t SIZE_CLASS_COUNT = ByteBufferPool::SizeClasses.size();
+
+    // Buffers kept by each thread per size class, half of them are exchanged with the depot at once
+    constexpr std::size_t THREAD_CACHE_SIZE = 32;
+    constexpr std::size_t TRANSFER_BATCH_SIZE = THREAD_CACHE_SIZE / 2;
+
+    // Memory kept by the depot per size class
+    constexpr std::size_t DEPOT_BYTES_PER_CLASS = 4 * 1024 * 1024;
+
+    typedef std::vector<std::vector<uint8>> StorageList;
+
+    // Smallest class able to hold reserve bytes
+    std::size_t GetAcquireClass(std::size_t reserve)
+    {
+        for (std::size_t i = 0; i < SIZE_CLASS_COUNT; ++i)
+            if (reserve <= ByteBufferPool::SizeClasses[i])
+                return i;
+
+        return SIZE_CLASS_COUNT;
+    }
+
+    // Largest class the capacity satisfies, storage grown past the largest class is not kept
+    std::size_t GetReleaseClass(std::size_t capacity)
+    {
+        if (capacity < ByteBufferPool::SizeClasses[0] || capacity > ByteBufferPool::SizeClasses[SIZE_CLASS_COUNT - 1] * 2)
+            return SIZE_CLASS_COUNT;
+
+        std::size_t sizeClass = 0;
+        while (sizeClass + 1 < SIZE_CLASS_COUNT && capacity >= ByteBufferPool::SizeClasses[sizeClass + 1])
+            ++sizeClass;
+
+        return sizeClass;
+    }
+
+    class Depot
+    {
+    public:
+        static Depot& Instance()
+        {
+            // Never destroyed, buffers may still be released while static objects are destroyed
+            static Depot* instance = new Depot();
+            return *instance;
+        }
+
+        void Take(std::size_t sizeClass, StorageList& list, std::size_t count)
+        {
+            std::lock_guard<std::mutex> guard(_lock);
+            StorageList& storages = _storages[sizeClass];
+            while (count-- && !storages.empty())
+            {
+                list.push_back(std::move(storages.back()));
+                storages.pop_back();
+            }
+        }
+
+        void Give(std::size_t sizeClass, StorageList& list, std::size_t count)
+        {
+            std::size_t const maxCount = DEPOT_BYTES_PER_CLASS / ByteBufferPool::SizeClasses[sizeClass];
+
+            std::lock_guard<std::mutex> guard(_lock);
+            StorageList& storages = _storages[sizeClass];
+            while (count-- && !list.empty())
+            {
+                if (storages.size() < maxCount)
+                    storages.push_back(std::move(list.back()));
+                list.pop_back();
+            }
+        }
+
+    private:
+        std::mutex _lock;
+        std::array<StorageList, SIZE_CLASS_COUNT> _storages;
+    };
+
+    struct ThreadCache
+    {
+        ~ThreadCache()
+        {
+            for (std::size_t i = 0; i < SIZE_CLASS_COUNT; ++i)
+                Depot::Instance().Give(i, Storages[i], Storages[i].size());
+        }
+
+        std::array<StorageList, SIZE_CLASS_COUNT> Storages;
+    };
+
+    // The cache is gone once its thread started exiting, buffers destroyed after that are freed normally
+    thread_local bool ThreadCacheDestroyed = false;
+
+    ThreadCache* GetThreadCache()
+    {
+        struct Holder
+        {
+            ~Holder() { ThreadCacheDestroyed = true; }
+            ThreadCache Cache;
+        };
+
+        if (ThreadCacheDestroyed)
+            return nullptr;
+
+        thread_local Holder holder;
+        return &holder.Cache;
+    }
+}
+
+std::vector<uint8> ByteBufferPool::Acquire(std::size_t reserve)
+{
+    std::vector<uint8> storage;
+
+    std::size_t const sizeClass = GetAcquireClass(reserve);
+    if (sizeClass == SIZE_CLASS_COUNT)
+    {
+        storage.reserve(reserve);
+        return storage;
+    }
+
+    if (ThreadCache* cache = GetThreadCache())
+    {
+        StorageList& storages = cache->Storages[sizeClass];
+        if (storages.empty())
+            Depot::Instance().Take(sizeClass, storages, TRANSFER_BATCH_SIZE);
+
+        if (!storages.empty())
+        {
+            storage = std::move(storages.back());
+            storages.pop_back();
+            return storage;
+        }
+    }
+
+    storage.reserve(SizeClasses[sizeClass]);
+    return storage;
+}
+
+void ByteBufferPool::Release(std::vector<uint8>&& storage)
+{
+    std::size_t const sizeClass = GetReleaseClass(storage.capacity());
+    if (sizeClass == SIZE_CLASS_COUNT)
+        return;
+
+    ThreadCache* cache = GetThreadCache();
+    if (!cache)
+        return;
+
+    StorageList& storages = cache->Storages[sizeClass];
+    if (storages.size() >= THREAD_CACHE_SIZE)
+        Depot::Instance().Give(sizeClass, storages, TRANSFER_BATCH_SIZE);
+
+    storage.clear();
+    storages.push_back(std::move(storage));
+}
@@ -0,0 +1,44 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _BYTEBUFFERPOOL_H
+#define _BYTEBUFFERPOOL_H
+
+#include "Define.h"
+#include <array>
+#include <vector>
+
+/*
+ * Recycles the storage of ByteBuffers (and so WorldPackets) in a few size classes.
+ *
+ * Every thread keeps a small cache per size class; it exchanges batches with a shared depot
+ * when it runs empty or full, since packets are usually built on one thread (map, world or
+ * network) and destroyed on another. Storage larger than the biggest class is never pooled.
+ */
+class AC_SHARED_API ByteBufferPool
+{
+public:
+    static constexpr std::array<std::size_t, 4> SizeClasses = { 0x100, 0x400, 0x1000, 0x4000 };
+
+    // Empty storage with a capacity of at least reserve bytes
+    static std::vector<uint8> Acquire(std::size_t reserve);
+
+    // Keeps the allocation of storage for a later Acquire, when its capacity fits a size class
+    static void Release(std::vector<uint8>&& storage);
+};
+
+#endif
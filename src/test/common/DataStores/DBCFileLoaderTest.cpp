@@ -0,0 +1,122 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "DBCFileLoader.h"
+#include "gtest/gtest.h"
+#include <boost/filesystem.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace
+{
+    // "xnif": unused field, index, int, float
+    std::string WriteDBC(std::vector<std::vector<uint32>> const& rows)
+    {
+        auto path = boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("deleteme-%%%%.dbc");
+
+        uint32 const header[5] = { 0x43424457, uint32(rows.size()), 4, 16, 1 };
+        std::ofstream stream(path.string(), std::ios::binary);
+        stream.write(reinterpret_cast<char const*>(header), sizeof(header));
+        for (std::vector<uint32> const& row : rows)
+            stream.write(reinterpret_cast<char const*>(row.data()), row.size() * sizeof(uint32));
+
+        stream.put('\0');
+        return path.string();
+    }
+
+    uint32 FloatBits(float value)
+    {
+        uint32 bits;
+        memcpy(&bits, &value, sizeof(bits));
+        return bits;
+    }
+}
+
+TEST(DBCFileLoaderTest, MappableFormats)
+{
+    EXPECT_TRUE(DBCFileLoader::IsMappableFormat("niii"));
+    EXPECT_TRUE(DBCFileLoader::IsMappableFormat("df"));
+    EXPECT_TRUE(DBCFileLoader::IsMappableFormat("xnifxx"));
+    EXPECT_FALSE(DBCFileLoader::IsMappableFormat("nixi"));
+    EXPECT_FALSE(DBCFileLoader::IsMappableFormat("nis"));
+    EXPECT_FALSE(DBCFileLoader::IsMappableFormat("nb"));
+    EXPECT_FALSE(DBCFileLoader::IsMappableFormat("xx"));
+}
+
+TEST(DBCFileLoaderTest, MappedRecordsMatchProducedRecords)
+{
+    struct Entry
+    {
+        uint32 ID;
+        uint32 Value;
+        float Multiplier;
+    };
+
+    std::string path = WriteDBC({ { 99, 5, 10, FloatBits(0.5f) }, { 99, 2, 20, FloatBits(1.5f) } });
+    char const* format = "xnif";
+
+    DBCFileLoader produced;
+    ASSERT_TRUE(produced.Load(path.c_str(), format));
+
+    uint32 producedCount = 0;
+    char** producedIndex = nullptr;
+    char* dataTable = produced.AutoProduceData(format, producedCount, producedIndex);
+
+    DBCFileLoader mapped;
+    ASSERT_TRUE(mapped.Load(path.c_str(), format));
+
+    uint32 mappedCount = 0;
+    char** mappedIndex = nullptr;
+    ASSERT_TRUE(mapped.AutoProduceMappedData(format, mappedCount, mappedIndex));
+    std::unique_ptr<DBCFileLoader::FileImage> image = mapped.ReleaseFileImage();
+    ASSERT_TRUE(image);
+
+    ASSERT_EQ(mappedCount, producedCount);
+    EXPECT_EQ(mappedCount, 6u);
+
+    for (uint32 id = 0; id < mappedCount; ++id)
+    {
+        Entry const* left = reinterpret_cast<Entry const*>(mappedIndex[id]);
+        Entry const* right = reinterpret_cast<Entry const*>(producedIndex[id]);
+        ASSERT_EQ(left == nullptr, right == nullptr);
+        if (!left)
+            continue;
+
+        EXPECT_EQ(left->ID, right->ID);
+        EXPECT_EQ(left->Value, right->Value);
+        EXPECT_EQ(left->Multiplier, right->Multiplier);
+    }
+
+    EXPECT_EQ(reinterpret_cast<Entry const*>(mappedIndex[2])->Value, 20u);
+
+    delete[] dataTable;
+    delete[] producedIndex;
+    delete[] mappedIndex;
+    image.reset();
+    std::remove(path.c_str());
+}
+
+TEST(DBCFileLoaderTest, MissingFile)
+{
+    DBCFileLoader dbc;
+    EXPECT_FALSE(dbc.Load("this-file-does-not-exist.dbc", "ni"));
+    EXPECT_FALSE(dbc.IsLoaded());
+}
@@ -0,0 +1,227 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "ConcurrentPointerMap.h"
+#include "gtest/gtest.h"
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <shared_mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+using namespace Acore;
+
+namespace
+{
+    struct Dummy
+    {
+        uint64 Key = 0;
+    };
+}
+
+TEST(ConcurrentPointerMapTest, InsertFindRemove)
+{
+    ConcurrentPointerMap<Dummy> map;
+    std::vector<Dummy> objects(1000);
+
+    // Enough entries to rebuild the table a few times
+    for (uint64 i = 0; i < objects.size(); ++i)
+        map.Insert(i + 1, &objects[i]);
+
+    EXPECT_EQ(map.Size(), 1000u);
+    for (uint64 i = 0; i < objects.size(); ++i)
+        EXPECT_EQ(map.Find(i + 1), &objects[i]);
+
+    EXPECT_EQ(map.Find(5000), nullptr);
+
+    for (uint64 i = 0; i < objects.size(); i += 2)
+        map.Remove(i + 1);
+
+    map.Remove(5000);
+    EXPECT_EQ(map.Size(), 500u);
+
+    for (uint64 i = 0; i < objects.size(); ++i)
+        EXPECT_EQ(map.Find(i + 1), (i % 2) ? &objects[i] : nullptr);
+
+    // Removed keys can come back, replaced values are returned from then on
+    map.Insert(1, &objects[1]);
+    map.Insert(2, &objects[0]);
+    EXPECT_EQ(map.Find(1), &objects[1]);
+    EXPECT_EQ(map.Find(2), &objects[0]);
+    EXPECT_EQ(map.Size(), 501u);
+
+    EpochReclaimer::Advance();
+    EXPECT_EQ(EpochReclaimer::GetRetiredCount(), 0u);
+}
+
+TEST(ConcurrentPointerMapTest, ChurnKeepsTableSmall)
+{
+    ConcurrentPointerMap<Dummy> map;
+    Dummy object;
+
+    // Logins and logouts of a small population, removed entries must not pile up
+    for (uint64 i = 1; i <= 100000; ++i)
+    {
+        map.Insert(i, &object);
+        if (i > 10)
+            map.Remove(i - 10);
+    }
+
+    EXPECT_EQ(map.Size(), 10u);
+    for (uint64 i = 100000 - 9; i <= 100000; ++i)
+        EXPECT_EQ(map.Find(i), &object);
+
+    EXPECT_EQ(map.Find(100000 - 10), nullptr);
+    EpochReclaimer::Advance();
+}
+
+TEST(ConcurrentPointerMapTest, ReadersDuringRebuild)
+{
+    ConcurrentPointerMap<Dummy> map;
+    std::vector<Dummy> objects(20000);
+    for (uint64 i = 0; i < objects.size(); ++i)
+        objects[i].Key = i + 1;
+
+    // The first keys stay in the map the whole time
+    for (uint64 i = 0; i < 100; ++i)
+        map.Insert(i + 1, &objects[i]);
+
+    std::atomic<bool> stop = false;
+    std::atomic<uint32> errors = 0;
+    std::vector<std::thread> readers;
+    for (uint32 t = 0; t < 4; ++t)
+    {
+        readers.emplace_back([&]()
+        {
+            while (!stop)
+            {
+                for (uint64 key = 1; key <= objects.size(); key += 7)
+                {
+                    Dummy const* object = map.Find(key);
+                    if ((key <= 100 && !object) || (object && object->Key != key))
+                        ++errors;
+                }
+            }
+        });
+    }
+
+    // Writer grows, shrinks and retires tables while the readers probe them
+    for (uint32 round = 0; round < 5; ++round)
+    {
+        for (uint64 i = 100; i < objects.size(); ++i)
+            map.Insert(i + 1, &objects[i]);
+
+        EpochReclaimer::Advance();
+
+        for (uint64 i = 100; i < objects.size(); ++i)
+            map.Remove(i + 1);
+
+        EpochReclaimer::Advance();
+    }
+
+    stop = true;
+    for (std::thread& reader : readers)
+        reader.join();
+
+    EXPECT_EQ(errors, 0u);
+    EXPECT_EQ(map.Size(), 100u);
+
+    EpochReclaimer::Advance();
+    EXPECT_EQ(EpochReclaimer::GetRetiredCount(), 0u);
+}
+
+namespace
+{
+    // Map threads looking up online players, a login or logout every few thousand lookups
+    template<class Lookup, class Update>
+    std::chrono::nanoseconds RunLookups(uint32 threads, Lookup lookup, Update update)
+    {
+        std::atomic<bool> start = false;
+        std::atomic<uint64> found = 0;
+        std::vector<std::thread> workers;
+        for (uint32 t = 0; t < threads; ++t)
+        {
+            workers.emplace_back([&, t]()
+            {
+                while (!start) { }
+
+                uint64 hits = 0;
+                for (uint64 i = 0; i < 2000000; ++i)
+                    if (lookup((i * 7 + t) % 4000 + 1))
+                        ++hits;
+
+                found += hits;
+            });
+        }
+
+        auto const begin = std::chrono::steady_clock::now();
+        start = true;
+        for (uint64 i = 0; i < 200; ++i)
+            update(i);
+
+        for (std::thread& worker : workers)
+            worker.join();
+
+        return std::chrono::steady_clock::now() - begin;
+    }
+}
+
+// Not a correctness test, run with --gtest_also_run_disabled_tests to compare the lookups
+TEST(ConcurrentPointerMapTest, DISABLED_ContentionBenchmark)
+{
+    std::vector<Dummy> objects(4000);
+
+    for (uint32 threads : { 1, 2, 4, 8 })
+    {
+        std::unordered_map<uint64, Dummy*> locked;
+        std::shared_mutex lock;
+        ConcurrentPointerMap<Dummy> concurrent;
+        for (uint64 i = 0; i < objects.size(); ++i)
+        {
+            locked[i + 1] = &objects[i];
+            concurrent.Insert(i + 1, &objects[i]);
+        }
+
+        std::chrono::nanoseconds const lockedTime = RunLookups(threads, [&](uint64 key)
+        {
+            std::shared_lock<std::shared_mutex> guard(lock);
+            auto itr = locked.find(key);
+            return itr != locked.end() ? itr->second : nullptr;
+        }, [&](uint64 i)
+        {
+            std::unique_lock<std::shared_mutex> guard(lock);
+            locked.erase(i % 4000 + 1);
+            locked[i % 4000 + 1] = &objects[i % 4000];
+        });
+
+        std::chrono::nanoseconds const concurrentTime = RunLookups(threads, [&](uint64 key)
+        {
+            return concurrent.Find(key);
+        }, [&](uint64 i)
+        {
+            concurrent.Remove(i % 4000 + 1);
+            concurrent.Insert(i % 4000 + 1, &objects[i % 4000]);
+        });
+
+        EpochReclaimer::Advance();
+
+        std::printf("%u threads: shared_mutex %8.2f ms, ConcurrentPointerMap %8.2f ms\n", threads,
+            lockedTime.count() / 1000000.0, concurrentTime.count() / 1000000.0);
+    }
+}
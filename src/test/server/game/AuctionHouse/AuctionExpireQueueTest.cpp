@@ -0,0 +1,182 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "AuctionHouseMgr.h"
+#include "gtest/gtest.h"
+#include <memory>
+
+namespace
+{
+    constexpr time_t Now = 1000000;
+
+    // Auctions and expire queue of a house, without the searcher, scripts and database of AuctionHouseObject
+    struct TestHouse
+    {
+        AuctionEntry* Add(uint32 id, time_t expireTime)
+        {
+            std::unique_ptr<AuctionEntry>& auction = Owned.emplace_back(std::make_unique<AuctionEntry>());
+            auction->Id = id;
+            auction->expire_time = expireTime;
+            Auctions[id] = auction.get();
+            Queue.Add(auction.get());
+            return auction.get();
+        }
+
+        // cancelled or bought out, the queue entry stays behind
+        void Remove(uint32 id)
+        {
+            Auctions.erase(id);
+        }
+
+        AuctionEntry* PopExpiredAuction(time_t checkTime)
+        {
+            return Queue.PopExpired(Auctions, checkTime);
+        }
+
+        AuctionExpireQueue Queue;
+        AuctionExpireQueue::AuctionEntryMap Auctions;
+        std::vector<std::unique_ptr<AuctionEntry>> Owned;
+    };
+
+    uint32 PopId(TestHouse& house, time_t checkTime)
+    {
+        AuctionEntry* auction = house.PopExpiredAuction(checkTime);
+        return auction ? auction->Id : 0;
+    }
+
+    struct ExpiredAuction
+    {
+        TestHouse* House;
+        uint32 Id;
+
+        bool operator==(ExpiredAuction const& right) const { return House == right.House && Id == right.Id; }
+    };
+
+    std::ostream& operator<<(std::ostream& stream, ExpiredAuction const& expired)
+    {
+        return stream << expired.Id;
+    }
+
+    // Expires like AuctionHouseMgr::UpdateExpiredAuctions, the auction is removed from its house
+    bool ExpireAuctions(std::array<TestHouse*, 3> const& houses, TimePoint deadline, std::vector<ExpiredAuction>& expired)
+    {
+        return AuctionHouseMgr::ExpireAuctions(houses, Now, deadline, [&expired](TestHouse* house, AuctionEntry* auction)
+        {
+            expired.push_back({ house, auction->Id });
+            house->Remove(auction->Id);
+        });
+    }
+}
+
+TEST(AuctionExpireQueueTest, PopsDueAuctionsInExpireOrder)
+{
+    TestHouse house;
+    house.Add(1, Now - 10);
+    house.Add(2, Now - 30);
+    house.Add(3, Now);
+    house.Add(4, Now + 1);
+
+    EXPECT_EQ(PopId(house, Now), 2u);
+    EXPECT_EQ(PopId(house, Now), 1u);
+    EXPECT_EQ(PopId(house, Now), 3u);
+    EXPECT_EQ(PopId(house, Now), 0u);
+
+    // not due yet, kept for a later check
+    EXPECT_EQ(house.Queue.GetSize(), 1u);
+    EXPECT_EQ(PopId(house, Now + 1), 4u);
+    EXPECT_EQ(house.Queue.GetSize(), 0u);
+}
+
+TEST(AuctionExpireQueueTest, DropsEntriesOfRemovedAuctions)
+{
+    TestHouse house;
+    house.Add(1, Now - 20);
+    house.Add(2, Now - 10);
+    house.Add(3, Now + 10);
+    house.Remove(1);
+    house.Remove(3);
+
+    EXPECT_EQ(PopId(house, Now), 2u);
+    EXPECT_EQ(PopId(house, Now), 0u);
+
+    // the entry of the removed auction that is not due yet waits for its time
+    EXPECT_EQ(house.Queue.GetSize(), 1u);
+    EXPECT_EQ(PopId(house, Now + 10), 0u);
+    EXPECT_EQ(house.Queue.GetSize(), 0u);
+}
+
+TEST(AuctionExpireQueueTest, RequeuesAuctionsWhoseExpireTimeChanged)
+{
+    TestHouse house;
+    AuctionEntry* extended = house.Add(1, Now - 10);
+    house.Add(2, Now - 5);
+    extended->expire_time = Now + 100;
+
+    EXPECT_EQ(PopId(house, Now), 2u);
+    EXPECT_EQ(PopId(house, Now), 0u);
+    EXPECT_EQ(house.Queue.GetSize(), 1u);
+
+    EXPECT_EQ(PopId(house, Now + 99), 0u);
+    EXPECT_EQ(PopId(house, Now + 100), 1u);
+}
+
+TEST(AuctionExpireQueueTest, ExpiresOneAuctionPerHouseAtATime)
+{
+    TestHouse horde, alliance, neutral;
+    horde.Add(1, Now - 3);
+    horde.Add(2, Now - 2);
+    horde.Add(3, Now - 1);
+    alliance.Add(4, Now - 1);
+    alliance.Add(5, Now + 60);
+    neutral.Add(6, Now - 2);
+    neutral.Add(7, Now - 1);
+
+    std::vector<ExpiredAuction> expired;
+    EXPECT_TRUE(ExpireAuctions({ &horde, &alliance, &neutral }, TimePoint::max(), expired));
+
+    std::vector<ExpiredAuction> const expected = { { &horde, 1 }, { &alliance, 4 }, { &neutral, 6 }, { &horde, 2 }, { &neutral, 7 }, { &horde, 3 } };
+    EXPECT_EQ(expired, expected);
+    EXPECT_EQ(alliance.Auctions.size(), 1u);
+}
+
+TEST(AuctionExpireQueueTest, StopsAtTheDeadline)
+{
+    TestHouse horde, alliance, neutral;
+    for (uint32 id = 1; id <= 6; ++id)
+        (id % 2 ? horde : neutral).Add(id, Now - 10 + id);
+
+    // a deadline that already passed still lets one auction per house through
+    std::vector<ExpiredAuction> expired;
+    EXPECT_FALSE(ExpireAuctions({ &horde, &alliance, &neutral }, std::chrono::steady_clock::now() - Seconds(1), expired));
+    EXPECT_EQ(expired, (std::vector<ExpiredAuction>{ { &horde, 1 }, { &neutral, 2 } }));
+
+    // the next update goes on with the oldest left
+    expired.clear();
+    EXPECT_TRUE(ExpireAuctions({ &horde, &alliance, &neutral }, TimePoint::max(), expired));
+    EXPECT_EQ(expired, (std::vector<ExpiredAuction>{ { &horde, 3 }, { &neutral, 4 }, { &horde, 5 }, { &neutral, 6 } }));
+}
+
+TEST(AuctionExpireQueueTest, NothingDue)
+{
+    TestHouse horde, alliance, neutral;
+    horde.Add(1, Now + 1);
+
+    std::vector<ExpiredAuction> expired;
+    EXPECT_TRUE(ExpireAuctions({ &horde, &alliance, &neutral }, TimePoint::max(), expired));
+    EXPECT_TRUE(expired.empty());
+}
@@ -0,0 +1,253 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "BattlegroundQueue.h"
+#include "gtest/gtest.h"
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <list>
+#include <map>
+#include <memory>
+#include <random>
+#include <unordered_map>
+
+namespace
+{
+    constexpr uint32 MaxRatingDifference = 150;
+    constexpr int32 RatingDiscardTime = 10 * MINUTE * IN_MILLISECONDS;
+    constexpr int32 OpponentsDiscardTime = 2 * MINUTE * IN_MILLISECONDS;
+
+    // Queue list and its index kept the way BattlegroundQueue keeps them. Invited teams stay in
+    // the list until they enter the arena, but leave the index.
+    struct RatedQueue
+    {
+        std::list<GroupQueueInfo*> Groups;
+        ArenaQueueIndex Index;
+        std::vector<std::unique_ptr<GroupQueueInfo>> Storage;
+        std::unordered_map<GroupQueueInfo const*, std::list<GroupQueueInfo*>::iterator> Waiting;
+        std::multimap<uint32, std::list<GroupQueueInfo*>::iterator> Invited;
+
+        GroupQueueInfo* Join(uint32 rating, uint32 arenaTeamId, uint32 previousOpponent, uint32 now)
+        {
+            Storage.push_back(std::make_unique<GroupQueueInfo>());
+            GroupQueueInfo* ginfo = Storage.back().get();
+            ginfo->ArenaMatchmakerRating = rating;
+            ginfo->ArenaTeamId = arenaTeamId;
+            ginfo->PreviousOpponentsTeamId = previousOpponent;
+            ginfo->JoinTime = now;
+            ginfo->IsInvitedToBGInstanceGUID = 0;
+
+            Groups.push_back(ginfo);
+            Index.Add(ginfo, std::prev(Groups.end()));
+            Waiting.emplace(ginfo, std::prev(Groups.end()));
+            return ginfo;
+        }
+
+        void Leave(GroupQueueInfo* ginfo)
+        {
+            auto itr = Waiting.find(ginfo);
+            if (itr == Waiting.end())
+                return;
+
+            Index.Remove(ginfo);
+            Groups.erase(itr->second);
+            Waiting.erase(itr);
+        }
+
+        void Invite(GroupQueueInfo* ginfo, uint32 enterTime)
+        {
+            auto itr = Waiting.find(ginfo);
+            ginfo->IsInvitedToBGInstanceGUID = 1;
+            Index.Remove(ginfo);
+            Invited.emplace(enterTime, itr->second);
+            Waiting.erase(itr);
+        }
+
+        void EnterArenas(uint32 now)
+        {
+            for (auto itr = Invited.begin(); itr != Invited.end() && itr->first <= now; itr = Invited.erase(itr))
+                Groups.erase(itr->second);
+        }
+    };
+
+    bool InRange(GroupQueueInfo const* ginfo, uint32 minRating, uint32 maxRating, int32 discardTime)
+    {
+        return (ginfo->ArenaMatchmakerRating >= minRating && ginfo->ArenaMatchmakerRating <= maxRating) || (int32)ginfo->JoinTime < discardTime;
+    }
+
+    // The former walk of BattlegroundQueueUpdate over the queue list
+    GroupQueueInfo* LinearFindFirst(std::list<GroupQueueInfo*> const& groups, uint32 minRating, uint32 maxRating, int32 discardTime, GroupQueueInfo const* firstTeam, int32 discardOpponentsTime)
+    {
+        for (GroupQueueInfo* ginfo : groups)
+        {
+            if (ginfo->IsInvitedToBGInstanceGUID || !InRange(ginfo, minRating, maxRating, discardTime))
+                continue;
+
+            if (firstTeam && ((firstTeam->ArenaTeamId == ginfo->PreviousOpponentsTeamId && (int32)ginfo->JoinTime >= discardOpponentsTime) || firstTeam->ArenaTeamId == ginfo->ArenaTeamId))
+                continue;
+
+            return ginfo;
+        }
+
+        return nullptr;
+    }
+
+    GroupQueueInfo* IndexFindFirst(RatedQueue& queue, uint32 minRating, uint32 maxRating, int32 discardTime, GroupQueueInfo const* firstTeam, int32 discardOpponentsTime)
+    {
+        ArenaQueueIndex::Filter filter;
+        if (firstTeam)
+        {
+            filter = [firstTeam, discardOpponentsTime](GroupQueueInfo const* ginfo)
+            {
+                return (firstTeam->ArenaTeamId != ginfo->PreviousOpponentsTeamId || (int32)ginfo->JoinTime < discardOpponentsTime)
+                    && firstTeam->ArenaTeamId != ginfo->ArenaTeamId;
+            };
+        }
+
+        ArenaQueueIndex::QueueIterator result;
+        return queue.Index.FindFirst(minRating, maxRating, discardTime, filter, result) ? *result : nullptr;
+    }
+
+    typedef std::function<void(uint32, uint32, int32, GroupQueueInfo const*, int32)> CheckFunction;
+
+    // One BattlegroundQueueUpdate of a rated arena queue: the first team in range, then its opponent
+    template<class Find>
+    bool MatchTeams(RatedQueue& queue, uint32 arenaRating, uint32 now, uint32 enterTime, Find&& find, CheckFunction const& check)
+    {
+        uint32 const minRating = arenaRating <= MaxRatingDifference ? 0 : arenaRating - MaxRatingDifference;
+        uint32 const maxRating = arenaRating + MaxRatingDifference;
+        int32 const discardTime = int32(now) - RatingDiscardTime;
+        int32 const discardOpponentsTime = int32(now) - OpponentsDiscardTime;
+
+        if (check)
+            check(minRating, maxRating, discardTime, nullptr, discardOpponentsTime);
+
+        GroupQueueInfo* first = find(queue, minRating, maxRating, discardTime, nullptr, discardOpponentsTime);
+        if (!first)
+            return false;
+
+        if (check)
+            check(minRating, maxRating, discardTime, first, discardOpponentsTime);
+
+        GroupQueueInfo* second = find(queue, minRating, maxRating, discardTime, first, discardOpponentsTime);
+        if (!second)
+            return false;
+
+        queue.Invite(first, enterTime);
+        queue.Invite(second, enterTime);
+        return true;
+    }
+
+    // A day of a rated queue with an evening peak: every join schedules an update with the rating of the team,
+    // like BattlegroundMgr does, next to the periodic update. Invited teams take a while to enter the arena
+    // and some teams give up waiting.
+    template<class Find>
+    uint32 ReplayDay(RatedQueue& queue, uint32 seed, float peakJoinsPerSecond, Find&& find, CheckFunction const& check = nullptr)
+    {
+        std::mt19937 random(seed);
+        std::normal_distribution<float> rating(1500.0f, 400.0f);
+        uint32 matches = 0;
+        uint32 nextTeamId = 0;
+
+        for (uint32 now = 0; now < DAY * IN_MILLISECONDS; now += IN_MILLISECONDS)
+        {
+            float const hour = float(now) / (HOUR * IN_MILLISECONDS);
+            float const joinsPerSecond = peakJoinsPerSecond * (0.1f + 0.9f * std::max(0.0f, std::sin((hour - 12.0f) / 12.0f * float(M_PI))));
+
+            queue.EnterArenas(now);
+
+            for (uint32 joins = std::poisson_distribution<uint32>(joinsPerSecond)(random); joins > 0; --joins)
+            {
+                uint32 const previousOpponent = random() % 2 ? random() % (nextTeamId + 1) : 0;
+                GroupQueueInfo* ginfo = queue.Join(uint32(std::max(0.0f, rating(random))), ++nextTeamId, previousOpponent, now);
+                if (MatchTeams(queue, ginfo->ArenaMatchmakerRating, now, now + (5 + random() % 80) * IN_MILLISECONDS, find, check))
+                    ++matches;
+            }
+
+            if (!queue.Storage.empty() && !(random() % 10))
+                queue.Leave(queue.Storage[queue.Storage.size() - 1 - random() % std::min<std::size_t>(queue.Storage.size(), 500)].get());
+
+            if (!(now % (5 * IN_MILLISECONDS)) && MatchTeams(queue, 0, now, now + (5 + random() % 80) * IN_MILLISECONDS, find, check))
+                ++matches;
+        }
+
+        return matches;
+    }
+}
+
+TEST(ArenaQueueIndexTest, SameTeamsAsLinearWalk)
+{
+    RatedQueue queue;
+    uint32 queries = 0;
+
+    auto check = [&queue, &queries](uint32 minRating, uint32 maxRating, int32 discardTime, GroupQueueInfo const* firstTeam, int32 discardOpponentsTime)
+    {
+        ++queries;
+        ASSERT_EQ(IndexFindFirst(queue, minRating, maxRating, discardTime, firstTeam, discardOpponentsTime),
+            LinearFindFirst(queue.Groups, minRating, maxRating, discardTime, firstTeam, discardOpponentsTime));
+    };
+
+    uint32 const matches = ReplayDay(queue, 1, 2.0f, IndexFindFirst, check);
+    EXPECT_GT(matches, 0u);
+    EXPECT_GT(queries, matches);
+    EXPECT_EQ(queue.Index.Size(), queue.Waiting.size());
+}
+
+TEST(ArenaQueueIndexTest, RatingsAboveLastLeaf)
+{
+    uint32 const lastLeafRating = (ArenaQueueIndex::RATING_LEAVES - 1) * ArenaQueueIndex::RATING_PER_LEAF;
+
+    RatedQueue queue;
+    queue.Join(20000, 1, 0, 1000);
+    queue.Join(lastLeafRating + 10, 2, 0, 2000);
+
+    ArenaQueueIndex::QueueIterator result;
+    ASSERT_TRUE(queue.Index.FindFirst(lastLeafRating, lastLeafRating + 100, 0, nullptr, result));
+    EXPECT_EQ((*result)->ArenaTeamId, 2u);
+
+    // waited long enough, any rating matches
+    ASSERT_TRUE(queue.Index.FindFirst(0, 10, 1500, nullptr, result));
+    EXPECT_EQ((*result)->ArenaTeamId, 1u);
+
+    EXPECT_FALSE(queue.Index.FindFirst(0, 10, 500, nullptr, result));
+    EXPECT_EQ(queue.Index.Size(), 2u);
+}
+
+// Not a correctness test, run with --gtest_also_run_disabled_tests to compare with the former queue walk
+TEST(ArenaQueueIndexTest, DISABLED_DayReplayBenchmark)
+{
+    for (float peakJoinsPerSecond : { 2.0f, 10.0f, 25.0f })
+    {
+        RatedQueue linearQueue, indexedQueue;
+
+        auto const linearStart = std::chrono::steady_clock::now();
+        uint32 const linearMatches = ReplayDay(linearQueue, 2, peakJoinsPerSecond, [](RatedQueue& queue, uint32 minRating, uint32 maxRating, int32 discardTime, GroupQueueInfo const* firstTeam, int32 discardOpponentsTime)
+        {
+            return LinearFindFirst(queue.Groups, minRating, maxRating, discardTime, firstTeam, discardOpponentsTime);
+        });
+        auto const linearTime = std::chrono::steady_clock::now() - linearStart;
+
+        auto const indexedStart = std::chrono::steady_clock::now();
+        uint32 const indexedMatches = ReplayDay(indexedQueue, 2, peakJoinsPerSecond, IndexFindFirst);
+        auto const indexedTime = std::chrono::steady_clock::now() - indexedStart;
+
+        EXPECT_EQ(linearMatches, indexedMatches);
+        std::printf("%4.0f joins/s at peak, %7u matches: queue walk %8.2f ms, rating index %8.2f ms\n", peakJoinsPerSecond, indexedMatches,
+            std::chrono::duration<double, std::milli>(linearTime).count(), std::chrono::duration<double, std::milli>(indexedTime).count());
+    }
+}
@@ -0,0 +1,88 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "BattlegroundMgr.h"
+#include "WorldMock.h"
+#include "gtest/gtest.h"
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+/**
+ * With MapUpdate.PvP battlegrounds end on their map threads at the same time,
+ * every stored battleground must still get its own pvpstats id.
+ */
+class PvPStatsBattlegroundIdTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        previousWorld_ = std::move(sWorld);
+        sWorld.reset(new ::testing::NiceMock<WorldMock>());
+    }
+
+    void TearDown() override
+    {
+        sWorld = std::move(previousWorld_);
+    }
+
+private:
+    std::unique_ptr<IWorld> previousWorld_;
+};
+
+TEST_F(PvPStatsBattlegroundIdTest, IdsFollowEachOther)
+{
+    uint64 const first = sBattlegroundMgr->GeneratePvPStatsBattlegroundId();
+
+    EXPECT_EQ(sBattlegroundMgr->GeneratePvPStatsBattlegroundId(), first + 1);
+    EXPECT_EQ(sBattlegroundMgr->GeneratePvPStatsBattlegroundId(), first + 2);
+}
+
+TEST_F(PvPStatsBattlegroundIdTest, ConcurrentEndsGetUniqueIds)
+{
+    constexpr std::size_t Threads = 8;
+    constexpr std::size_t IdsPerThread = 2000;
+
+    uint64 const first = sBattlegroundMgr->GeneratePvPStatsBattlegroundId();
+
+    std::vector<std::vector<uint64>> ids(Threads);
+    std::vector<std::thread> threads;
+    for (std::size_t i = 0; i < Threads; ++i)
+    {
+        threads.emplace_back([&ids, i]()
+        {
+            for (std::size_t n = 0; n < IdsPerThread; ++n)
+                ids[i].push_back(sBattlegroundMgr->GeneratePvPStatsBattlegroundId());
+        });
+    }
+
+    for (std::thread& thread : threads)
+        thread.join();
+
+    std::vector<uint64> all;
+    for (std::vector<uint64> const& threadIds : ids)
+    {
+        // Each map thread sees its own ids increasing
+        EXPECT_TRUE(std::is_sorted(threadIds.begin(), threadIds.end()));
+        all.insert(all.end(), threadIds.begin(), threadIds.end());
+    }
+
+    std::sort(all.begin(), all.end());
+    ASSERT_EQ(all.size(), Threads * IdsPerThread);
+    for (std::size_t i = 0; i < all.size(); ++i)
+        EXPECT_EQ(all[i], first + 1 + i);
+}
@@ -0,0 +1,308 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "CharacterCacheStore.h"
+#include "gtest/gtest.h"
+#include <boost/filesystem.hpp>
+#include <chrono>
+#include <cstdio>
+#include <map>
+#include <random>
+#include <string>
+#include <unordered_map>
+
+namespace
+{
+    uint32 AddCharacter(CharacterCacheStore& store, uint32 guid, std::string_view name, uint8 level = 80)
+    {
+        return store.Add(guid, name, guid * 10, 1, 0, 1, level);
+    }
+
+    std::vector<std::string> FindNames(CharacterCacheStore const& store, std::string_view prefix, std::size_t limit = 100)
+    {
+        std::vector<uint32> rows;
+        store.FindByNamePrefix(prefix, limit, rows);
+
+        std::vector<std::string> names;
+        for (uint32 row : rows)
+            names.emplace_back(store.GetName(row));
+
+        return names;
+    }
+}
+
+TEST(CharacterCacheStoreTest, AddFindRemove)
+{
+    CharacterCacheStore store;
+    AddCharacter(store, 1, "Arthas");
+    AddCharacter(store, 2, "Jaina");
+    AddCharacter(store, 3, "Thrall");
+
+    uint32 row = store.FindByGuid(2);
+    ASSERT_NE(row, CharacterCacheStore::NO_ROW);
+    EXPECT_EQ(store.GetName(row), "Jaina");
+    EXPECT_EQ(store.GetAccountId(row), 20u);
+
+    EXPECT_EQ(store.FindByName("jAINA"), row);
+    EXPECT_EQ(store.FindByName("Jain"), CharacterCacheStore::NO_ROW);
+    EXPECT_EQ(store.FindByGuid(4), CharacterCacheStore::NO_ROW);
+
+    // The last row moves into the removed one and is still found by guid and name
+    store.SetGuildId(store.FindByGuid(3), 7);
+    store.Remove(1);
+    EXPECT_EQ(store.GetSize(), 2u);
+    EXPECT_EQ(store.FindByGuid(1), CharacterCacheStore::NO_ROW);
+    EXPECT_EQ(store.FindByName("Arthas"), CharacterCacheStore::NO_ROW);
+    row = store.FindByName("Thrall");
+    ASSERT_NE(row, CharacterCacheStore::NO_ROW);
+    EXPECT_EQ(store.GetGuid(row), 3u);
+    EXPECT_EQ(store.GetGuildId(row), 7u);
+    EXPECT_EQ(store.FindByGuid(3), row);
+}
+
+TEST(CharacterCacheStoreTest, RenameAndReplace)
+{
+    CharacterCacheStore store;
+    uint32 const row = AddCharacter(store, 5, "Uther");
+    store.SetMailCount(row, 3);
+    store.SetGuildId(row, 9);
+
+    store.Rename(row, "Tirion");
+    EXPECT_EQ(store.FindByName("Uther"), CharacterCacheStore::NO_ROW);
+    EXPECT_EQ(store.FindByName("tirion"), row);
+
+    // Adding the guid again keeps the mail count, the guild is set again by its loading
+    EXPECT_EQ(AddCharacter(store, 5, "Mograine", 70), row);
+    EXPECT_EQ(store.GetSize(), 1u);
+    EXPECT_EQ(store.GetName(row), "Mograine");
+    EXPECT_EQ(store.GetLevel(row), 70);
+    EXPECT_EQ(store.GetMailCount(row), 3);
+    EXPECT_EQ(store.GetGuildId(row), 0u);
+    EXPECT_EQ(store.FindByName("Tirion"), CharacterCacheStore::NO_ROW);
+}
+
+TEST(CharacterCacheStoreTest, NamePrefix)
+{
+    CharacterCacheStore store;
+    store.BeginBulkLoad(6);
+    AddCharacter(store, 1, "Malfurion");
+    AddCharacter(store, 2, "Maiev");
+    AddCharacter(store, 3, "Magni");
+    AddCharacter(store, 4, "Medivh");
+    AddCharacter(store, 5, "malygos");
+    AddCharacter(store, 20000000, "Mannoroth");
+    store.EndBulkLoad();
+
+    EXPECT_EQ(FindNames(store, "ma"), std::vector<std::string>({ "Magni", "Maiev", "Malfurion", "malygos", "Mannoroth" }));
+    EXPECT_EQ(FindNames(store, "MAL"), std::vector<std::string>({ "Malfurion", "malygos" }));
+    EXPECT_EQ(FindNames(store, "Ma", 2), std::vector<std::string>({ "Magni", "Maiev" }));
+    EXPECT_TRUE(FindNames(store, "Mx").empty());
+    EXPECT_EQ(FindNames(store, "").size(), 6u);
+
+    // Guids too far apart for the dense array
+    EXPECT_EQ(store.GetGuid(store.FindByName("Mannoroth")), 20000000u);
+    store.Remove(20000000);
+    EXPECT_EQ(store.FindByGuid(20000000), CharacterCacheStore::NO_ROW);
+}
+
+TEST(CharacterCacheStoreTest, RandomOperations)
+{
+    CharacterCacheStore store;
+    std::map<uint32, std::string> reference;
+
+    std::mt19937 random(3);
+    for (uint32 i = 0; i < 20000; ++i)
+    {
+        uint32 const guid = random() % 500 + 1;
+        switch (random() % 3)
+        {
+            case 0:
+                reference[guid] = "Name" + std::to_string(random() % 2000);
+                AddCharacter(store, guid, reference[guid]);
+                break;
+            case 1:
+                reference.erase(guid);
+                store.Remove(guid);
+                break;
+            default:
+                if (reference.count(guid))
+                {
+                    reference[guid] = "Other" + std::to_string(random() % 2000);
+                    store.Rename(store.FindByGuid(guid), reference[guid]);
+                }
+                break;
+        }
+    }
+
+    ASSERT_EQ(store.GetSize(), reference.size());
+    for (auto const& [guid, name] : reference)
+    {
+        uint32 const row = store.FindByGuid(guid);
+        ASSERT_NE(row, CharacterCacheStore::NO_ROW);
+        EXPECT_EQ(store.GetName(row), name);
+        EXPECT_EQ(store.GetName(store.FindByName(name)), name);
+    }
+
+    EXPECT_EQ(FindNames(store, "", reference.size() + 1).size(), reference.size());
+}
+
+TEST(CharacterCacheStoreTest, Snapshot)
+{
+    std::string const fileName = (boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("deleteme-%%%%.cache")).string();
+
+    CharacterCacheStore store;
+    for (uint32 guid = 1; guid <= 1000; ++guid)
+        AddCharacter(store, guid, "Name" + std::to_string(guid), uint8(guid % 80 + 1));
+
+    store.Remove(500);
+    store.Rename(store.FindByGuid(10), "Renamed");
+    ASSERT_TRUE(store.SaveSnapshot(fileName, "1000:1000:42"));
+
+    CharacterCacheStore loaded;
+    EXPECT_FALSE(loaded.LoadSnapshot(fileName, "1000:1000:43"));
+    ASSERT_TRUE(loaded.LoadSnapshot(fileName, "1000:1000:42"));
+    EXPECT_EQ(loaded.GetSize(), 999u);
+    EXPECT_EQ(loaded.FindByGuid(500), CharacterCacheStore::NO_ROW);
+    EXPECT_EQ(loaded.GetGuid(loaded.FindByName("renamed")), 10u);
+
+    for (uint32 guid = 1; guid <= 1000; ++guid)
+    {
+        uint32 const row = store.FindByGuid(guid);
+        if (row == CharacterCacheStore::NO_ROW)
+            continue;
+
+        uint32 const loadedRow = loaded.FindByGuid(guid);
+        ASSERT_NE(loadedRow, CharacterCacheStore::NO_ROW);
+        EXPECT_EQ(loaded.GetName(loadedRow), store.GetName(row));
+        EXPECT_EQ(loaded.GetAccountId(loadedRow), store.GetAccountId(row));
+        EXPECT_EQ(loaded.GetLevel(loadedRow), store.GetLevel(row));
+    }
+
+    std::remove(fileName.c_str());
+}
+
+TEST(CharacterCacheStoreTest, Fingerprint)
+{
+    CharacterCacheStore store;
+    EXPECT_EQ(store.GetFingerprint(), "0:0:0");
+
+    // CRC32('1:Abc:10:1:0:1:80') and CRC32('7:Bcd:70:1:0:1:60') as computed by MySQL
+    AddCharacter(store, 1, "Abc");
+    EXPECT_EQ(store.GetFingerprint(), "1:1:3778989146");
+
+    AddCharacter(store, 7, "Bcd", 60);
+    EXPECT_EQ(store.GetFingerprint(), "2:7:537124242");
+
+    store.Rename(store.FindByGuid(7), "Cde");
+    EXPECT_NE(store.GetFingerprint(), "2:7:537124242");
+
+    store.Remove(7);
+    EXPECT_EQ(store.GetFingerprint(), "1:1:3778989146");
+}
+
+namespace
+{
+    // Counts the bytes allocated by the containers of the previous cache
+    std::size_t AllocatedBytes = 0;
+
+    template<class T>
+    struct CountingAllocator
+    {
+        typedef T value_type;
+
+        CountingAllocator() = default;
+        template<class U> CountingAllocator(CountingAllocator<U> const&) { }
+
+        T* allocate(std::size_t n) { AllocatedBytes += n * sizeof(T); return std::allocator<T>().allocate(n); }
+        void deallocate(T* p, std::size_t n) { AllocatedBytes -= n * sizeof(T); std::allocator<T>().deallocate(p, n); }
+
+        template<class U> bool operator==(CountingAllocator<U> const&) const { return true; }
+        template<class U> bool operator!=(CountingAllocator<U> const&) const { return false; }
+    };
+
+    struct LegacyEntry
+    {
+        uint64 Guid;
+        std::string Name;
+        uint32 AccountId;
+        uint8 Class, Race, Sex, Level;
+        uint16 MailCount;
+        uint32 GuildId;
+        std::array<uint32, 4> ArenaTeamId;
+        uint64 GroupGuid;
+    };
+
+    std::string MakeName(std::mt19937& random)
+    {
+        std::string name(random() % 10 + 3, 'a');
+        for (char& c : name)
+            c = char('a' + random() % 26);
+
+        name[0] = char(name[0] - 'a' + 'A');
+        return name;
+    }
+}
+
+// Not a correctness test, run with --gtest_also_run_disabled_tests to compare with the previous hash maps
+TEST(CharacterCacheStoreTest, DISABLED_LoadBenchmark)
+{
+    uint32 const characters = 2000000;
+
+    std::mt19937 random(11);
+    std::vector<std::string> names(characters);
+    for (std::string& name : names)
+        name = MakeName(random);
+
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    std::size_t legacyBytes = 0;
+    {
+        std::unordered_map<uint64, LegacyEntry, std::hash<uint64>, std::equal_to<uint64>, CountingAllocator<std::pair<uint64 const, LegacyEntry>>> byGuid;
+        std::unordered_map<std::string, LegacyEntry*, std::hash<std::string>, std::equal_to<std::string>, CountingAllocator<std::pair<std::string const, LegacyEntry*>>> byName;
+        for (uint32 i = 0; i < characters; ++i)
+        {
+            LegacyEntry& entry = byGuid[i + 1];
+            entry.Guid = i + 1;
+            entry.Name = names[i];
+            byName[names[i]] = &entry;
+        }
+
+        legacyBytes = AllocatedBytes;
+    }
+    std::chrono::steady_clock::duration const legacyTime = std::chrono::steady_clock::now() - start;
+
+    start = std::chrono::steady_clock::now();
+    CharacterCacheStore store;
+    store.BeginBulkLoad(characters);
+    for (uint32 i = 0; i < characters; ++i)
+        store.Add(i + 1, names[i], i, 1, 0, 1, 80);
+    store.EndBulkLoad();
+    std::chrono::steady_clock::duration const storeTime = std::chrono::steady_clock::now() - start;
+
+    std::string const fileName = (boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("deleteme-%%%%.cache")).string();
+    ASSERT_TRUE(store.SaveSnapshot(fileName, "benchmark"));
+
+    start = std::chrono::steady_clock::now();
+    CharacterCacheStore loaded;
+    ASSERT_TRUE(loaded.LoadSnapshot(fileName, "benchmark"));
+    std::chrono::steady_clock::duration const snapshotTime = std::chrono::steady_clock::now() - start;
+    std::remove(fileName.c_str());
+
+    std::printf("%u characters: hash maps %8.2f ms %7.1f MB, columns %8.2f ms %7.1f MB, snapshot %8.2f ms\n", characters,
+        std::chrono::duration<double, std::milli>(legacyTime).count(), legacyBytes / 1048576.0,
+        std::chrono::duration<double, std::milli>(storeTime).count(), store.GetMemoryUsage() / 1048576.0,
+        std::chrono::duration<double, std::milli>(snapshotTime).count());
+}
@@ -0,0 +1,127 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "WhoListIndex.h"
+#include "gtest/gtest.h"
+#include <algorithm>
+#include <random>
+#include <set>
+
+namespace
+{
+    WhoListPlayerInfo MakeInfo(uint32 counter, uint8 level, uint8 class_, uint8 race, uint32 zoneId)
+    {
+        return WhoListPlayerInfo(ObjectGuid::Create<HighGuid::Player>(counter), TEAM_ALLIANCE, SEC_PLAYER, level, class_, race, zoneId,
+            GENDER_MALE, true, L"name", L"", "Name", "");
+    }
+
+    bool Matches(WhoListPlayerInfo const& info, uint32 levelMin, uint32 levelMax, uint32 raceMask, uint32 classMask, std::vector<uint32> const& zoneIds)
+    {
+        if (info.GetLevel() < levelMin || info.GetLevel() > levelMax)
+            return false;
+
+        if (!(raceMask & (1 << info.GetRace())) || !(classMask & (1 << info.GetClass())))
+            return false;
+
+        return zoneIds.empty() || std::find(zoneIds.begin(), zoneIds.end(), info.GetZoneId()) != zoneIds.end();
+    }
+}
+
+TEST(WhoListIndexTest, PicksSmallestBucket)
+{
+    WhoListIndex index;
+    for (uint32 i = 1; i <= 100; ++i)
+        index.Update(MakeInfo(i, 80, CLASS_WARRIOR, RACE_HUMAN, i <= 3 ? 4395 : 1519));
+
+    std::vector<WhoListPlayerInfo const*> candidates;
+    uint32 const zoneId = 4395;
+    index.GetCandidates(0, STRONG_MAX_LEVEL, 0xFFFFFFFF, 0xFFFFFFFF, &zoneId, 1, candidates);
+    EXPECT_EQ(candidates.size(), 3u);
+
+    // Nobody is in the requested level range, no need to look at anyone
+    candidates.clear();
+    index.GetCandidates(10, 19, 0xFFFFFFFF, 0xFFFFFFFF, nullptr, 0, candidates);
+    EXPECT_TRUE(candidates.empty());
+
+    // Moving to another zone moves the player to the other bucket
+    index.Update(MakeInfo(1, 80, CLASS_WARRIOR, RACE_HUMAN, 1519));
+    index.Remove(ObjectGuid::Create<HighGuid::Player>(2));
+    candidates.clear();
+    index.GetCandidates(0, STRONG_MAX_LEVEL, 0xFFFFFFFF, 0xFFFFFFFF, &zoneId, 1, candidates);
+    ASSERT_EQ(candidates.size(), 1u);
+    EXPECT_EQ(candidates[0]->GetGuid(), ObjectGuid::Create<HighGuid::Player>(3));
+    EXPECT_EQ(index.GetSize(), 99u);
+}
+
+TEST(WhoListIndexTest, RandomQueries)
+{
+    WhoListIndex index;
+    std::mt19937 random(11);
+
+    auto randomInfo = [&random](uint32 counter)
+    {
+        return MakeInfo(counter, random() % 80 + 1, random() % 11 + 1, random() % 11 + 1, random() % 20);
+    };
+
+    std::vector<WhoListPlayerInfo> reference;
+    for (uint32 i = 1; i <= 2000; ++i)
+    {
+        reference.push_back(randomInfo(i));
+        index.Update(reference.back());
+    }
+
+    for (uint32 query = 0; query < 500; ++query)
+    {
+        // Players logging in, out, leveling and changing zones in between
+        for (uint32 i = 0; i < 50; ++i)
+        {
+            uint32 const slot = random() % reference.size();
+            if (random() % 4)
+            {
+                reference[slot] = randomInfo(reference[slot].GetGuid().GetCounter());
+                index.Update(reference[slot]);
+            }
+            else
+            {
+                index.Remove(reference[slot].GetGuid());
+                reference[slot] = randomInfo(reference[slot].GetGuid().GetCounter() + 2000);
+                index.Update(reference[slot]);
+            }
+        }
+
+        uint32 const levelMin = random() % 80;
+        uint32 const levelMax = levelMin + random() % 40;
+        uint32 const raceMask = random() % 3 ? 0xFFFFFFFF : uint32(random());
+        uint32 const classMask = random() % 3 ? 0xFFFFFFFF : uint32(random());
+        std::vector<uint32> zoneIds;
+        for (uint32 i = random() % 4; i > 0; --i)
+            zoneIds.push_back(random() % 20);
+
+        std::vector<WhoListPlayerInfo const*> candidates;
+        index.GetCandidates(levelMin, levelMax, raceMask, classMask, zoneIds.data(), zoneIds.size(), candidates);
+
+        std::set<ObjectGuid> seen;
+        for (WhoListPlayerInfo const* candidate : candidates)
+            ASSERT_TRUE(seen.insert(candidate->GetGuid()).second);
+
+        for (WhoListPlayerInfo const& info : reference)
+            if (Matches(info, levelMin, levelMax, raceMask, classMask, zoneIds))
+                ASSERT_TRUE(seen.count(info.GetGuid()));
+    }
+
+    EXPECT_EQ(index.GetSize(), reference.size());
+}
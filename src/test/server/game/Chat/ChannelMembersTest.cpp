@@ -0,0 +1,186 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "ChannelMembers.h"
+#include "gtest/gtest.h"
+#include <algorithm>
+
+namespace
+{
+    ObjectGuid PlayerGuid(uint32 counter)
+    {
+        return ObjectGuid::Create<HighGuid::Player>(counter);
+    }
+
+    // The members never dereference their player, the receivers are told apart by their guid
+    std::vector<uint32> Receivers(ChannelMembers const& members, ObjectGuid sender)
+    {
+        std::vector<uint32> receivers;
+        members.ForEachReceiver(sender, [&receivers](ChannelMembers::Member const& member)
+        {
+            receivers.push_back(member.Guid.GetCounter());
+        });
+
+        std::sort(receivers.begin(), receivers.end());
+        return receivers;
+    }
+
+    void Join(ChannelMembers& members, uint32 counter, GuidVector const& ignores = {})
+    {
+        members.Add(PlayerGuid(counter), nullptr, ignores);
+    }
+}
+
+TEST(ChannelMembersTest, EveryoneReceivesASenderNobodyIgnores)
+{
+    ChannelMembers members;
+    Join(members, 1);
+    Join(members, 2, { PlayerGuid(3) });
+    Join(members, 3);
+
+    EXPECT_EQ(Receivers(members, PlayerGuid(1)), (std::vector<uint32>{ 1, 2, 3 }));
+    EXPECT_EQ(Receivers(members, ObjectGuid::Empty), (std::vector<uint32>{ 1, 2, 3 }));
+    EXPECT_EQ(Receivers(members, PlayerGuid(3)), (std::vector<uint32>{ 1, 3 }));
+}
+
+// Leaving and being kicked both remove the member, the last member moves into the free slot
+TEST(ChannelMembersTest, RemovingAMiddleMemberKeepsTheIgnoresOfTheMovedOne)
+{
+    ChannelMembers members;
+    Join(members, 1);
+    Join(members, 2, { PlayerGuid(5) });
+    Join(members, 3);
+    Join(members, 4, { PlayerGuid(1), PlayerGuid(5) });
+
+    members.Remove(PlayerGuid(2));
+
+    EXPECT_EQ(members.GetSize(), 3u);
+    EXPECT_TRUE(members.IsIgnoring(PlayerGuid(4), PlayerGuid(1)));
+    EXPECT_TRUE(members.IsIgnoring(PlayerGuid(4), PlayerGuid(5)));
+    EXPECT_FALSE(members.IsIgnoring(PlayerGuid(3), PlayerGuid(1)));
+    EXPECT_EQ(Receivers(members, PlayerGuid(1)), (std::vector<uint32>{ 1, 3 }));
+    EXPECT_EQ(Receivers(members, PlayerGuid(5)), (std::vector<uint32>{ 1, 3 }));
+
+    // the member taking the old slot of the moved one ignores nobody
+    Join(members, 6);
+    EXPECT_EQ(Receivers(members, PlayerGuid(1)), (std::vector<uint32>{ 1, 3, 6 }));
+    EXPECT_EQ(Receivers(members, PlayerGuid(5)), (std::vector<uint32>{ 1, 3, 6 }));
+}
+
+TEST(ChannelMembersTest, RemovingTheLastMemberDropsItsIgnores)
+{
+    ChannelMembers members;
+    Join(members, 1);
+    Join(members, 2, { PlayerGuid(1) });
+
+    members.Remove(PlayerGuid(2));
+    Join(members, 3);
+
+    EXPECT_FALSE(members.IsIgnoring(PlayerGuid(3), PlayerGuid(1)));
+    EXPECT_EQ(Receivers(members, PlayerGuid(1)), (std::vector<uint32>{ 1, 3 }));
+}
+
+TEST(ChannelMembersTest, RemovingAnUnknownMemberChangesNothing)
+{
+    ChannelMembers members;
+    Join(members, 1, { PlayerGuid(2) });
+
+    members.Remove(PlayerGuid(2));
+
+    EXPECT_EQ(members.GetSize(), 1u);
+    EXPECT_TRUE(members.IsIgnoring(PlayerGuid(1), PlayerGuid(2)));
+}
+
+TEST(ChannelMembersTest, IgnoreChangedWhileInTheChannel)
+{
+    ChannelMembers members;
+    Join(members, 1);
+    Join(members, 2);
+    Join(members, 3);
+
+    members.SetIgnore(PlayerGuid(2), PlayerGuid(1), true);
+    EXPECT_EQ(Receivers(members, PlayerGuid(1)), (std::vector<uint32>{ 1, 3 }));
+
+    // adding it twice does not need two removals
+    members.SetIgnore(PlayerGuid(2), PlayerGuid(1), true);
+    members.SetIgnore(PlayerGuid(2), PlayerGuid(1), false);
+    EXPECT_EQ(Receivers(members, PlayerGuid(1)), (std::vector<uint32>{ 1, 2, 3 }));
+
+    // an ignore added in the channel moves with the member
+    members.SetIgnore(PlayerGuid(3), PlayerGuid(1), true);
+    members.Remove(PlayerGuid(1));
+    EXPECT_TRUE(members.IsIgnoring(PlayerGuid(3), PlayerGuid(1)));
+    EXPECT_FALSE(members.IsIgnoring(PlayerGuid(2), PlayerGuid(1)));
+
+    members.SetIgnore(PlayerGuid(3), PlayerGuid(1), false);
+    EXPECT_FALSE(members.IsIgnoring(PlayerGuid(3), PlayerGuid(1)));
+}
+
+TEST(ChannelMembersTest, IgnoreOfANonMemberIsNotTracked)
+{
+    ChannelMembers members;
+    Join(members, 1);
+
+    members.SetIgnore(PlayerGuid(2), PlayerGuid(1), true);
+
+    EXPECT_EQ(Receivers(members, PlayerGuid(1)), (std::vector<uint32>{ 1 }));
+}
+
+TEST(ChannelMembersTest, MoreThanSixtyFourMembers)
+{
+    constexpr uint32 MemberCount = 150;
+    ObjectGuid const sender = PlayerGuid(1000);
+
+    // every third member ignores the sender, the slots span three bitset words
+    ChannelMembers members;
+    for (uint32 counter = 1; counter <= MemberCount; ++counter)
+        Join(members, counter, counter % 3 ? GuidVector() : GuidVector{ sender });
+
+    std::vector<uint32> expected;
+    for (uint32 counter = 1; counter <= MemberCount; ++counter)
+        if (counter % 3)
+            expected.push_back(counter);
+
+    EXPECT_EQ(Receivers(members, sender), expected);
+
+    // members of the first word leave, ignoring members of the last words move into their slots
+    for (uint32 counter = 1; counter <= 40; ++counter)
+    {
+        members.Remove(PlayerGuid(counter));
+        expected.erase(std::remove(expected.begin(), expected.end(), counter), expected.end());
+    }
+
+    EXPECT_EQ(members.GetSize(), MemberCount - 40);
+    EXPECT_EQ(Receivers(members, sender), expected);
+    for (uint32 counter = 41; counter <= MemberCount; ++counter)
+        EXPECT_EQ(members.IsIgnoring(PlayerGuid(counter), sender), counter % 3 == 0) << counter;
+
+    // an ignore added and removed past the first word
+    members.SetIgnore(PlayerGuid(149), sender, true);
+    expected.erase(std::remove(expected.begin(), expected.end(), 149u), expected.end());
+    EXPECT_EQ(Receivers(members, sender), expected);
+
+    for (uint32 counter = 41; counter <= MemberCount; ++counter)
+        members.SetIgnore(PlayerGuid(counter), sender, false);
+
+    expected.clear();
+    for (uint32 counter = 41; counter <= MemberCount; ++counter)
+        expected.push_back(counter);
+
+    EXPECT_EQ(Receivers(members, sender), expected);
+}
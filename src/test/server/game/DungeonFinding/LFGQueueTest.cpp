@@ -0,0 +1,122 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "LFGMgr.h"
+#include "gtest/gtest.h"
+#include <algorithm>
+#include <random>
+
+using namespace lfg;
+
+namespace
+{
+    uint8 const RoleChoices[] = { PLAYER_ROLE_TANK, PLAYER_ROLE_HEALER, PLAYER_ROLE_DAMAGE };
+
+    // Queued player or group with random roles and dungeons, like CheckCompatibility finds them in the queue data
+    struct QueuedGroup
+    {
+        LfgRolesMap roles;
+        LfgDungeonSet dungeons;
+    };
+
+    // The role check is exponential in the number of multi role players, keep proposals at 5 players
+    QueuedGroup MakeGroup(std::mt19937& random, uint32& nextGuid, uint32 maxPlayers)
+    {
+        QueuedGroup group;
+        for (uint32 i = random() % maxPlayers + 1; i > 0; --i)
+        {
+            uint8 role = random() % 4 ? PLAYER_ROLE_NONE : PLAYER_ROLE_LEADER;
+            for (uint8 choice : RoleChoices)
+                if (random() % 2)
+                    role |= choice;
+
+            group.roles[ObjectGuid::Create<HighGuid::Player>(++nextGuid)] = role;
+        }
+
+        // Random dungeon queues share most of their dungeons, specific ones rarely
+        for (uint32 i = random() % 4 + 1; i > 0; --i)
+            group.dungeons.insert(random() % 8 ? random() % 12 + 200 : 600 + random() % 2);
+
+        return group;
+    }
+
+    bool ReferenceMatch(QueuedGroup const& a, QueuedGroup const& b)
+    {
+        LfgRolesMap roles = a.roles;
+        roles.insert(b.roles.begin(), b.roles.end());
+
+        LfgDungeonSet dungeons;
+        std::set_intersection(a.dungeons.begin(), a.dungeons.end(), b.dungeons.begin(), b.dungeons.end(), std::inserter(dungeons, dungeons.begin()));
+
+        return LFGMgr::CheckGroupRoles(roles) && !dungeons.empty();
+    }
+}
+
+TEST(LFGQueueTest, CompatibilityMaskMatchesRoleCheck)
+{
+    std::mt19937 random(3);
+    uint32 nextGuid = 0;
+
+    for (uint32 i = 0; i < 20000; ++i)
+    {
+        QueuedGroup const a = MakeGroup(random, nextGuid, 3);
+        QueuedGroup const b = MakeGroup(random, nextGuid, 2);
+
+        LfgCompatibilityMask const maskA(a.dungeons, a.roles);
+        LfgCompatibilityMask const maskB(b.dungeons, b.roles);
+
+        // A single group has an assignment exactly when the role check finds one
+        LfgRolesMap rolesA = a.roles;
+        ASSERT_EQ(maskA.roles != 0, LFGMgr::CheckGroupRoles(rolesA) != 0);
+
+        bool const expected = ReferenceMatch(a, b);
+        bool const bigIds = maskA.bigDungeonIds && maskB.bigDungeonIds;
+
+        // Never rejects a match, and is exact unless both queued for ids above the bitset
+        ASSERT_TRUE(!expected || maskA.CanMatchWith(maskB));
+        if (!bigIds)
+            ASSERT_EQ(maskA.CanMatchWith(maskB), expected);
+    }
+}
+
+TEST(LFGQueueTest, CombinedCompatibles)
+{
+    std::mt19937 random(5);
+    uint32 nextGuid = 0;
+
+    for (uint32 i = 0; i < 5000; ++i)
+    {
+        QueuedGroup const a = MakeGroup(random, nextGuid, 2);
+        QueuedGroup const b = MakeGroup(random, nextGuid, 2);
+        QueuedGroup const c = MakeGroup(random, nextGuid, 1);
+
+        // Compatible of a and b checked against a new group c
+        QueuedGroup ab = a;
+        ab.roles.insert(b.roles.begin(), b.roles.end());
+        for (uint32 dungeon : a.dungeons)
+            if (!b.dungeons.count(dungeon))
+                ab.dungeons.erase(dungeon);
+
+        LfgCompatibilityMask const maskAB = LfgCompatibilityMask(a.dungeons, a.roles).Combine(LfgCompatibilityMask(b.dungeons, b.roles));
+        LfgCompatibilityMask const maskC(c.dungeons, c.roles);
+
+        bool const expected = ReferenceMatch(ab, c);
+        ASSERT_TRUE(!expected || maskAB.CanMatchWith(maskC));
+        if (!maskAB.bigDungeonIds || !maskC.bigDungeonIds)
+            ASSERT_EQ(maskAB.CanMatchWith(maskC), expected);
+    }
+}
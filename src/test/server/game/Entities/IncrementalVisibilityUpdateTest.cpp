@@ -0,0 +1,113 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "TestPlayer.h"
+#include "TestMap.h"
+#include "WorldMock.h"
+#include "WorldSession.h"
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include <string>
+
+using namespace testing;
+
+namespace
+{
+class IncrementalVisibilityUpdateTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        TestMap::EnsureDBC();
+
+        originalWorld = sWorld.release();
+        worldMock = new NiceMock<WorldMock>();
+        sWorld.reset(worldMock);
+
+        static std::string emptyString;
+        ON_CALL(*worldMock, GetDataPath()).WillByDefault(ReturnRef(emptyString));
+        ON_CALL(*worldMock, GetRealmName()).WillByDefault(ReturnRef(emptyString));
+        ON_CALL(*worldMock, GetDefaultDbcLocale()).WillByDefault(Return(LOCALE_enUS));
+        ON_CALL(*worldMock, getRate(_)).WillByDefault(Return(1.0f));
+        ON_CALL(*worldMock, getBoolConfig(_)).WillByDefault(Return(false));
+        ON_CALL(*worldMock, getBoolConfig(CONFIG_VISIBILITY_INCREMENTAL_UPDATE)).WillByDefault(Return(true));
+        ON_CALL(*worldMock, getIntConfig(_)).WillByDefault(Return(0));
+        ON_CALL(*worldMock, getIntConfig(CONFIG_VISIBILITY_FULL_UPDATE_INTERVAL)).WillByDefault(Return(60000));
+        ON_CALL(*worldMock, getFloatConfig(_)).WillByDefault(Return(0.0f));
+        ON_CALL(*worldMock, GetPlayerSecurityLimit()).WillByDefault(Return(SEC_PLAYER));
+
+        session = new WorldSession(1, "player", 0, nullptr, SEC_PLAYER, EXPANSION_WRATH_OF_THE_LICH_KING,
+            0, LOCALE_enUS, 0, false, false, 0);
+
+        player = new TestPlayer(session);
+        player->ForceInitValues();
+        session->SetPlayer(player);
+        player->SetSession(session);
+    }
+
+    void TearDown() override
+    {
+        // Intentional leaks of session/player to avoid database access in destructors.
+        IWorld* currentWorld = sWorld.release();
+        delete currentWorld;
+        worldMock = nullptr;
+
+        sWorld.reset(originalWorld);
+        originalWorld = nullptr;
+        session = nullptr;
+        player = nullptr;
+    }
+
+    IWorld* originalWorld = nullptr;
+    NiceMock<WorldMock>* worldMock = nullptr;
+    WorldSession* session = nullptr;
+    TestPlayer* player = nullptr;
+};
+}
+
+TEST_F(IncrementalVisibilityUpdateTest, OnlyAfterFullUpdateInSameCell)
+{
+    EXPECT_FALSE(player->CanUpdateVisibilityIncrementally());
+
+    player->SetVisibilityUpdateCell();
+    EXPECT_TRUE(player->CanUpdateVisibilityIncrementally());
+
+    player->ResetVisibilityUpdateCell();
+    EXPECT_FALSE(player->CanUpdateVisibilityIncrementally());
+}
+
+// Phasing does not move the player, the objects of the old phase still have to be removed
+TEST_F(IncrementalVisibilityUpdateTest, PhaseChangeForcesFullUpdate)
+{
+    player->SetVisibilityUpdateCell();
+    ASSERT_TRUE(player->CanUpdateVisibilityIncrementally());
+
+    player->SetPhaseMask(player->GetPhaseMask() | 2, false);
+    EXPECT_FALSE(player->CanUpdateVisibilityIncrementally());
+
+    player->SetVisibilityUpdateCell();
+    EXPECT_TRUE(player->CanUpdateVisibilityIncrementally());
+}
+
+TEST_F(IncrementalVisibilityUpdateTest, GMVisibilityChangeForcesFullUpdate)
+{
+    player->SetVisibilityUpdateCell();
+    ASSERT_TRUE(player->CanUpdateVisibilityIncrementally());
+
+    player->SetServerSideVisibility(SERVERSIDE_VISIBILITY_GM, SEC_GAMEMASTER);
+    EXPECT_FALSE(player->CanUpdateVisibilityIncrementally());
+}
@@ -0,0 +1,245 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "ObjectVisibilityContainer.h"
+#include "gtest/gtest.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+namespace
+{
+    struct Dummy { };
+
+    typedef FlatVisibilityMap<Dummy> DummyMap;
+
+    ObjectGuid MakeGuid(uint32 counter)
+    {
+        return ObjectGuid::Create<HighGuid::Unit>(1, counter);
+    }
+
+    // Every entry is found at the position it is iterated at
+    bool IsConsistent(DummyMap& map)
+    {
+        for (DummyMap::iterator itr = map.begin(); itr != map.end(); ++itr)
+            if (map.find(itr->first) != itr)
+                return false;
+
+        return true;
+    }
+}
+
+TEST(FlatVisibilityMapTest, InsertFindErase)
+{
+    DummyMap map;
+    Dummy objects[100];
+
+    // Enough entries to grow the table a few times
+    for (uint32 i = 0; i < 100; ++i)
+        EXPECT_TRUE(map.insert(DummyMap::value_type(MakeGuid(100 - i), &objects[i])));
+
+    EXPECT_FALSE(map.insert(DummyMap::value_type(MakeGuid(50), &objects[0])));
+    EXPECT_EQ(map.size(), 100u);
+
+    for (uint32 i = 0; i < 100; ++i)
+    {
+        DummyMap::iterator itr = map.find(MakeGuid(100 - i));
+        ASSERT_NE(itr, map.end());
+        EXPECT_EQ(itr->second, &objects[i]);
+    }
+
+    EXPECT_EQ(map.find(MakeGuid(1000)), map.end());
+
+    EXPECT_EQ(map.erase(MakeGuid(1)), 1u);
+    EXPECT_EQ(map.erase(MakeGuid(1)), 0u);
+    EXPECT_EQ(map.erase(MakeGuid(99)), 1u);
+    EXPECT_EQ(map.find(MakeGuid(1)), map.end());
+    EXPECT_NE(map.find(MakeGuid(2)), map.end());
+    EXPECT_EQ(map.size(), 98u);
+    EXPECT_TRUE(IsConsistent(map));
+}
+
+TEST(FlatVisibilityMapTest, EraseWhileIterating)
+{
+    DummyMap map;
+    Dummy object;
+
+    for (uint32 i = 1; i <= 40; ++i)
+        map.insert(DummyMap::value_type(MakeGuid(i), &object));
+
+    // Every entry has to be visited exactly once, also the ones moved into erased positions
+    uint32 visited = 0;
+    for (DummyMap::iterator itr = map.begin(); itr != map.end();)
+    {
+        ++visited;
+        if (itr->first.GetCounter() % 2)
+            itr = map.erase(itr);
+        else
+            ++itr;
+    }
+
+    EXPECT_EQ(visited, 40u);
+    EXPECT_EQ(map.size(), 20u);
+    for (uint32 i = 1; i <= 40; ++i)
+        EXPECT_EQ(map.find(MakeGuid(i)) != map.end(), !(i % 2));
+
+    EXPECT_TRUE(IsConsistent(map));
+}
+
+TEST(FlatVisibilityMapTest, EraseIf)
+{
+    DummyMap map;
+    Dummy object;
+
+    for (uint32 i = 1; i <= 40; ++i)
+        map.insert(DummyMap::value_type(MakeGuid(i), &object));
+
+    uint32 calls = 0;
+    EXPECT_EQ(map.erase_if([&calls](DummyMap::value_type const& entry) { ++calls; return entry.first.GetCounter() > 10; }), 30u);
+    EXPECT_EQ(calls, 40u);
+    EXPECT_EQ(map.size(), 10u);
+
+    for (uint32 i = 1; i <= 10; ++i)
+        EXPECT_NE(map.find(MakeGuid(i)), map.end());
+
+    EXPECT_TRUE(map.insert(DummyMap::value_type(MakeGuid(25), &object)));
+    EXPECT_NE(map.find(MakeGuid(25)), map.end());
+    EXPECT_TRUE(IsConsistent(map));
+}
+
+TEST(FlatVisibilityMapTest, EraseIfPredicateLooksUpMap)
+{
+    DummyMap map;
+    Dummy object;
+
+    for (uint32 i = 1; i <= 40; ++i)
+        map.insert(DummyMap::value_type(MakeGuid(i), &object));
+
+    // Erase the odd guids, every entry must still be found while the predicates run
+    uint32 missing = 0;
+    EXPECT_EQ(map.erase_if([&map, &missing](DummyMap::value_type const& entry)
+    {
+        for (uint32 i = 1; i <= 40; ++i)
+            if (map.find(MakeGuid(i)) == map.end())
+                ++missing;
+
+        DummyMap::iterator self = map.find(entry.first);
+        if (self == map.end() || self->first != entry.first)
+            ++missing;
+
+        return entry.first.GetCounter() % 2 != 0;
+    }), 20u);
+
+    EXPECT_EQ(missing, 0u);
+    EXPECT_EQ(map.size(), 20u);
+    for (uint32 i = 1; i <= 40; ++i)
+        EXPECT_EQ(map.find(MakeGuid(i)) != map.end(), i % 2 == 0);
+
+    EXPECT_TRUE(IsConsistent(map));
+}
+
+TEST(FlatVisibilityMapTest, RandomOperations)
+{
+    DummyMap map;
+    std::unordered_map<ObjectGuid, Dummy*> reference;
+    Dummy objects[64];
+
+    std::mt19937 random(7);
+    for (uint32 i = 0; i < 20000; ++i)
+    {
+        ObjectGuid const guid = MakeGuid(random() % 64 + 1);
+        if (random() % 2)
+            EXPECT_EQ(map.insert(DummyMap::value_type(guid, &objects[guid.GetCounter() - 1])), reference.emplace(guid, &objects[guid.GetCounter() - 1]).second);
+        else
+            EXPECT_EQ(map.erase(guid), reference.erase(guid));
+    }
+
+    EXPECT_EQ(map.size(), reference.size());
+    for (auto const& [guid, object] : reference)
+    {
+        DummyMap::iterator itr = map.find(guid);
+        ASSERT_NE(itr, map.end());
+        EXPECT_EQ(itr->second, object);
+    }
+
+    EXPECT_TRUE(IsConsistent(map));
+}
+
+namespace
+{
+    // Crowd of players walking around a city hub, each relocation links the objects entering
+    // the sight range of the player and unlinks the ones leaving it, like VisibleNotifier does.
+    template<class Map>
+    std::chrono::nanoseconds ReplayCrowdRelocations(uint32 objectCount, uint32 relocations)
+    {
+        std::mt19937 random(42);
+        std::uniform_real_distribution<float> position(0.0f, 1000.0f);
+        std::uniform_real_distribution<float> step(-10.0f, 10.0f);
+
+        std::vector<float> objectX(objectCount), objectY(objectCount);
+        for (uint32 i = 0; i < objectCount; ++i)
+        {
+            objectX[i] = position(random);
+            objectY[i] = position(random);
+        }
+
+        Dummy object;
+        Map visible;
+        float x = 500.0f, y = 500.0f;
+        float const rangeSq = 250.0f * 250.0f;
+
+        std::chrono::nanoseconds elapsed(0);
+        for (uint32 r = 0; r < relocations; ++r)
+        {
+            x = std::clamp(x + step(random), 0.0f, 1000.0f);
+            y = std::clamp(y + step(random), 0.0f, 1000.0f);
+
+            auto const start = std::chrono::steady_clock::now();
+            for (uint32 i = 0; i < objectCount; ++i)
+            {
+                float const dx = objectX[i] - x;
+                float const dy = objectY[i] - y;
+                bool const inRange = dx * dx + dy * dy <= rangeSq;
+                bool const seen = visible.find(MakeGuid(i + 1)) != visible.end();
+                if (inRange && !seen)
+                    visible.insert(typename Map::value_type(MakeGuid(i + 1), &object));
+                else if (!inRange && seen)
+                    visible.erase(MakeGuid(i + 1));
+            }
+
+            elapsed += std::chrono::steady_clock::now() - start;
+        }
+
+        return elapsed;
+    }
+}
+
+// Not a correctness test, run with --gtest_also_run_disabled_tests to compare the containers
+TEST(FlatVisibilityMapTest, DISABLED_CrowdRelocationBenchmark)
+{
+    for (uint32 objects : { 500, 2000, 8000 })
+    {
+        std::chrono::nanoseconds const hashed = ReplayCrowdRelocations<std::unordered_map<ObjectGuid, Dummy*>>(objects, 2000);
+        std::chrono::nanoseconds const flat = ReplayCrowdRelocations<DummyMap>(objects, 2000);
+
+        std::printf("%5u objects: unordered_map %8.2f ms, FlatVisibilityMap %8.2f ms\n", objects,
+            hashed.count() / 1000000.0, flat.count() / 1000000.0);
+    }
+}
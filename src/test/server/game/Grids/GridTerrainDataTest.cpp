@@ -0,0 +1,110 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "GridTerrainData.h"
+#include "gtest/gtest.h"
+#include <boost/filesystem.hpp>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace
+{
+    // Grid with a flat uint8 height map at 1.0 and a 2x2 liquid map at 5.0 in its first cells.
+    // The uint8 arrays leave the liquid map at an odd offset of the file.
+    std::string WriteMapFile()
+    {
+        auto path = boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("deleteme-%%%%.map");
+
+        map_fileheader header{};
+        header.mapMagic = MapMagic.asUInt;
+        header.versionMagic = MapVersionMagic;
+        header.areaMapOffset = sizeof(map_fileheader);
+        header.areaMapSize = sizeof(map_areaHeader);
+        header.heightMapOffset = header.areaMapOffset + header.areaMapSize;
+        header.heightMapSize = sizeof(map_heightHeader) + 129 * 129 + 128 * 128;
+        header.liquidMapOffset = header.heightMapOffset + header.heightMapSize;
+        header.liquidMapSize = sizeof(map_liquidHeader) + 4 * sizeof(float);
+
+        map_areaHeader areaHeader{ MapAreaMagic.asUInt, MAP_AREA_NO_AREA, 12 };
+        map_heightHeader heightHeader{ MapHeightMagic.asUInt, MAP_HEIGHT_AS_INT8, 0.0f, 2.55f };
+        std::vector<uint8> v9(129 * 129, 100);
+        std::vector<uint8> v8(128 * 128, 100);
+        map_liquidHeader liquidHeader{ MapLiquidMagic.asUInt, MAP_LIQUID_NO_TYPE, 0, 0, 0, 0, 2, 2, 0.0f };
+        float const liquidMap[4] = { 5.0f, 5.0f, 5.0f, 5.0f };
+
+        std::ofstream stream(path.string(), std::ios::binary);
+        stream.write(reinterpret_cast<char const*>(&header), sizeof(header));
+        stream.write(reinterpret_cast<char const*>(&areaHeader), sizeof(areaHeader));
+        stream.write(reinterpret_cast<char const*>(&heightHeader), sizeof(heightHeader));
+        stream.write(reinterpret_cast<char const*>(v9.data()), v9.size());
+        stream.write(reinterpret_cast<char const*>(v8.data()), v8.size());
+        stream.write(reinterpret_cast<char const*>(&liquidHeader), sizeof(liquidHeader));
+        stream.write(reinterpret_cast<char const*>(liquidMap), sizeof(liquidMap));
+        return path.string();
+    }
+
+    // First cell of grid [32, 32]
+    constexpr float CellX = 17066.0f;
+    constexpr float CellY = 17066.0f;
+}
+
+TEST(GridTerrainDataTest, LoadFromBuffer)
+{
+    std::string const fileName = WriteMapFile();
+
+    GridTerrainData data;
+    EXPECT_EQ(data.Load(fileName), TerrainMapDataReadResult::Success);
+    EXPECT_EQ(data.getArea(CellX, CellY), 12);
+    EXPECT_NEAR(data.getHeight(CellX, CellY), 1.0f, 0.001f);
+    EXPECT_FLOAT_EQ(data.getLiquidLevel(CellX, CellY), 5.0f);
+
+    std::remove(fileName.c_str());
+}
+
+TEST(GridTerrainDataTest, LoadMemoryMapped)
+{
+    std::string const fileName = WriteMapFile();
+
+    GridTerrainData buffered;
+    ASSERT_EQ(buffered.Load(fileName), TerrainMapDataReadResult::Success);
+
+    {
+        GridTerrainData mapped;
+        ASSERT_EQ(mapped.Load(fileName, true), TerrainMapDataReadResult::Success);
+        EXPECT_EQ(mapped.getArea(CellX, CellY), buffered.getArea(CellX, CellY));
+        EXPECT_FLOAT_EQ(mapped.getHeight(CellX, CellY), buffered.getHeight(CellX, CellY));
+        EXPECT_FLOAT_EQ(mapped.getLiquidLevel(CellX, CellY), buffered.getLiquidLevel(CellX, CellY));
+    }
+
+    std::remove(fileName.c_str());
+}
+
+TEST(GridTerrainDataTest, TruncatedFile)
+{
+    std::string const fileName = WriteMapFile();
+    boost::filesystem::resize_file(fileName, sizeof(map_fileheader) + sizeof(map_areaHeader) + sizeof(map_heightHeader) + 100);
+
+    GridTerrainData buffered;
+    EXPECT_EQ(buffered.Load(fileName), TerrainMapDataReadResult::InvalidHeightData);
+
+    GridTerrainData mapped;
+    EXPECT_EQ(mapped.Load(fileName, true), TerrainMapDataReadResult::InvalidHeightData);
+
+    std::remove(fileName.c_str());
+}
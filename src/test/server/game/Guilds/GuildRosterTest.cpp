@@ -0,0 +1,163 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "GuildRoster.h"
+#include "WorldPacket.h"
+#include "gtest/gtest.h"
+
+namespace
+{
+    constexpr Milliseconds Tick = 1000ms;
+
+    // The roster only keeps the pointers, it never dereferences them
+    Player* FakePlayer(uintptr_t id)
+    {
+        return reinterpret_cast<Player*>(id);
+    }
+
+    std::shared_ptr<WorldPacket const> MakeRoster()
+    {
+        return std::make_shared<WorldPacket const>(SMSG_GUILD_ROSTER, 0);
+    }
+
+    class GuildRosterTest : public ::testing::Test
+    {
+    protected:
+        // What Guild::HandleRoster does, returns the packet sent to the member
+        std::shared_ptr<WorldPacket const> RequestRoster(bool officerNotes, Milliseconds now = Tick)
+        {
+            if (std::shared_ptr<WorldPacket const> packet = Roster.GetPacket(officerNotes, now))
+                return packet;
+
+            std::shared_ptr<WorldPacket const> packet = MakeRoster();
+            Roster.StorePacket(officerNotes, packet);
+            ++Builds;
+            return packet;
+        }
+
+        GuildRoster Roster;
+        uint32 Builds = 0;
+        ObjectGuid const First = ObjectGuid::Create<HighGuid::Player>(1);
+        ObjectGuid const Second = ObjectGuid::Create<HighGuid::Player>(2);
+    };
+}
+
+TEST_F(GuildRosterTest, RequestsOfOneTickShareThePacket)
+{
+    std::shared_ptr<WorldPacket const> packet = RequestRoster(false);
+
+    EXPECT_EQ(RequestRoster(false), packet);
+    EXPECT_EQ(RequestRoster(false), packet);
+    EXPECT_EQ(Builds, 1u);
+}
+
+TEST_F(GuildRosterTest, OfficerNotesHaveTheirOwnPacket)
+{
+    std::shared_ptr<WorldPacket const> members = RequestRoster(false);
+    std::shared_ptr<WorldPacket const> officers = RequestRoster(true);
+
+    EXPECT_NE(members, officers);
+    EXPECT_EQ(RequestRoster(false), members);
+    EXPECT_EQ(RequestRoster(true), officers);
+    EXPECT_EQ(Builds, 2u);
+}
+
+TEST_F(GuildRosterTest, NextTickBuildsTheRosterAgain)
+{
+    std::shared_ptr<WorldPacket const> packet = RequestRoster(false);
+
+    // levels, zones and logout times change without an event
+    EXPECT_NE(RequestRoster(false, Tick + 1ms), packet);
+    EXPECT_EQ(Builds, 2u);
+}
+
+// Note, rank, MOTD and guild info changes and removed members, Guild calls Invalidate for all of them
+TEST_F(GuildRosterTest, InvalidateDropsBothPackets)
+{
+    std::shared_ptr<WorldPacket const> members = RequestRoster(false);
+    std::shared_ptr<WorldPacket const> officers = RequestRoster(true);
+
+    Roster.Invalidate();
+
+    EXPECT_EQ(Roster.GetPacket(false, Tick), nullptr);
+    EXPECT_EQ(Roster.GetPacket(true, Tick), nullptr);
+    EXPECT_NE(RequestRoster(false), members);
+    EXPECT_NE(RequestRoster(true), officers);
+    EXPECT_EQ(Builds, 4u);
+}
+
+// An accepted invite logs the member in through Guild::AddMember and SendLoginInfo
+TEST_F(GuildRosterTest, LoginAddsTheMemberAndDropsThePackets)
+{
+    RequestRoster(false);
+
+    Roster.AddOnlineMember(First, FakePlayer(0x10));
+
+    EXPECT_EQ(Roster.FindOnlineMember(First), FakePlayer(0x10));
+    EXPECT_EQ(Roster.GetOnlineMembers().size(), 1u);
+    EXPECT_EQ(Roster.GetPacket(false, Tick), nullptr);
+}
+
+TEST_F(GuildRosterTest, LoginAgainReplacesThePlayer)
+{
+    Roster.AddOnlineMember(First, FakePlayer(0x10));
+    Roster.AddOnlineMember(First, FakePlayer(0x20));
+
+    EXPECT_EQ(Roster.FindOnlineMember(First), FakePlayer(0x20));
+    EXPECT_EQ(Roster.GetOnlineMembers().size(), 1u);
+}
+
+// Guild::HandleMemberLogout and Guild::DeleteMember of an online member
+TEST_F(GuildRosterTest, LogoutRemovesOnlyThatMember)
+{
+    Roster.AddOnlineMember(First, FakePlayer(0x10));
+    Roster.AddOnlineMember(Second, FakePlayer(0x20));
+    RequestRoster(false);
+
+    EXPECT_TRUE(Roster.RemoveOnlineMember(First));
+
+    EXPECT_EQ(Roster.FindOnlineMember(First), nullptr);
+    EXPECT_EQ(Roster.FindOnlineMember(Second), FakePlayer(0x20));
+    EXPECT_EQ(Roster.GetOnlineMembers().size(), 1u);
+    EXPECT_EQ(Roster.GetPacket(false, Tick), nullptr);
+}
+
+// Guild::DeleteMember of an offline member, the guild drops the packets itself
+TEST_F(GuildRosterTest, RemovingAnOfflineMemberKeepsThePackets)
+{
+    Roster.AddOnlineMember(Second, FakePlayer(0x20));
+    std::shared_ptr<WorldPacket const> packet = RequestRoster(false);
+
+    EXPECT_FALSE(Roster.RemoveOnlineMember(First));
+
+    EXPECT_EQ(Roster.FindOnlineMember(Second), FakePlayer(0x20));
+    EXPECT_EQ(RequestRoster(false), packet);
+}
+
+TEST_F(GuildRosterTest, NoPlayerIsLeftAfterEveryoneLeft)
+{
+    Roster.AddOnlineMember(First, FakePlayer(0x10));
+    Roster.AddOnlineMember(Second, FakePlayer(0x20));
+
+    Roster.RemoveOnlineMember(First);
+    Roster.RemoveOnlineMember(Second);
+    // logout after the member was already deleted from the guild
+    EXPECT_FALSE(Roster.RemoveOnlineMember(Second));
+
+    EXPECT_TRUE(Roster.GetOnlineMembers().empty());
+    EXPECT_EQ(Roster.FindOnlineMember(First), nullptr);
+}
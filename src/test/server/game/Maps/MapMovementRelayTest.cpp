@@ -0,0 +1,279 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "IntegrationTestFixture.h"
+#include "MapMovementRelay.h"
+#include "MapUpdater.h"
+#include "Opcodes.h"
+#include <mutex>
+
+namespace
+{
+    struct SentPacket
+    {
+        Unit const* Mover;
+        uint16 Opcode;
+        uint32 Sequence;
+        uint32 HeartbeatCount;
+    };
+
+    // Records the packets the relay sends instead of sending them to the players in sight
+    class RecordingSender
+    {
+    public:
+        MapMovementRelay::Sender Get()
+        {
+            return [this](Unit const* mover, WorldPacket const& packet, Player const* /*skippedReceiver*/, uint32 heartbeatCount)
+            {
+                std::lock_guard<std::mutex> guard(_lock);
+                _sent.push_back({ mover, packet.GetOpcode(), packet.read<uint32>(0), heartbeatCount });
+            };
+        }
+
+        std::vector<SentPacket> const& GetSent() const { return _sent; }
+
+        std::vector<uint32> GetSequences(Unit const* mover) const
+        {
+            std::vector<uint32> sequences;
+            for (SentPacket const& sent : _sent)
+                if (sent.Mover == mover)
+                    sequences.push_back(sent.Sequence);
+
+            return sequences;
+        }
+
+    private:
+        std::mutex _lock;
+        std::vector<SentPacket> _sent;
+    };
+
+    WorldPacket MakePacket(uint16 opcode, uint32 sequence)
+    {
+        WorldPacket packet(opcode, 4);
+        packet << sequence;
+        return packet;
+    }
+
+    std::vector<uint32> Numbered(uint32 count)
+    {
+        std::vector<uint32> sequence(count);
+        for (uint32 i = 0; i < count; ++i)
+            sequence[i] = i;
+
+        return sequence;
+    }
+}
+
+class MapMovementRelayTest : public IntegrationTestFixture
+{
+protected:
+    // Movers further apart than a cell end up in different batches
+    TestCreature* CreateMover(ObjectGuid::LowType guidLow, float x, float y)
+    {
+        TestCreature* mover = CreateTestCreature(guidLow, 1, TEST_FACTION_HOSTILE_TO_ALL);
+        mover->Relocate(x, y, 0.0f);
+        return mover;
+    }
+
+    RecordingSender _recorder;
+    MapUpdater _updater;
+};
+
+TEST_F(MapMovementRelayTest, DeliversEveryPacketOnceInOrder)
+{
+    MapMovementRelay relay(_recorder.Get());
+    TestCreature* first = CreateMover(1, 0.0f, 0.0f);
+    TestCreature* second = CreateMover(2, 200.0f, 0.0f);
+    TestCreature* third = CreateMover(3, 0.0f, 200.0f);
+
+    for (uint32 i = 0; i < 5; ++i)
+    {
+        relay.Add(first, MakePacket(MSG_MOVE_HEARTBEAT, i), nullptr);
+        relay.Add(second, MakePacket(MSG_MOVE_HEARTBEAT, i), nullptr);
+        relay.Add(third, MakePacket(MSG_MOVE_HEARTBEAT, i), nullptr);
+    }
+
+    EXPECT_FALSE(relay.IsEmpty());
+    relay.Deliver(GetTestMap(), _updater);
+    EXPECT_TRUE(relay.IsEmpty());
+
+    EXPECT_EQ(_recorder.GetSent().size(), 15u);
+    EXPECT_EQ(_recorder.GetSequences(first), Numbered(5));
+    EXPECT_EQ(_recorder.GetSequences(second), Numbered(5));
+    EXPECT_EQ(_recorder.GetSequences(third), Numbered(5));
+
+    // Nothing is sent twice
+    relay.Deliver(GetTestMap(), _updater);
+    EXPECT_EQ(_recorder.GetSent().size(), 15u);
+}
+
+TEST_F(MapMovementRelayTest, MoverKeepsTheCellOfItsFirstPacket)
+{
+    MapMovementRelay relay(_recorder.Get());
+    TestCreature* mover = CreateMover(1, 0.0f, 0.0f);
+    TestCreature* other = CreateMover(2, 300.0f, 0.0f);
+
+    relay.Add(mover, MakePacket(MSG_MOVE_HEARTBEAT, 0), nullptr);
+    relay.Add(other, MakePacket(MSG_MOVE_HEARTBEAT, 0), nullptr);
+
+    // Crosses into the cell of the other mover, its packets still go out together and in order
+    mover->Relocate(300.0f, 0.0f, 0.0f);
+    relay.Add(mover, MakePacket(MSG_MOVE_HEARTBEAT, 1), nullptr);
+    relay.Add(mover, MakePacket(MSG_MOVE_HEARTBEAT, 2), nullptr);
+
+    relay.Deliver(GetTestMap(), _updater);
+
+    EXPECT_EQ(_recorder.GetSequences(mover), Numbered(3));
+    EXPECT_EQ(_recorder.GetSequences(other), Numbered(1));
+}
+
+TEST_F(MapMovementRelayTest, KeepsTheHeartbeatCountOfTheQueuedPacket)
+{
+    MapMovementRelay relay(_recorder.Get());
+    TestCreature* mover = CreateMover(1, 0.0f, 0.0f);
+
+    mover->m_relayedHeartbeatCount = 5;
+    relay.Add(mover, MakePacket(MSG_MOVE_HEARTBEAT, 0), nullptr);
+    mover->m_relayedHeartbeatCount = 9;
+
+    relay.Deliver(GetTestMap(), _updater);
+
+    ASSERT_EQ(_recorder.GetSent().size(), 1u);
+    EXPECT_EQ(_recorder.GetSent()[0].HeartbeatCount, 5u);
+}
+
+TEST_F(MapMovementRelayTest, SkipsMoversThatLeftTheWorld)
+{
+    MapMovementRelay relay(_recorder.Get());
+    TestCreature* mover = CreateMover(1, 0.0f, 0.0f);
+
+    relay.Add(mover, MakePacket(MSG_MOVE_HEARTBEAT, 0), nullptr);
+    mover->SetInWorld(false);
+
+    relay.Deliver(GetTestMap(), _updater);
+
+    EXPECT_TRUE(_recorder.GetSent().empty());
+}
+
+TEST_F(MapMovementRelayTest, ParallelDeliveryKeepsEachMoverInOrder)
+{
+    constexpr uint32 Movers = 64;
+    constexpr uint32 PacketsPerMover = 50;
+
+    MapMovementRelay relay(_recorder.Get());
+    std::vector<TestCreature*> movers;
+    for (uint32 i = 0; i < Movers; ++i)
+        movers.push_back(CreateMover(i + 1, float(i % 8) * 100.0f, float(i / 8) * 100.0f));
+
+    for (uint32 n = 0; n < PacketsPerMover; ++n)
+        for (TestCreature* mover : movers)
+            relay.Add(mover, MakePacket(MSG_MOVE_HEARTBEAT, n), nullptr);
+
+    _updater.activate(4);
+    relay.Deliver(GetTestMap(), _updater);
+    // Helpers that found no batch left may still be queued, as after a map update
+    _updater.wait();
+    _updater.deactivate();
+
+    EXPECT_TRUE(relay.IsEmpty());
+    EXPECT_EQ(_recorder.GetSent().size(), std::size_t(Movers * PacketsPerMover));
+    for (TestCreature* mover : movers)
+        EXPECT_EQ(_recorder.GetSequences(mover), Numbered(PacketsPerMover));
+}
+
+TEST_F(MapMovementRelayTest, OnlyHeartbeatsWait)
+{
+    MapMovementRelay relay(_recorder.Get());
+    TestCreature* mover = CreateMover(1, 0.0f, 0.0f);
+
+    relay.Send(mover, MakePacket(MSG_MOVE_HEARTBEAT, 0), nullptr);
+    EXPECT_TRUE(_recorder.GetSent().empty());
+
+    // The stop goes out right away, after the heartbeat queued before it
+    relay.Send(mover, MakePacket(MSG_MOVE_STOP, 1), nullptr);
+    ASSERT_EQ(_recorder.GetSent().size(), 2u);
+    EXPECT_EQ(_recorder.GetSent()[0].Opcode, MSG_MOVE_HEARTBEAT);
+    EXPECT_EQ(_recorder.GetSent()[1].Opcode, MSG_MOVE_STOP);
+
+    relay.Deliver(GetTestMap(), _updater);
+    EXPECT_EQ(_recorder.GetSequences(mover), Numbered(2));
+}
+
+TEST_F(MapMovementRelayTest, BroadcastFlushesTheQueuedHeartbeatsOfItsSource)
+{
+    MapMovementRelay relay(_recorder.Get());
+    TestCreature* caster = CreateMover(1, 0.0f, 0.0f);
+    TestCreature* other = CreateMover(2, 200.0f, 0.0f);
+
+    relay.Send(caster, MakePacket(MSG_MOVE_HEARTBEAT, 0), nullptr);
+    relay.Send(caster, MakePacket(MSG_MOVE_HEARTBEAT, 1), nullptr);
+    relay.Send(other, MakePacket(MSG_MOVE_HEARTBEAT, 0), nullptr);
+
+    // What SendMessageToSet does before a spell start of the caster goes out
+    relay.Flush(caster);
+    EXPECT_EQ(_recorder.GetSequences(caster), Numbered(2));
+    EXPECT_TRUE(_recorder.GetSequences(other).empty());
+
+    relay.Send(caster, MakePacket(MSG_MOVE_HEARTBEAT, 2), nullptr);
+    relay.Deliver(GetTestMap(), _updater);
+
+    EXPECT_EQ(_recorder.GetSequences(caster), Numbered(3));
+    EXPECT_EQ(_recorder.GetSequences(other), Numbered(1));
+}
+
+TEST_F(MapMovementRelayTest, NoStaleHeartbeatAfterTeleport)
+{
+    MapMovementRelay relay(_recorder.Get());
+    TestCreature* mover = CreateMover(1, 0.0f, 0.0f);
+
+    relay.Send(mover, MakePacket(MSG_MOVE_HEARTBEAT, 0), nullptr);
+
+    // The teleport is sent to the set, the heartbeat from before goes out first
+    relay.Flush(mover);
+    ASSERT_EQ(_recorder.GetSent().size(), 1u);
+
+    relay.Deliver(GetTestMap(), _updater);
+    EXPECT_EQ(_recorder.GetSent().size(), 1u);
+    EXPECT_TRUE(relay.IsEmpty());
+}
+
+TEST_F(MapMovementRelayTest, FlushWithoutQueuedHeartbeatsSendsNothing)
+{
+    MapMovementRelay relay(_recorder.Get());
+    TestCreature* mover = CreateMover(1, 0.0f, 0.0f);
+    TestCreature* other = CreateMover(2, 0.0f, 0.0f);
+
+    relay.Flush(mover);
+    relay.Send(other, MakePacket(MSG_MOVE_HEARTBEAT, 0), nullptr);
+    relay.Flush(mover);
+
+    EXPECT_TRUE(_recorder.GetSent().empty());
+}
+
+TEST_F(MapMovementRelayTest, EnabledFromMinPlayers)
+{
+    ON_CALL(*GetWorldMock(), getIntConfig(CONFIG_MAP_PARALLEL_MOVEMENT_RELAY_MIN_PLAYERS)).WillByDefault(Return(50));
+
+    EXPECT_FALSE(MapMovementRelay::IsEnabledFor(500));
+
+    ON_CALL(*GetWorldMock(), getBoolConfig(CONFIG_MAP_PARALLEL_MOVEMENT_RELAY)).WillByDefault(Return(true));
+
+    EXPECT_FALSE(MapMovementRelay::IsEnabledFor(0));
+    EXPECT_FALSE(MapMovementRelay::IsEnabledFor(49));
+    EXPECT_TRUE(MapMovementRelay::IsEnabledFor(50));
+    EXPECT_TRUE(MapMovementRelay::IsEnabledFor(500));
+}
@@ -0,0 +1,264 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "DetourAlloc.h"
+#include "DetourNavMeshBuilder.h"
+#include "DetourNavMeshQuery.h"
+#include "PathCorridorCache.h"
+#include "WorldMock.h"
+#include "gtest/gtest.h"
+#include <chrono>
+#include <thread>
+
+using namespace testing;
+
+namespace
+{
+    constexpr int StripPolyCount = 4;
+    constexpr int VertsPerPoly = 4;
+
+    // One tile holding a strip of four square polygons
+    bool AddStripTile(dtNavMesh& navMesh)
+    {
+        unsigned short verts[(StripPolyCount + 1) * 2 * 3];
+        for (unsigned short i = 0; i <= StripPolyCount; ++i)
+        {
+            unsigned short* near = &verts[i * 3];
+            unsigned short* far = &verts[(StripPolyCount + 1 + i) * 3];
+            near[0] = far[0] = i * 10;
+            near[1] = far[1] = 0;
+            near[2] = 0;
+            far[2] = 10;
+        }
+
+        unsigned short polys[StripPolyCount * 2 * VertsPerPoly];
+        unsigned short polyFlags[StripPolyCount];
+        unsigned char polyAreas[StripPolyCount];
+        for (unsigned short i = 0; i < StripPolyCount; ++i)
+        {
+            unsigned short* poly = &polys[i * 2 * VertsPerPoly];
+            poly[0] = i;
+            poly[1] = StripPolyCount + 1 + i;
+            poly[2] = StripPolyCount + 2 + i;
+            poly[3] = i + 1;
+            std::fill(poly + VertsPerPoly, poly + 2 * VertsPerPoly, 0xFFFF);
+            polyFlags[i] = 1;
+            polyAreas[i] = 0;
+        }
+
+        dtNavMeshCreateParams params = {};
+        params.verts = verts;
+        params.vertCount = (StripPolyCount + 1) * 2;
+        params.polys = polys;
+        params.polyFlags = polyFlags;
+        params.polyAreas = polyAreas;
+        params.polyCount = StripPolyCount;
+        params.nvp = VertsPerPoly;
+        params.bmax[0] = StripPolyCount * 10.0f;
+        params.bmax[1] = 1.0f;
+        params.bmax[2] = 10.0f;
+        params.walkableHeight = 2.0f;
+        params.walkableRadius = 0.5f;
+        params.walkableClimb = 1.0f;
+        params.cs = 1.0f;
+        params.ch = 1.0f;
+
+        unsigned char* data = nullptr;
+        int dataSize = 0;
+        if (!dtCreateNavMeshData(&params, &data, &dataSize))
+            return false;
+
+        if (dtStatusFailed(navMesh.addTile(data, dataSize, DT_TILE_FREE_DATA, 0, nullptr)))
+        {
+            dtFree(data);
+            return false;
+        }
+
+        return true;
+    }
+}
+
+class PathCorridorCacheTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        _originalWorld = sWorld.release();
+        _worldMock = new NiceMock<WorldMock>();
+        sWorld.reset(_worldMock);
+
+        ON_CALL(*_worldMock, getIntConfig(_)).WillByDefault(Return(0));
+        SetCacheConfig(16, 60000);
+
+        dtNavMeshParams params = {};
+        params.tileWidth = 100.0f;
+        params.tileHeight = 100.0f;
+        params.maxTiles = 4;
+        params.maxPolys = 16;
+        ASSERT_TRUE(dtStatusSucceed(_navMesh.init(&params)));
+        ASSERT_TRUE(AddStripTile(_navMesh));
+        ASSERT_TRUE(dtStatusSucceed(_query.init(&_navMesh, 64)));
+
+        dtPolyRef const base = _navMesh.getPolyRefBase(_navMesh.getTileAt(0, 0, 0));
+        for (int i = 0; i < StripPolyCount; ++i)
+            _polys[i] = base | dtPolyRef(i);
+    }
+
+    void TearDown() override
+    {
+        IWorld* currentWorld = sWorld.release();
+        delete currentWorld;
+        _worldMock = nullptr;
+
+        sWorld.reset(_originalWorld);
+        _originalWorld = nullptr;
+    }
+
+    void SetCacheConfig(uint32 size, uint32 duration)
+    {
+        ON_CALL(*_worldMock, getIntConfig(CONFIG_MMAP_PATH_CACHE_SIZE)).WillByDefault(Return(size));
+        ON_CALL(*_worldMock, getIntConfig(CONFIG_MMAP_PATH_CACHE_DURATION)).WillByDefault(Return(duration));
+    }
+
+    // Corridor from the first poly of the strip to the given one
+    void StoreCorridor(uint32 endIndex)
+    {
+        _cache.Store(_polys[0], _polys[endIndex], _filter, _polys, endIndex + 1);
+    }
+
+    PathCorridorCache::Corridor const* FindCorridor(uint32 endIndex)
+    {
+        return _cache.Find(_polys[0], _polys[endIndex], _query, _filter);
+    }
+
+    IWorld* _originalWorld = nullptr;
+    NiceMock<WorldMock>* _worldMock = nullptr;
+
+    dtNavMesh _navMesh;
+    dtNavMeshQuery _query;
+    dtQueryFilter _filter;
+    dtPolyRef _polys[StripPolyCount] = {};
+
+    PathCorridorCache _cache;
+};
+
+TEST_F(PathCorridorCacheTest, HitReturnsTheStoredCorridor)
+{
+    StoreCorridor(3);
+
+    PathCorridorCache::Corridor const* corridor = FindCorridor(3);
+    ASSERT_NE(corridor, nullptr);
+    EXPECT_EQ(*corridor, PathCorridorCache::Corridor(_polys, _polys + 4));
+}
+
+TEST_F(PathCorridorCacheTest, MissesOtherPolysAndFilters)
+{
+    StoreCorridor(3);
+
+    EXPECT_EQ(FindCorridor(2), nullptr);
+    EXPECT_EQ(_cache.Find(_polys[1], _polys[3], _query, _filter), nullptr);
+
+    dtQueryFilter swimFilter;
+    swimFilter.setExcludeFlags(2);
+    EXPECT_EQ(_cache.Find(_polys[0], _polys[3], _query, swimFilter), nullptr);
+}
+
+TEST_F(PathCorridorCacheTest, StoreReplacesTheCorridor)
+{
+    StoreCorridor(3);
+    dtPolyRef const detour[] = { _polys[0], _polys[1], _polys[2], _polys[1], _polys[2], _polys[3] };
+    _cache.Store(_polys[0], _polys[3], _filter, detour, std::size(detour));
+
+    PathCorridorCache::Corridor const* corridor = FindCorridor(3);
+    ASSERT_NE(corridor, nullptr);
+    EXPECT_EQ(corridor->size(), std::size(detour));
+    EXPECT_EQ(_cache.GetSize(), 1u);
+}
+
+TEST_F(PathCorridorCacheTest, DisabledCacheStoresNothing)
+{
+    SetCacheConfig(0, 60000);
+    StoreCorridor(3);
+
+    EXPECT_EQ(_cache.GetSize(), 0u);
+    EXPECT_EQ(FindCorridor(3), nullptr);
+}
+
+TEST_F(PathCorridorCacheTest, ExpiredCorridorIsDropped)
+{
+    SetCacheConfig(16, 1);
+    StoreCorridor(3);
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+
+    EXPECT_EQ(FindCorridor(3), nullptr);
+    EXPECT_EQ(_cache.GetSize(), 0u);
+}
+
+TEST_F(PathCorridorCacheTest, ReloadedTileInvalidatesTheCorridor)
+{
+    StoreCorridor(3);
+    ASSERT_NE(FindCorridor(3), nullptr);
+
+    // unloading bumps the salt of the tile, the same polys get new refs once it is loaded again
+    ASSERT_TRUE(dtStatusSucceed(_navMesh.removeTile(_navMesh.getTileRefAt(0, 0, 0), nullptr, nullptr)));
+    EXPECT_EQ(FindCorridor(3), nullptr);
+    EXPECT_EQ(_cache.GetSize(), 0u);
+
+    StoreCorridor(3);
+    ASSERT_TRUE(AddStripTile(_navMesh));
+    EXPECT_EQ(FindCorridor(3), nullptr);
+    EXPECT_EQ(_cache.GetSize(), 0u);
+}
+
+TEST_F(PathCorridorCacheTest, FullCacheEvictsTheOldestCorridor)
+{
+    SetCacheConfig(2, 60000);
+    StoreCorridor(1);
+    StoreCorridor(2);
+    StoreCorridor(3);
+
+    EXPECT_EQ(_cache.GetSize(), 2u);
+    EXPECT_EQ(FindCorridor(1), nullptr);
+    EXPECT_NE(FindCorridor(2), nullptr);
+    EXPECT_NE(FindCorridor(3), nullptr);
+}
+
+TEST_F(PathCorridorCacheTest, FullCacheDropsExpiredCorridorsFirst)
+{
+    SetCacheConfig(2, 5);
+    StoreCorridor(1);
+    StoreCorridor(2);
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+
+    _cache.Store(_polys[1], _polys[3], _filter, _polys + 1, 3);
+
+    // both were expired, the cache only holds the newest corridor
+    EXPECT_EQ(_cache.GetSize(), 1u);
+}
+
+TEST_F(PathCorridorCacheTest, UpdatingAFullCacheEvictsNothing)
+{
+    SetCacheConfig(2, 60000);
+    StoreCorridor(1);
+    StoreCorridor(2);
+    StoreCorridor(1);
+
+    EXPECT_EQ(_cache.GetSize(), 2u);
+    EXPECT_NE(FindCorridor(1), nullptr);
+    EXPECT_NE(FindCorridor(2), nullptr);
+}
@@ -0,0 +1,42 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "GridNotifiers.h"
+#include "gtest/gtest.h"
+
+using Acore::MessageDistDeliverer;
+
+// Defaults of InterestManagement.FullRateDistance, DistanceStep and MaxDivisor
+TEST(HeartbeatRelayTest, DivisorWithDefaults)
+{
+    EXPECT_EQ(MessageDistDeliverer::GetHeartbeatDivisor(0.0f, 30.0f, 30.0f, 4), 1u);
+    EXPECT_EQ(MessageDistDeliverer::GetHeartbeatDivisor(30.0f, 30.0f, 30.0f, 4), 1u);
+    EXPECT_EQ(MessageDistDeliverer::GetHeartbeatDivisor(59.0f, 30.0f, 30.0f, 4), 1u);
+    EXPECT_EQ(MessageDistDeliverer::GetHeartbeatDivisor(60.0f, 30.0f, 30.0f, 4), 2u);
+    EXPECT_EQ(MessageDistDeliverer::GetHeartbeatDivisor(70.0f, 30.0f, 30.0f, 4), 2u);
+    EXPECT_EQ(MessageDistDeliverer::GetHeartbeatDivisor(90.0f, 30.0f, 30.0f, 4), 3u);
+    EXPECT_EQ(MessageDistDeliverer::GetHeartbeatDivisor(120.0f, 30.0f, 30.0f, 4), 4u);
+    EXPECT_EQ(MessageDistDeliverer::GetHeartbeatDivisor(500.0f, 30.0f, 30.0f, 4), 4u);
+}
+
+TEST(HeartbeatRelayTest, DivisorWithCustomSteps)
+{
+    EXPECT_EQ(MessageDistDeliverer::GetHeartbeatDivisor(20.0f, 20.0f, 10.0f, 8), 1u);
+    EXPECT_EQ(MessageDistDeliverer::GetHeartbeatDivisor(45.0f, 20.0f, 10.0f, 8), 3u);
+    EXPECT_EQ(MessageDistDeliverer::GetHeartbeatDivisor(200.0f, 20.0f, 10.0f, 8), 8u);
+    EXPECT_EQ(MessageDistDeliverer::GetHeartbeatDivisor(200.0f, 20.0f, 10.0f, 1), 1u);
+}
@@ -0,0 +1,157 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "LoginQueue.h"
+#include "gtest/gtest.h"
+#include <algorithm>
+#include <list>
+#include <random>
+#include <vector>
+
+namespace
+{
+    struct FakeSession
+    {
+        uint32 ReportedPosition = 0;
+    };
+
+    typedef LoginQueue<FakeSession> FakeQueue;
+
+    uint32 ListPosition(std::list<FakeSession*> const& list, FakeSession* session)
+    {
+        uint32 position = 1;
+        for (FakeSession* queued : list)
+        {
+            if (queued == session)
+                return position;
+
+            ++position;
+        }
+
+        return 0;
+    }
+}
+
+TEST(LoginQueueTest, PushRemoveFront)
+{
+    FakeQueue queue;
+    FakeSession sessions[5];
+
+    for (uint32 i = 0; i < 5; ++i)
+        EXPECT_EQ(queue.Push(&sessions[i]), i + 1);
+
+    EXPECT_TRUE(queue.Remove(&sessions[2]));
+    EXPECT_FALSE(queue.Remove(&sessions[2]));
+    EXPECT_EQ(queue.GetPosition(&sessions[2]), 0u);
+    EXPECT_EQ(queue.GetPosition(&sessions[3]), 3u);
+
+    EXPECT_EQ(queue.Front(), &sessions[0]);
+    queue.PopFront();
+    EXPECT_EQ(queue.Front(), &sessions[1]);
+    EXPECT_EQ(queue.GetPosition(&sessions[4]), 3u);
+    EXPECT_EQ(queue.Size(), 3u);
+
+    queue.Clear();
+    EXPECT_TRUE(queue.Empty());
+    EXPECT_EQ(queue.Front(), nullptr);
+}
+
+TEST(LoginQueueTest, BatchedPositionUpdates)
+{
+    FakeQueue queue;
+    FakeSession sessions[4];
+    for (FakeSession& session : sessions)
+        session.ReportedPosition = queue.Push(&session);
+
+    uint32 reports = 0;
+    auto report = [&reports](FakeSession* session, uint32 position) { session->ReportedPosition = position; ++reports; };
+
+    // Nobody moved yet
+    queue.UpdatePositions(report);
+    EXPECT_EQ(reports, 0u);
+
+    // Two leaves in the same update are reported once, only to the sessions that moved
+    queue.PopFront();
+    queue.Remove(&sessions[2]);
+    queue.UpdatePositions(report);
+    EXPECT_EQ(reports, 2u);
+    EXPECT_EQ(sessions[1].ReportedPosition, 1u);
+    EXPECT_EQ(sessions[3].ReportedPosition, 2u);
+
+    queue.Remove(&sessions[3]);
+    queue.UpdatePositions(report);
+    EXPECT_EQ(reports, 2u);
+}
+
+// Launch day: 10k sessions queue up, the front logs in and queued sessions give up at random
+TEST(LoginQueueTest, LoginStorm)
+{
+    std::vector<FakeSession> sessions(10000);
+    std::list<FakeSession*> reference;
+    FakeQueue queue;
+
+    std::mt19937 random(3);
+    uint32 next = 0;
+    uint32 reports = 0;
+
+    auto report = [&reports](FakeSession* session, uint32 position) { session->ReportedPosition = position; ++reports; };
+
+    for (uint32 tick = 0; next < sessions.size() || !reference.empty(); ++tick)
+    {
+        // Arrivals
+        for (uint32 i = 0; i < 50 && next < sessions.size(); ++i, ++next)
+        {
+            sessions[next].ReportedPosition = queue.Push(&sessions[next]);
+            reference.push_back(&sessions[next]);
+        }
+
+        // Logins
+        for (uint32 i = 0; i < 20 && !reference.empty(); ++i)
+        {
+            ASSERT_EQ(queue.Front(), reference.front());
+            queue.PopFront();
+            reference.pop_front();
+        }
+
+        // Disconnects
+        for (uint32 i = 0; i < 10 && !reference.empty(); ++i)
+        {
+            auto itr = std::next(reference.begin(), random() % reference.size());
+            ASSERT_TRUE(queue.Remove(*itr));
+            reference.erase(itr);
+        }
+
+        // At most one report per queued session and update, however many left
+        uint32 const reportsBefore = reports;
+        queue.UpdatePositions(report);
+        ASSERT_LE(reports - reportsBefore, reference.size());
+        ASSERT_EQ(queue.Size(), reference.size());
+
+        if (tick % 50)
+            continue;
+
+        for (FakeSession* session : reference)
+        {
+            uint32 const position = ListPosition(reference, session);
+            ASSERT_EQ(queue.GetPosition(session), position);
+            ASSERT_EQ(session->ReportedPosition, position);
+        }
+    }
+
+    EXPECT_GT(reports, 0u);
+    EXPECT_TRUE(queue.Empty());
+}
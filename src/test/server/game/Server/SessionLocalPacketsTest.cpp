@@ -0,0 +1,151 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "IntegrationTestFixture.h"
+#include "MapUpdater.h"
+#include "Opcodes.h"
+#include "WorldSession.h"
+#include "WorldSessionReceiveQueue.h"
+#include <memory>
+
+namespace
+{
+    // Session with a receive queue of its own: the queue of a WorldSession is only drained when it has a socket
+    struct QueuedSession
+    {
+        WorldSession* Session = nullptr;
+        WorldSessionReceiveQueue Queue;
+        std::vector<uint32> Handled;
+
+        void Drain(PacketFilter& filter)
+        {
+            while (ReceivedWorldPacket* packet = Queue.Next(filter))
+            {
+                Handled.push_back(packet->read<uint32>(0));
+                delete packet;
+            }
+        }
+    };
+
+    // Session local, map thread and world thread opcodes, in both lanes of the queue
+    constexpr Opcodes Pattern[] = { CMSG_NAME_QUERY, CMSG_QUEST_QUERY, CMSG_MESSAGECHAT, CMSG_PLAYED_TIME, CMSG_CHAR_ENUM, CMSG_SET_SELECTION, CMSG_QUERY_TIME };
+}
+
+class SessionLocalPacketsTest : public IntegrationTestFixture
+{
+protected:
+    void SetUp() override
+    {
+        IntegrationTestFixture::SetUp();
+        if (!opcodeTable[CMSG_NAME_QUERY])
+            opcodeTable.Initialize();
+    }
+
+    QueuedSession& CreateSession(uint32 accountId)
+    {
+        std::unique_ptr<QueuedSession>& queued = _sessions.emplace_back(std::make_unique<QueuedSession>());
+        queued->Session = new WorldSession(accountId, "session", 0, nullptr, SEC_PLAYER,
+            EXPANSION_WRATH_OF_THE_LICH_KING, 0, LOCALE_enUS, 0, false, false, 0);
+        return *queued;
+    }
+
+    static void Receive(QueuedSession& queued, Opcodes opcode, uint32 index)
+    {
+        WorldPacket packet(opcode, 4);
+        packet << uint32(index);
+        queued.Queue.Add(new ReceivedWorldPacket(std::move(packet)));
+    }
+
+    // Intentional leaks of the sessions, as in IntegrationTestFixture
+    std::vector<std::unique_ptr<QueuedSession>> _sessions;
+};
+
+TEST_F(SessionLocalPacketsTest, StopsAtTheFirstPacketOfTheWorldThread)
+{
+    QueuedSession& queued = CreateSession(1);
+    Receive(queued, CMSG_NAME_QUERY, 0);
+    Receive(queued, CMSG_QUEST_QUERY, 1);
+    Receive(queued, CMSG_MESSAGECHAT, 2);
+    Receive(queued, CMSG_NAME_QUERY, 3);
+
+    SessionLocalFilter local(queued.Session);
+    queued.Drain(local);
+    EXPECT_EQ(queued.Handled, (std::vector<uint32>{ 0, 1 }));
+
+    PacketFilter serial(queued.Session);
+    queued.Drain(serial);
+    EXPECT_EQ(queued.Handled, (std::vector<uint32>{ 0, 1, 2, 3 }));
+}
+
+TEST_F(SessionLocalPacketsTest, ShardedPassKeepsEachSessionInOrder)
+{
+    constexpr uint32 SessionCount = 64;
+    constexpr uint32 Rounds = 20;
+    constexpr uint32 PacketsPerRound = 25;
+
+    for (uint32 accountId = 1; accountId <= SessionCount; ++accountId)
+        CreateSession(accountId);
+
+    MapUpdater updater;
+    updater.activate(4);
+
+    // Sharded by account as in WorldSessionMgr::ProcessSessionLocalPackets
+    std::vector<std::vector<QueuedSession*>> shards(updater.thread_count());
+    for (std::unique_ptr<QueuedSession> const& queued : _sessions)
+        shards[queued->Session->GetAccountId() % shards.size()].push_back(queued.get());
+
+    uint32 index = 0;
+    for (uint32 round = 0; round < Rounds; ++round)
+    {
+        for (std::unique_ptr<QueuedSession> const& queued : _sessions)
+            for (uint32 i = 0; i < PacketsPerRound; ++i)
+                Receive(*queued, Pattern[(index + i + queued->Session->GetAccountId()) % std::size(Pattern)], index + i);
+
+        index += PacketsPerRound;
+
+        for (std::vector<QueuedSession*> const& shard : shards)
+        {
+            updater.schedule_job([&shard]()
+            {
+                for (QueuedSession* queued : shard)
+                {
+                    SessionLocalFilter local(queued->Session);
+                    queued->Drain(local);
+                }
+            });
+        }
+
+        updater.wait();
+
+        // Serial pass of the world thread
+        for (std::unique_ptr<QueuedSession> const& queued : _sessions)
+        {
+            PacketFilter serial(queued->Session);
+            queued->Drain(serial);
+        }
+    }
+
+    updater.deactivate();
+
+    for (std::unique_ptr<QueuedSession> const& queued : _sessions)
+    {
+        ASSERT_EQ(queued->Handled.size(), Rounds * PacketsPerRound);
+        for (uint32 i = 0; i < queued->Handled.size(); ++i)
+            ASSERT_EQ(queued->Handled[i], i) << "account " << queued->Session->GetAccountId();
+    }
+}
@@ -0,0 +1,81 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "Opcodes.h"
+#include "WorldSessionMovementBundle.h"
+#include "gtest/gtest.h"
+#include "zlib.h"
+#include <vector>
+
+namespace
+{
+    WorldPacket MakeMonsterMove(uint8 fill, std::size_t size)
+    {
+        WorldPacket packet(SMSG_MONSTER_MOVE, size);
+        for (std::size_t i = 0; i < size; ++i)
+            packet << uint8(fill);
+
+        return packet;
+    }
+}
+
+TEST(WorldSessionMovementBundleTest, CanBundle)
+{
+    EXPECT_TRUE(WorldSessionMovementBundle::CanBundle(MakeMonsterMove(1, 40)));
+    EXPECT_TRUE(WorldSessionMovementBundle::CanBundle(MakeMonsterMove(1, 253)));
+    EXPECT_FALSE(WorldSessionMovementBundle::CanBundle(MakeMonsterMove(1, 254)));
+    EXPECT_FALSE(WorldSessionMovementBundle::CanBundle(WorldPacket(SMSG_UPDATE_OBJECT, 0)));
+}
+
+TEST(WorldSessionMovementBundleTest, SinglePacketIsSentAsIs)
+{
+    WorldSessionMovementBundle bundle;
+    bundle.Add(MakeMonsterMove(7, 30));
+
+    WorldPacket packet = bundle.Build(1);
+    EXPECT_EQ(packet.GetOpcode(), SMSG_MONSTER_MOVE);
+    EXPECT_EQ(packet.size(), 30u);
+    EXPECT_EQ(packet.read<uint8>(29), 7);
+    EXPECT_TRUE(bundle.IsEmpty());
+}
+
+TEST(WorldSessionMovementBundleTest, CompressedLayout)
+{
+    WorldSessionMovementBundle bundle;
+    bundle.Add(MakeMonsterMove(1, 30));
+    bundle.Add(MakeMonsterMove(2, 253));
+    EXPECT_EQ(bundle.GetCount(), 2u);
+    EXPECT_EQ(bundle.GetSize(), 3u + 30u + 3u + 253u);
+
+    WorldPacket packet = bundle.Build(1);
+    EXPECT_EQ(packet.GetOpcode(), SMSG_COMPRESSED_MOVES);
+    EXPECT_TRUE(bundle.IsEmpty());
+
+    uLongf size = packet.read<uint32>(0);
+    ASSERT_EQ(size, 3u + 30u + 3u + 253u);
+
+    std::vector<uint8> inflated(size);
+    ASSERT_EQ(uncompress(inflated.data(), &size, packet.contents() + sizeof(uint32), packet.size() - sizeof(uint32)), Z_OK);
+
+    // uint8 size of opcode and payload, uint16 opcode, payload
+    EXPECT_EQ(inflated[0], 32);
+    EXPECT_EQ(inflated[1] | (inflated[2] << 8), SMSG_MONSTER_MOVE);
+    EXPECT_EQ(inflated[3], 1);
+    EXPECT_EQ(inflated[33], 255);
+    EXPECT_EQ(inflated[34] | (inflated[35] << 8), SMSG_MONSTER_MOVE);
+    EXPECT_EQ(inflated[36], 2);
+}
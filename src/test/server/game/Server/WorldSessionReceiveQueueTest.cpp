@@ -0,0 +1,183 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "Opcodes.h"
+#include "WorldSession.h"
+#include "WorldSessionReceiveQueue.h"
+#include "gtest/gtest.h"
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    // Map update: everything but the world thread opcodes
+    class MapThreadFilter : public PacketFilter
+    {
+    public:
+        MapThreadFilter() : PacketFilter(nullptr) { }
+
+        bool Process(WorldPacket* packet) override
+        {
+            return opcodeTable[static_cast<OpcodeClient>(packet->GetOpcode())]->ProcessingPlace != PROCESS_THREADUNSAFE;
+        }
+    };
+
+    class AnyFilter : public PacketFilter
+    {
+    public:
+        AnyFilter() : PacketFilter(nullptr) { }
+    };
+
+    // PROCESS_INPLACE, PROCESS_THREADUNSAFE and PROCESS_THREADSAFE, the first and last share a lane
+    constexpr Opcodes Pattern[] = { CMSG_NAME_QUERY, CMSG_MESSAGECHAT, CMSG_SET_SELECTION, CMSG_MESSAGECHAT, CMSG_MESSAGECHAT };
+
+    ReceivedWorldPacket* MakePacket(Opcodes opcode, uint32 producer, uint32 index)
+    {
+        WorldPacket packet(opcode, 8);
+        packet << uint32(producer);
+        packet << uint32(index);
+        return new ReceivedWorldPacket(std::move(packet));
+    }
+
+    std::vector<uint32> DrainIndexes(WorldSessionReceiveQueue& queue, PacketFilter& filter)
+    {
+        std::vector<uint32> indexes;
+        while (ReceivedWorldPacket* packet = queue.Next(filter))
+        {
+            indexes.push_back(packet->read<uint32>(4));
+            delete packet;
+        }
+
+        return indexes;
+    }
+}
+
+class WorldSessionReceiveQueueTest : public ::testing::Test
+{
+protected:
+    static void SetUpTestSuite()
+    {
+        if (!opcodeTable[CMSG_NAME_QUERY])
+            opcodeTable.Initialize();
+    }
+};
+
+TEST_F(WorldSessionReceiveQueueTest, HandsOutBothLanesInArrivalOrder)
+{
+    WorldSessionReceiveQueue queue;
+    for (uint32 i = 0; i < 10; ++i)
+        queue.Add(MakePacket(Pattern[i % std::size(Pattern)], 0, i));
+
+    AnyFilter filter;
+    EXPECT_EQ(DrainIndexes(queue, filter), (std::vector<uint32>{ 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 }));
+}
+
+TEST_F(WorldSessionReceiveQueueTest, StopsAtTheFirstRefusedPacket)
+{
+    WorldSessionReceiveQueue queue;
+    queue.Add(MakePacket(CMSG_NAME_QUERY, 0, 0));
+    queue.Add(MakePacket(CMSG_SET_SELECTION, 0, 1));
+    queue.Add(MakePacket(CMSG_MESSAGECHAT, 0, 2));
+    queue.Add(MakePacket(CMSG_NAME_QUERY, 0, 3));
+
+    MapThreadFilter mapFilter;
+    EXPECT_EQ(DrainIndexes(queue, mapFilter), (std::vector<uint32>{ 0, 1 }));
+
+    AnyFilter filter;
+    EXPECT_EQ(DrainIndexes(queue, filter), (std::vector<uint32>{ 2, 3 }));
+}
+
+TEST_F(WorldSessionReceiveQueueTest, RequeuedPacketsComeFirst)
+{
+    WorldSessionReceiveQueue queue;
+    for (uint32 i = 0; i < 5; ++i)
+        queue.Add(MakePacket(Pattern[i], 0, i));
+
+    AnyFilter filter;
+    std::vector<ReceivedWorldPacket*> throttled;
+    throttled.push_back(queue.Next(filter));
+    throttled.push_back(queue.Next(filter));
+    ASSERT_NE(throttled[1], nullptr);
+
+    queue.Requeue(throttled);
+    queue.Add(MakePacket(CMSG_NAME_QUERY, 0, 5));
+
+    EXPECT_EQ(DrainIndexes(queue, filter), (std::vector<uint32>{ 0, 1, 2, 3, 4, 5 }));
+}
+
+TEST_F(WorldSessionReceiveQueueTest, ManyProducersKeepTheirOrder)
+{
+    constexpr uint32 ProducerCount = 4;
+    constexpr uint32 PacketsPerProducer = 50000;
+
+    WorldSessionReceiveQueue queue;
+    std::atomic<uint32> finishedProducers{0};
+    std::vector<std::thread> producers;
+    for (uint32 producer = 0; producer < ProducerCount; ++producer)
+    {
+        producers.emplace_back([&queue, &finishedProducers, producer]()
+        {
+            for (uint32 i = 0; i < PacketsPerProducer; ++i)
+                queue.Add(MakePacket(Pattern[(i + producer) % std::size(Pattern)], producer, i));
+
+            ++finishedProducers;
+        });
+    }
+
+    // The consumer runs while the producers add, switching between the map and the world thread filters
+    std::vector<uint32> nextIndexes(ProducerCount, 0);
+    uint64 lastSequence = 0;
+    uint32 received = 0;
+    bool inOrder = true;
+    MapThreadFilter mapFilter;
+    AnyFilter filter;
+    for (uint32 round = 0; inOrder; ++round)
+    {
+        // once every producer is done, a last pass takes everything left
+        bool const lastRound = finishedProducers == ProducerCount;
+        PacketFilter& roundFilter = lastRound || round % 2 ? static_cast<PacketFilter&>(filter) : mapFilter;
+        while (ReceivedWorldPacket* packet = queue.Next(roundFilter))
+        {
+            uint32 const producer = packet->read<uint32>(0);
+            uint32 const index = packet->read<uint32>(4);
+            if (producer >= ProducerCount || index != nextIndexes[producer] || (received && packet->Sequence <= lastSequence))
+                inOrder = false;
+            else
+                ++nextIndexes[producer];
+
+            lastSequence = packet->Sequence;
+            ++received;
+            delete packet;
+        }
+
+        if (lastRound)
+            break;
+    }
+
+    for (std::thread& producer : producers)
+        producer.join();
+
+    EXPECT_TRUE(inOrder);
+    EXPECT_EQ(received, ProducerCount * PacketsPerProducer);
+    for (uint32 producer = 0; producer < ProducerCount; ++producer)
+        EXPECT_EQ(nextIndexes[producer], PacketsPerProducer) << "producer " << producer;
+
+    AnyFilter leftFilter;
+    EXPECT_EQ(queue.Next(leftFilter), nullptr);
+}
@@ -0,0 +1,87 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "LoadTaskGraph.h"
+#include "gtest/gtest.h"
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <vector>
+
+TEST(LoadTaskGraphTest, SingleThreadKeepsRegistrationOrder)
+{
+    LoadTaskGraph graph("test");
+    std::vector<int> order;
+
+    LoadTaskGraph::TaskId const first = graph.AddTask("first", [&]() { order.push_back(0); });
+    graph.AddTask("second", [&]() { order.push_back(1); });
+    graph.AddTask("third", [&]() { order.push_back(2); }, { first });
+
+    graph.Run(1);
+
+    EXPECT_EQ(order, (std::vector<int>{ 0, 1, 2 }));
+}
+
+TEST(LoadTaskGraphTest, DependenciesFinishBeforeDependents)
+{
+    LoadTaskGraph graph("test");
+    std::mutex lock;
+    std::vector<LoadTaskGraph::TaskId> finished;
+
+    auto record = [&](LoadTaskGraph::TaskId id)
+    {
+        return [&, id]()
+        {
+            std::lock_guard<std::mutex> guard(lock);
+            finished.push_back(id);
+        };
+    };
+
+    // 0 -> 1 -> 2, 3 and 4 independent, 5 depends on everything
+    graph.AddTask("a", record(0));
+    graph.AddTask("b", record(1), { 0 });
+    graph.AddTask("c", record(2), { 1 });
+    graph.AddTask("d", record(3));
+    graph.AddTask("e", record(4));
+    graph.AddTask("f", record(5), { 0, 1, 2, 3, 4 });
+
+    graph.Run(4);
+
+    ASSERT_EQ(finished.size(), 6u);
+
+    auto position = [&](LoadTaskGraph::TaskId id)
+    {
+        return std::find(finished.begin(), finished.end(), id) - finished.begin();
+    };
+
+    EXPECT_LT(position(0), position(1));
+    EXPECT_LT(position(1), position(2));
+    EXPECT_EQ(position(5), 5);
+}
+
+TEST(LoadTaskGraphTest, RunsEveryTaskOnce)
+{
+    LoadTaskGraph graph("test");
+    std::atomic<uint32> calls = 0;
+
+    for (uint32 i = 0; i < 100; ++i)
+        graph.AddTask("task", [&]() { ++calls; }, i ? std::vector<LoadTaskGraph::TaskId>{ i / 2 } : std::vector<LoadTaskGraph::TaskId>{});
+
+    graph.Run(8);
+
+    EXPECT_EQ(calls, 100u);
+}
@@ -0,0 +1,110 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "WorldMaintenanceScheduler.h"
+#include "gtest/gtest.h"
+#include <string>
+#include <vector>
+
+namespace
+{
+    WorldMaintenanceScheduler::JobFunction Record(std::vector<std::string>& runs, std::string name, WorldMaintenanceResult result = WorldMaintenanceResult::Done)
+    {
+        return [&runs, name, result](uint32 /*diff*/, TimePoint /*deadline*/)
+        {
+            runs.push_back(name);
+            return result;
+        };
+    }
+}
+
+TEST(WorldMaintenanceSchedulerTest, DueJobsRunByPriority)
+{
+    WorldMaintenanceScheduler scheduler;
+    std::vector<std::string> runs;
+    bool due = false;
+
+    scheduler.AddJob("low", WorldMaintenancePriority::Low, nullptr, Record(runs, "low"));
+    scheduler.AddJob("normal", WorldMaintenancePriority::Normal, [&due]() { return due; }, Record(runs, "normal"));
+    scheduler.AddJob("high", WorldMaintenancePriority::High, nullptr, Record(runs, "high"));
+
+    scheduler.Update(50, Milliseconds(1000));
+    EXPECT_EQ(runs, (std::vector<std::string>{ "high", "low" }));
+
+    runs.clear();
+    due = true;
+    scheduler.Update(50, Milliseconds(1000));
+    EXPECT_EQ(runs, (std::vector<std::string>{ "high", "normal", "low" }));
+}
+
+TEST(WorldMaintenanceSchedulerTest, DeferredOverBudget)
+{
+    WorldMaintenanceScheduler scheduler;
+    std::vector<std::string> runs;
+    uint32 normalDiff = 0;
+
+    scheduler.AddJob("high", WorldMaintenancePriority::High, nullptr, Record(runs, "high"));
+    scheduler.AddJob("normal", WorldMaintenancePriority::Normal, nullptr, [&](uint32 diff, TimePoint /*deadline*/)
+    {
+        runs.push_back("normal");
+        normalDiff = diff;
+        return WorldMaintenanceResult::Done;
+    });
+
+    // No budget at all, only the high priority job runs until the other one waited long enough
+    for (uint32 i = 0; i < WorldMaintenanceScheduler::MAX_DEFERRED_TICKS; ++i)
+        scheduler.Update(50, Milliseconds(0));
+
+    EXPECT_EQ(runs, std::vector<std::string>(WorldMaintenanceScheduler::MAX_DEFERRED_TICKS, "high"));
+    EXPECT_EQ(scheduler.GetDeferredTicks(1), WorldMaintenanceScheduler::MAX_DEFERRED_TICKS);
+
+    runs.clear();
+    scheduler.Update(50, Milliseconds(0));
+    EXPECT_EQ(runs, (std::vector<std::string>{ "high", "normal" }));
+    EXPECT_EQ(normalDiff, 50 * (WorldMaintenanceScheduler::MAX_DEFERRED_TICKS + 1));
+    EXPECT_EQ(scheduler.GetDeferredTicks(1), 0u);
+}
+
+TEST(WorldMaintenanceSchedulerTest, YieldedJobResumesFirst)
+{
+    WorldMaintenanceScheduler scheduler;
+    std::vector<std::string> runs;
+    WorldMaintenanceResult result = WorldMaintenanceResult::Yield;
+    bool due = true;
+
+    scheduler.AddJob("first", WorldMaintenancePriority::Normal, nullptr, Record(runs, "first"));
+    scheduler.AddJob("second", WorldMaintenancePriority::Normal, [&due]() { return due; }, [&](uint32 /*diff*/, TimePoint /*deadline*/)
+    {
+        runs.push_back("second");
+        return result;
+    });
+    scheduler.AddJob("low", WorldMaintenancePriority::Low, nullptr, Record(runs, "low"));
+
+    scheduler.Update(50, Milliseconds(1000));
+    EXPECT_EQ(runs, (std::vector<std::string>{ "first", "second", "low" }));
+
+    // A yielded job runs again even when it is not due any more
+    runs.clear();
+    due = false;
+    result = WorldMaintenanceResult::Done;
+    scheduler.Update(50, Milliseconds(1000));
+    EXPECT_EQ(runs, (std::vector<std::string>{ "second", "first", "low" }));
+
+    runs.clear();
+    scheduler.Update(50, Milliseconds(1000));
+    EXPECT_EQ(runs, (std::vector<std::string>{ "first", "low" }));
+}
@@ -0,0 +1,66 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "ByteBuffer.h"
+#include "ByteBufferPool.h"
+#include "gtest/gtest.h"
+#include <thread>
+
+TEST(ByteBufferPoolTest, AcquireRoundsUpToSizeClass)
+{
+    EXPECT_GE(ByteBufferPool::Acquire(1).capacity(), ByteBufferPool::SizeClasses[0]);
+    EXPECT_GE(ByteBufferPool::Acquire(0x401).capacity(), ByteBufferPool::SizeClasses[2]);
+
+    // Beyond the largest class the requested size is used as is
+    std::vector<uint8> large = ByteBufferPool::Acquire(400000);
+    EXPECT_GE(large.capacity(), 400000u);
+    EXPECT_TRUE(large.empty());
+}
+
+TEST(ByteBufferPoolTest, ReleasedStorageIsReused)
+{
+    std::vector<uint8> storage = ByteBufferPool::Acquire(0x1000);
+    storage.resize(100, 0xAA);
+    uint8 const* data = storage.data();
+
+    ByteBufferPool::Release(std::move(storage));
+
+    std::vector<uint8> reused = ByteBufferPool::Acquire(0x1000);
+    EXPECT_EQ(reused.data(), data);
+    EXPECT_TRUE(reused.empty());
+}
+
+TEST(ByteBufferPoolTest, BufferReleasedOnAnotherThread)
+{
+    ByteBuffer buffer(200);
+    buffer << uint32(1) << uint32(2);
+    ByteBuffer moved(std::move(buffer));
+
+    // Storage released on a thread that exits goes to the shared depot
+    std::thread([moved = std::move(moved)]() mutable
+    {
+        EXPECT_EQ(moved.read<uint32>(), 1u);
+        EXPECT_EQ(moved.read<uint32>(), 2u);
+    }).join();
+
+    ByteBuffer grown(1);
+    for (uint32 i = 0; i < 1000; ++i)
+        grown << i;
+
+    EXPECT_EQ(grown.size(), 4000u);
+    EXPECT_EQ(grown.read<uint32>(999 * 4), 999u);
+}
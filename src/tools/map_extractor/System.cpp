@@ -162,6 +162,7 @@ void Usage(char* prg)
         "-o set output path\n"\
         "-e extract only MAP(1)/DBC(2)/Camera(4) - standard: all(7)\n"\
         "-f height stored as int (less map size but lost some accuracy) 1 by default\n"\
+        "-t max height error (in yards) when storing height as int, replaces the default height range limits\n"\
         "Example: %s -f 0 -i \"c:\\games\\game\"", prg, prg);
     exit(1);
 }
@@ -174,6 +175,7 @@ void HandleArgs(int argc, char* arg[])
         // o - output path
         // e - extract only MAP(1)/DBC(2) - standard both(3)
         // f - use float to int conversion
+        // t - max height error of the float to int conversion
         // h - limit minimum height
         if (arg[c][0] != '-')
         {
@@ -214,6 +216,24 @@ void HandleArgs(int argc, char* arg[])
                     Usage(arg[0]);
                 }
                 break;
+            case 't':
+                if (c + 1 < argc)                           // all ok
+                {
+                    float const tolerance = float(atof(arg[(c++) + 1]));
+                    if (tolerance <= 0.0f)
+                    {
+                        Usage(arg[0]);
+                    }
+
+                    // Values are rounded to the nearest step, so the error is at most half a step
+                    CONF_float_to_int8_limit = tolerance * 2 * 255;
+                    CONF_float_to_int16_limit = tolerance * 2 * 65535;
+                }
+                else
+                {
+                    Usage(arg[0]);
+                }
+                break;
             case 'e':
                 if (c + 1 < argc)                           // all ok
                 {